@@ -0,0 +1,534 @@
+/*!
+ * @file    nparsy_cli.c
+ * @brief   nparsy command-line tool: extract numbers from stdin or files.
+ * @note    Usage: nparsy [-f dec|hex|bin|oct] [-i | -s scale] [-t text|u64|i64|f64 | -n out.npy] [file...]
+ *          See PrintUsage() for details.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* Feature Test Macros */
+// getopt/optarg/optind and O_CLOEXEC are hidden under a strict -std
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "nparsy_types.h"
+#include "nparsy_stream.h"
+#include "nparsy_fixed.h"
+#include "nparsy_npy.h"
+
+/* Local Macro Definitions */
+
+/* Datatypes */
+constexpr size_t CLI_READ_CHUNK_LEN = 1024u * 1024u;
+constexpr size_t CLI_FIXED_CHUNK_LEN = 512u * 1024u; // < NPARSY_MAX_PARSABLE_STRING_LEN
+constexpr size_t CLI_OUT_BUF_LEN = 1024u * 1024u;
+constexpr size_t CLI_MAX_TEXT_LEN = 48u;             // one value + separator, any output kind
+constexpr size_t CLI_NPY_BATCH_LEN = 1024u;
+
+enum OutputKind
+{
+   Output_Text,
+   Output_U64, // raw little-endian
+   Output_I64, // raw little-endian
+   Output_F64, // raw little-endian IEEE-754 binary64
+};
+
+struct Options
+{
+   enum NParsyNumFormat fmt;
+   bool is_signed;  // extract signed fixed-point numbers instead of unsigned integers
+   uint8_t scale;   // fractional digits kept when is_signed
+   enum OutputKind out;
+   bool out_given;
+   const char * npy_path; // write a .npy array here instead of to stdout
+};
+
+// Buffered writer so output goes out in large write()s
+struct Output
+{
+   struct NParsyNpyWriter * npy; // set when writing a .npy array instead
+   enum OutputKind kind;
+   uint8_t scale;
+   bool failed;
+   size_t len;
+   char buf[CLI_OUT_BUF_LEN];
+};
+
+/* Local Data */
+#define NPARSY_RESULT(enum, msg) msg,
+static const char * const ResultMsgs[] =
+{
+#  include "nparsy_results_list.h"
+};
+#undef NPARSY_RESULT
+
+static const int64_t Pow10[NPARSY_MAX_FIXED_SCALE + 1] =
+{
+   1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000,
+   1'000'000'000, 10'000'000'000, 100'000'000'000, 1'000'000'000'000,
+   10'000'000'000'000, 100'000'000'000'000, 1'000'000'000'000'000,
+   10'000'000'000'000'000, 100'000'000'000'000'000, 1'000'000'000'000'000'000
+};
+
+/*** Private Function Prototypes ***/
+static void PrintUsage(FILE * f);
+static bool ParseArgs(int argc, char * argv[], struct Options * opts, int * first_file);
+static bool ProcessFd(int fd, const struct Options * opts, struct Output * out);
+static bool ProcessFdSigned(int fd, const struct Options * opts, struct Output * out);
+static bool UIntSink(const uint64_t * vals, size_t n, void * ctx);
+static void EmitU64(struct Output * out, uint64_t v);
+static void EmitI64(struct Output * out, int64_t v);
+static void EmitI64sToNpy(struct Output * out, const int64_t * vals, size_t n);
+static void OutputFlush(struct Output * out);
+static void PutLE64(char * p, uint64_t v);
+static size_t FormatU64(char * p, uint64_t v);
+static size_t FindSafeCut(const char * buf, size_t len);
+
+/* Main */
+
+int main(int argc, char * argv[])
+{
+   struct Options opts = { .fmt = NParsy_Dec, .out = Output_Text };
+   int first_file = argc;
+   if ( !ParseArgs(argc, argv, &opts, &first_file) )
+   {
+      PrintUsage(stderr);
+      return 2;
+   }
+
+   struct Output * out = malloc(sizeof *out);
+   if ( out == nullptr )
+   {
+      fprintf(stderr, "nparsy: %s\n", ResultMsgs[NParsy_OutOfMemory]);
+      return 1;
+   }
+   out->npy = nullptr;
+   out->kind = opts.out;
+   out->scale = opts.scale;
+   out->failed = false;
+   out->len = 0;
+
+   if ( opts.npy_path != nullptr )
+   {
+      // The array's dtype follows from what's being extracted
+      enum NParsyNpyDtype dtype = !opts.is_signed   ? NParsy_NpyU64
+                                : (opts.scale == 0u) ? NParsy_NpyI64
+                                :                      NParsy_NpyF64;
+      enum NParsyResult res = NParsyNpyOpen(&out->npy, opts.npy_path, dtype);
+      if ( res != NParsy_GoodResult )
+      {
+         fprintf(stderr, "nparsy: %s: %s\n", opts.npy_path, ResultMsgs[res]);
+         free(out);
+         return 1;
+      }
+   }
+
+   bool ok = true;
+   if ( first_file == argc )
+   {
+      ok = ProcessFd(STDIN_FILENO, &opts, out);
+   }
+   else
+   {
+      for ( int i = first_file; (i < argc) && !out->failed; i++ )
+      {
+         bool is_stdin = (strcmp(argv[i], "-") == 0);
+         int fd = is_stdin ? STDIN_FILENO : open(argv[i], O_RDONLY | O_CLOEXEC);
+         if ( fd < 0 )
+         {
+            fprintf(stderr, "nparsy: %s: %s\n", argv[i], strerror(errno));
+            ok = false;
+            continue;
+         }
+
+         if ( !ProcessFd(fd, &opts, out) )
+         {
+            fprintf(stderr, "nparsy: %s: read failed\n", argv[i]);
+            ok = false;
+         }
+
+         if ( !is_stdin )
+            (void)close(fd);
+      }
+   }
+
+   OutputFlush(out);
+   if ( (out->npy != nullptr) && (NParsyNpyClose(out->npy, nullptr) != NParsy_GoodResult) )
+   {
+      out->failed = true;
+      errno = EIO;
+   }
+   if ( out->failed )
+   {
+      fprintf(stderr, "nparsy: write failed: %s\n", strerror(errno));
+      ok = false;
+   }
+   free(out);
+
+   return ok ? 0 : 1;
+}
+
+/*** Private Function Implementations ***/
+
+static void PrintUsage(FILE * f)
+{
+   fprintf(f,
+      "Usage: nparsy [options] [file...]\n"
+      "Extract numbers from the files given (or stdin, also as '-').\n"
+      "\n"
+      "  -f dec|hex|bin|oct   format assumed for bare numbers like 10 (default: dec)\n"
+      "  -i                   extract signed integers (fractions are truncated)\n"
+      "  -s <0-%u>            extract signed decimals, keeping this many fractional digits\n"
+      "  -t text|u64|i64|f64  output one number per line (default), or raw\n"
+      "                       little-endian uint64, int64, or binary64 values\n"
+      "  -n <out.npy>         write a NumPy array instead: uint64, int64 with -i,\n"
+      "                       or float64 with -s\n"
+      "  -h                   show this help\n",
+      (unsigned)NPARSY_MAX_FIXED_SCALE );
+}
+
+static bool ParseArgs(int argc, char * argv[], struct Options * opts, int * first_file)
+{
+   static const char * const FmtNames[NParsy_NumOfFmts] = { "dec", "hex", "bin", "oct" };
+   static const char * const OutNames[] = { "text", "u64", "i64", "f64" };
+
+   int opt;
+   while ( (opt = getopt(argc, argv, "f:is:t:n:h")) != -1 )
+   {
+      switch ( opt )
+      {
+         case 'f':
+         {
+            int i = 0;
+            while ( (i < (int)NParsy_NumOfFmts) && (strcmp(optarg, FmtNames[i]) != 0) )
+               ++i;
+            if ( i == (int)NParsy_NumOfFmts )
+               return false;
+            opts->fmt = (enum NParsyNumFormat)i;
+            break;
+         }
+
+         case 'i':
+            opts->is_signed = true;
+            break;
+
+         case 's':
+         {
+            char * end;
+            unsigned long scale = strtoul(optarg, &end, 10);
+            if ( (*end != '\0') || (end == optarg) || (scale > NPARSY_MAX_FIXED_SCALE) )
+               return false;
+            opts->is_signed = true;
+            opts->scale = (uint8_t)scale;
+            break;
+         }
+
+         case 't':
+         {
+            size_t i = 0;
+            while ( (i < (sizeof OutNames / sizeof OutNames[0])) && (strcmp(optarg, OutNames[i]) != 0) )
+               ++i;
+            if ( i == (sizeof OutNames / sizeof OutNames[0]) )
+               return false;
+            opts->out = (enum OutputKind)i;
+            opts->out_given = true;
+            break;
+         }
+
+         case 'n':
+            opts->npy_path = optarg;
+            break;
+
+         case 'h':
+            PrintUsage(stdout);
+            exit(0);
+
+         default:
+            return false;
+      }
+   }
+
+   // Signed extraction only understands decimal
+   if ( opts->is_signed && (opts->fmt != NParsy_Dec) )
+      return false;
+   // The array's dtype is picked from the extraction instead
+   if ( opts->out_given && (opts->npy_path != nullptr) )
+      return false;
+
+   *first_file = optind;
+   return true;
+}
+
+static bool ProcessFd(int fd, const struct Options * opts, struct Output * out)
+{
+   if ( opts->is_signed )
+      return ProcessFdSigned(fd, opts, out);
+
+   // Reads are double-buffered on a helper thread by the library
+   enum NParsyResult res = NParsyUIntStreamFd(fd, CLI_READ_CHUNK_LEN, UIntSink, out, nullptr, opts->fmt);
+   if ( (res != NParsy_GoodResult) && (res != NParsy_FileAccessFailed) )
+      fprintf(stderr, "nparsy: %s\n", ResultMsgs[res]);
+
+   return res == NParsy_GoodResult;
+}
+
+/**
+ * @brief Signed numbers go through NParsyFixedList a chunk at a time, each
+ *        chunk cut at a separator so no number is split between two.
+ */
+static bool ProcessFdSigned(int fd, const struct Options * opts, struct Output * out)
+{
+   char * buf = malloc(CLI_FIXED_CHUNK_LEN + 1u);
+   size_t cap = (CLI_FIXED_CHUNK_LEN / 2u) + 1u; // at most one number per two chars
+   int64_t * vals = malloc(cap * sizeof *vals);
+   if ( (buf == nullptr) || (vals == nullptr) )
+   {
+      fprintf(stderr, "nparsy: %s\n", ResultMsgs[NParsy_OutOfMemory]);
+      free(buf);
+      free(vals);
+      return false;
+   }
+
+   size_t have = 0;
+   bool eof = false;
+   bool ok = true;
+   while ( !eof && !out->failed )
+   {
+      ssize_t n = read(fd, buf + have, CLI_FIXED_CHUNK_LEN - have);
+      if ( n < 0 )
+      {
+         if ( errno == EINTR )
+            continue;
+         ok = false;
+         break;
+      }
+      eof = (n == 0);
+      have += (size_t)n;
+      if ( !eof && (have < CLI_FIXED_CHUNK_LEN) )
+         continue; // Keep the chunks large
+
+      size_t cut = eof ? have : FindSafeCut(buf, have);
+      if ( cut == 0u )
+         cut = have; // One giant token: nothing sensible to carry
+
+      // Nulls would end the string early
+      for ( char * z = memchr(buf, '\0', cut); z != nullptr; z = memchr(z, '\0', cut - (size_t)(z - buf)) )
+         *z = ' ';
+
+      char saved = buf[cut];
+      buf[cut] = '\0';
+      size_t np = 0;
+      enum NParsyResult res = NParsyFixedList(buf, opts->scale, vals, cap, &np, NParsy_Truncate);
+      buf[cut] = saved;
+      if ( res != NParsy_GoodResult )
+      {
+         fprintf(stderr, "nparsy: %s\n", ResultMsgs[res]);
+         ok = false;
+         break;
+      }
+
+      if ( out->npy != nullptr )
+         EmitI64sToNpy(out, vals, np);
+      else
+         for ( size_t i = 0; i < np; i++ )
+            EmitI64(out, vals[i]);
+
+      memmove(buf, buf + cut, have - cut);
+      have -= cut;
+   }
+
+   free(vals);
+   free(buf);
+   return ok;
+}
+
+/**
+ * @brief Last point in buf that's safe to cut at: just past a char that
+ *        can't be part of any number.
+ * @return 0 if there's none
+ */
+static size_t FindSafeCut(const char * buf, size_t len)
+{
+   for ( size_t i = len; i > 0u; i-- )
+   {
+      char c = buf[i - 1u];
+      bool numeric = ((c >= '0') && (c <= '9')) || ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z'))
+                     || (c == '.') || (c == '+') || (c == '-') || (c == '\'');
+      if ( !numeric )
+         return i;
+   }
+   return 0;
+}
+
+static bool UIntSink(const uint64_t * vals, size_t n, void * ctx)
+{
+   struct Output * out = ctx;
+   if ( out->npy != nullptr )
+   {
+      out->failed = !NParsyNpyUIntSink(vals, n, out->npy);
+      return !out->failed;
+   }
+   for ( size_t i = 0; i < n; i++ )
+      EmitU64(out, vals[i]);
+   return !out->failed;
+}
+
+static void EmitU64(struct Output * out, uint64_t v)
+{
+   if ( (CLI_OUT_BUF_LEN - out->len) < CLI_MAX_TEXT_LEN )
+      OutputFlush(out);
+
+   char * p = out->buf + out->len;
+   switch ( out->kind )
+   {
+      case Output_Text:
+         out->len += FormatU64(p, v);
+         out->buf[out->len++] = '\n';
+         break;
+
+      case Output_U64:
+      case Output_I64: // Same bits; values over INT64_MAX wrap
+         PutLE64(p, v);
+         out->len += 8u;
+         break;
+
+      case Output_F64:
+      {
+         double d = (double)v;
+         uint64_t bits;
+         memcpy(&bits, &d, sizeof bits);
+         PutLE64(p, bits);
+         out->len += 8u;
+         break;
+      }
+
+      default:
+         break;
+   }
+}
+
+static void EmitI64(struct Output * out, int64_t v)
+{
+   if ( (CLI_OUT_BUF_LEN - out->len) < CLI_MAX_TEXT_LEN )
+      OutputFlush(out);
+
+   char * p = out->buf + out->len;
+   uint64_t mag = (v < 0) ? (0u - (uint64_t)v) : (uint64_t)v;
+   switch ( out->kind )
+   {
+      case Output_Text:
+      {
+         if ( v < 0 )
+            *p++ = '-';
+         uint64_t unit = (uint64_t)Pow10[out->scale];
+         p += FormatU64(p, mag / unit);
+         if ( out->scale > 0u )
+         {
+            // Zero-padded fraction
+            char frac[24];
+            size_t flen = FormatU64(frac, mag % unit);
+            *p++ = '.';
+            memset(p, '0', out->scale - flen);
+            p += out->scale - flen;
+            memcpy(p, frac, flen);
+            p += flen;
+         }
+         *p++ = '\n';
+         out->len = (size_t)(p - out->buf);
+         break;
+      }
+
+      case Output_U64:
+      case Output_I64:
+         PutLE64(p, (uint64_t)v);
+         out->len += 8u;
+         break;
+
+      case Output_F64:
+      {
+         double d = (double)v / (double)Pow10[out->scale];
+         uint64_t bits;
+         memcpy(&bits, &d, sizeof bits);
+         PutLE64(p, bits);
+         out->len += 8u;
+         break;
+      }
+
+      default:
+         break;
+   }
+}
+
+static void EmitI64sToNpy(struct Output * out, const int64_t * vals, size_t n)
+{
+   if ( out->scale == 0u )
+   {
+      out->failed = (NParsyNpyAppendI64(out->npy, vals, n) != NParsy_GoodResult) || out->failed;
+      return;
+   }
+
+   double batch[CLI_NPY_BATCH_LEN];
+   for ( size_t i = 0; (i < n) && !out->failed; i += CLI_NPY_BATCH_LEN )
+   {
+      size_t m = ((n - i) < CLI_NPY_BATCH_LEN) ? (n - i) : CLI_NPY_BATCH_LEN;
+      for ( size_t j = 0; j < m; j++ )
+         batch[j] = (double)vals[i + j] / (double)Pow10[out->scale];
+      out->failed = (NParsyNpyAppendF64(out->npy, batch, m) != NParsy_GoodResult);
+   }
+}
+
+static void OutputFlush(struct Output * out)
+{
+   size_t off = 0;
+   while ( (off < out->len) && !out->failed )
+   {
+      ssize_t n = write(STDOUT_FILENO, out->buf + off, out->len - off);
+      if ( n > 0 )
+         off += (size_t)n;
+      else if ( (n < 0) && (errno == EINTR) )
+         continue;
+      else
+         out->failed = true;
+   }
+   out->len = 0;
+}
+
+// Byte-wise so it's little-endian on any host; compiles to a single store on LE ones
+static void PutLE64(char * p, uint64_t v)
+{
+   for ( unsigned i = 0; i < 8u; i++ )
+      p[i] = (char)(uint8_t)(v >> (8u * i));
+}
+
+/**
+ * @return number of chars written to p (no null terminator)
+ */
+static size_t FormatU64(char * p, uint64_t v)
+{
+   char tmp[20];
+   size_t n = 0;
+   do
+   {
+      tmp[n++] = (char)('0' + (v % 10u));
+      v /= 10u;
+   }
+   while ( v != 0u );
+
+   for ( size_t i = 0; i < n; i++ )
+      p[i] = tmp[n - 1u - i];
+   return n;
+}
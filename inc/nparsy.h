@@ -0,0 +1,80 @@
+/**
+ * @file nparsy.h
+ * @brief API for parsing mixed unsigned, signed, and floating-point numbers
+ *        out of a string in one pass.
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef NPARSY_H_
+#define NPARSY_H_
+
+/* File Inclusions */
+#include <stdint.h>
+
+#include "nparsy_types.h"
+#include "nparsy_constants.h"
+
+/* Definitions */
+// Which member of struct NParsyValue holds the value
+enum NParsyValueType
+{
+   NParsy_U64,    // an unsigned integer, in any format (e.g., 42, 0x2A, 101010b)
+   NParsy_I64,    // a negative integer, in any format (e.g., -42, -0x2A)
+   NParsy_F64,    // a decimal with a fraction and/or exponent (e.g., 4.2, -4e1, .5)
+   NParsy_NumOfValueTypes
+};
+
+// One number, tagged with its type
+struct NParsyValue
+{
+   enum NParsyValueType type;
+   union
+   {
+      uint64_t u64;
+      int64_t i64;
+      double f64;
+   };
+};
+
+/**
+ * @brief Parse out the first number occurrence in a string, whatever its type.
+ * @note Each number is classified while it's scanned and then converted once,
+ *       straight into the member its type calls for.
+ * @note Floats are only recognized when default_fmt is NParsy_Dec, since a
+ *       bare "1e5" is a hex integer otherwise.
+ * @param[in] str : string to parse through
+ * @param[out] parsed_val : where the parse result is placed, if one is found; otherwise, nothing is done.
+ * @param[out] accumulated_strlen : [Optional] How many chars were passed-through before result was obtained
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ *         NParsy_NumberOutOfRange if the first number doesn't fit its type
+ *         (e.g., below INT64_MIN, or a float beyond DBL_MAX).
+ */
+[[nodiscard]]
+enum NParsyResult NParsyAny(
+      const char * str,
+      struct NParsyValue * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief Parse out all the numbers in a string, whatever their types.
+ * @note Malformed and out-of-range numbers are skipped.
+ * @param[in] str : string to parse through
+ * @param[out] buf : where the parse results are placed
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyAnyList(
+      const char * str,
+      struct NParsyValue * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+#endif // NPARSY_H_
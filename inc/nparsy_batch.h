@@ -0,0 +1,76 @@
+/**
+ * @file nparsy_batch.h
+ * @brief API for parsing unsigned integers out of many files at once.
+ * @note Linux io_uring is used when available, plain pread() otherwise.
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef NPARSY_BATCH_H_
+#define NPARSY_BATCH_H_
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nparsy_types.h"
+#include "nparsy_constants.h"
+
+/* Definitions */
+constexpr unsigned NPARSY_BATCH_DEFAULT_QUEUE_DEPTH = 64u;
+
+/**
+ * @brief Receives every value parsed out of one file.
+ * @note Called exactly once per file, from worker threads: calls for
+ *       different files may run concurrently and in any order.
+ * @param[in] file_idx : index of the file in the paths array
+ * @param[in] vals : values parsed, in file order. Only valid during the call.
+ * @param[in] n : how many values are in vals
+ * @param[in] result : NParsy_GoodResult, or why the file couldn't be parsed
+ *                     (e.g., NParsy_FileAccessFailed). n is 0 on failure.
+ * @param[in] ctx : whatever was passed alongside the sink
+ */
+typedef void (*NParsyFileSink)(
+      size_t file_idx,
+      const uint64_t * vals,
+      size_t n,
+      enum NParsyResult result,
+      void * ctx );
+
+// Tuning knobs for NParsyUIntFiles. Zeroed fields pick the defaults.
+struct NParsyBatchOptions
+{
+   unsigned workers;      // parser threads; 0 = one per online CPU
+   unsigned queue_depth;  // max files read or waiting to be parsed at once; 0 = NPARSY_BATCH_DEFAULT_QUEUE_DEPTH
+   bool no_io_uring;      // force the pread() path
+};
+
+/**
+ * @brief Parse out all unsigned integers found in each of many files.
+ * @note Many reads are kept in flight through io_uring; each completed file
+ *       buffer is handed to a worker thread for parsing. If io_uring can't be
+ *       set up (old kernel, seccomp, non-Linux), files are read with pread()
+ *       instead, still overlapped with parsing on the workers.
+ * @note Each file is read whole into memory, so this suits many small-ish
+ *       files. See NParsyUIntFile for single huge ones.
+ * @note Numbers that need more than 64 bits are skipped, just like NParsyUIntList.
+ * @param[in] paths : files to parse
+ * @param[in] npaths : length of paths
+ * @param[in] sink : called once per file with its results
+ * @param[in] ctx : [Optional] passed through to sink
+ * @param[in] opts : [Optional] tuning knobs; nullptr for the defaults
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ *         Per-file problems are reported through sink, not here.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntFiles(
+      const char * const * paths,
+      size_t npaths,
+      NParsyFileSink sink,
+      void * ctx,
+      const struct NParsyBatchOptions * opts,
+      enum NParsyNumFormat default_fmt );
+
+#endif // NPARSY_BATCH_H_
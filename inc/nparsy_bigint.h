@@ -0,0 +1,47 @@
+/**
+ * @file nparsy_bigint.h
+ * @brief API for parsing unsigned integers of any width into limb arrays.
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef NPARSY_BIGINT_H_
+#define NPARSY_BIGINT_H_
+
+/* File Inclusions */
+#include <stdint.h>
+
+#include "nparsy_types.h"
+#include "nparsy_constants.h"
+
+/**
+ * @brief Parse out the first unsigned integer occurrence, however wide.
+ * @note Integers may be decimal, hex, binary, or octal - see README.md.
+ * @note The value is written little-endian by limb: limbs[0] holds the least
+ *       significant 64 bits.
+ * @note Hex, binary, and octal convert in linear time. Decimal uses a
+ *       divide-and-conquer conversion (with Karatsuba multiplication) so that
+ *       numbers of many thousands of digits stay subquadratic; that path
+ *       allocates working memory.
+ * @param[in] str : string to parse through
+ * @param[out] limbs : where the parse result is placed, if one is found; otherwise, nothing is done.
+ * @param[in] nlimbs : length of limbs
+ * @param[out] limbs_used : How many limbs the value takes (at least 1). If the
+ *                          result is NParsy_NumberOutOfRange, how many limbs
+ *                          would have been needed.
+ * @param[out] accumulated_strlen : [Optional] How many chars were passed-through, including the number found.
+ *                                             If nullptr, nothing happens.
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult : nparsy library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyBigUInt(
+      const char * str,
+      uint64_t * limbs,
+      size_t nlimbs,
+      size_t * limbs_used,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt );
+
+#endif // NPARSY_BIGINT_H_
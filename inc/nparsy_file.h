@@ -0,0 +1,56 @@
+/**
+ * @file nparsy_file.h
+ * @brief API for parsing unsigned integers straight out of files.
+ * @note POSIX only: files are memory-mapped and parsed in place.
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef NPARSY_FILE_H_
+#define NPARSY_FILE_H_
+
+/* File Inclusions */
+#include <stdint.h>
+
+#include "nparsy_types.h"
+#include "nparsy_constants.h"
+
+/**
+ * @brief Parse out any unsigned integers found in a file until a limit is hit (see below).
+ * @note The file is memory-mapped read-only and parsed in place - no copy is
+ *       made and no null terminator is needed. NPARSY_MAX_PARSABLE_STRING_LEN
+ *       does not apply; the file's size bounds the parse.
+ * @note Limits include the len of the buf passed in and the end of the file.
+ * @note Numbers that need more than 64 bits are skipped, just like NParsyUIntList.
+ * @param[in] path : file to parse through
+ * @param[out] buf : where the parse results are placed, if found; otherwise, nothing is done.
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ *         NParsy_FileAccessFailed if the file couldn't be opened, sized up, or mapped.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntFile(
+      const char * path,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief Same as NParsyUIntFile, but for a file that's already open.
+ * @note The whole file is parsed from the start, regardless of fd's current
+ *       offset. fd must be open for reading and is left open.
+ * @param[in] fd : file descriptor of a regular file
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntFd(
+      int fd,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+#endif // NPARSY_FILE_H_
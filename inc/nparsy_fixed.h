@@ -0,0 +1,68 @@
+/**
+ * @file nparsy_fixed.h
+ * @brief API for parsing decimal numbers into scaled (fixed-point) integers.
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef NPARSY_FIXED_H_
+#define NPARSY_FIXED_H_
+
+/* File Inclusions */
+#include <stdint.h>
+
+#include "nparsy_types.h"
+#include "nparsy_constants.h"
+
+/* Definitions */
+// 10^18 is the largest power of 10 that fits in an int64_t
+constexpr uint8_t NPARSY_MAX_FIXED_SCALE = 18u;
+
+/**
+ * @brief Parse out the first decimal number occurrence as a fixed-point value,
+ *        i.e., "12.345" @ scale 3 -> 12345, "-0.5" @ scale 2 -> -50.
+ * @note The number never goes through a double, so the result is exact.
+ * @note Accepted shape: [+|-]digits[.digits], [+|-].digits
+ * @note Fractional digits beyond the scale are dropped according to rounding.
+ * @param[in] str : string to parse through
+ * @param[in] scale : number of fractional digits kept, 0 to NPARSY_MAX_FIXED_SCALE
+ * @param[out] parsed_val : where the parse result is placed, if one is found; otherwise, nothing is done.
+ * @param[out] accumulated_strlen : [Optional] How many chars were passed-through, including the number found.
+ *                                             If nullptr, nothing happens.
+ * @param[in] rounding : how to treat excess fractional digits
+ * @return enum NParsyResult : nparsy library result type
+ *         NParsy_NumberOutOfRange if the scaled value doesn't fit in an int64_t
+ *         (accumulated_strlen still moves past it so the caller may carry on).
+ */
+[[nodiscard]]
+enum NParsyResult NParsyFixed(
+      const char * str,
+      uint8_t scale,
+      int64_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyRoundingPolicy rounding );
+
+/**
+ * @brief Parse out any fixed-point numbers found until a limit is hit (see below).
+ * @note Limits include the len of the buf passed in, the null terminator,
+ *       and NPARSY_MAX_PARSABLE_STRING_LEN characters reached.
+ * @note Numbers whose scaled value doesn't fit in an int64_t are skipped.
+ * @param[in] str : string to parse through
+ * @param[in] scale : number of fractional digits kept, 0 to NPARSY_MAX_FIXED_SCALE
+ * @param[out] buf : where the parse results are placed, if found; otherwise, nothing is done.
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] rounding : how to treat excess fractional digits
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyFixedList(
+      const char * str,
+      uint8_t scale,
+      int64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyRoundingPolicy rounding );
+
+#endif // NPARSY_FIXED_H_
@@ -0,0 +1,77 @@
+/**
+ * @file nparsy_float.h
+ * @brief API for parsing floating-point numbers out of a string.
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef NPARSY_FLOAT_H_
+#define NPARSY_FLOAT_H_
+
+/* File Inclusions */
+#include <stdint.h>
+
+#include "nparsy_types.h"
+#include "nparsy_constants.h"
+
+/* Definitions */
+// Widest field the column kernels handle without falling back per value
+constexpr size_t NPARSY_MAX_FAST_COLUMN_WIDTH = 17u; // 16 digits + '.'
+
+/**
+ * @brief Where a fixed-width float column sits in each row.
+ * @note Example: rows like "  12.3456\n" -> { .offset = 0, .width = 9,
+ *       .decimal_pos = 4, .stride = 10 }
+ */
+struct NParsyColumnLayout
+{
+   size_t offset;      // index of the column's first char within a row
+   size_t width;       // chars per field, including padding, sign, and '.'
+   size_t decimal_pos; // index of the '.' within the field
+   size_t stride;      // chars from the start of one row to the start of the next
+};
+
+/**
+ * @brief Parse a fixed-width column of floating-point numbers.
+ * @note Rows matching the layout exactly (right-aligned digits behind space
+ *       padding, optional sign, '.' at decimal_pos, digits after it) take the
+ *       batched fast path. Any other row falls back to a general parse of
+ *       that one field, which still takes only space padding around
+ *       [+|-]digits[.digits] (no exponent, hex, inf, or nan) and doesn't
+ *       depend on the locale.
+ * @note Parsing stops at len values, at the last complete field in buf, or
+ *       at the first field that isn't such a number; out is left alone for
+ *       that row.
+ * @param[in] buf : column data (need not be null-terminated)
+ * @param[in] buflen : number of chars in buf
+ * @param[in] layout : column layout
+ * @param[out] out : where the parse results are placed
+ * @param[in] len : length of out
+ * @param[out] num_parsed : [Optional] How many results were placed in out
+ * @return enum NParsyResult - library result type
+ *         NParsy_ColumnRowMismatch if a field couldn't be parsed; num_parsed
+ *         then holds the index of that row.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyDoubleColumn(
+      const char * buf,
+      size_t buflen,
+      const struct NParsyColumnLayout * layout,
+      double * out,
+      size_t len,
+      size_t * num_parsed );
+
+/**
+ * @brief Same as NParsyDoubleColumn but with single precision results.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyFloatColumn(
+      const char * buf,
+      size_t buflen,
+      const struct NParsyColumnLayout * layout,
+      float * out,
+      size_t len,
+      size_t * num_parsed );
+
+#endif // NPARSY_FLOAT_H_
@@ -0,0 +1,117 @@
+/**
+ * @file nparsy_iov.h
+ * @brief API for parsing unsigned integers out of scatter/gather (iovec)
+ *        segments and wraparound ring buffers.
+ * @note POSIX only.
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef NPARSY_IOV_H_
+#define NPARSY_IOV_H_
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/uio.h>
+
+#include "nparsy_types.h"
+#include "nparsy_constants.h"
+
+/* Definitions */
+// A number split across segments is copied into a small carry buffer to be
+// parsed. Anything longer than this (e.g., hundreds of leading zeros) that
+// crosses a segment boundary is skipped as out-of-range.
+constexpr size_t NPARSY_IOV_CARRY_LEN = 256u;
+
+// Position within an iovec array. Zero-initialize it to start from the
+// beginning; NParsyUIntIov moves it past each number parsed.
+struct NParsyIovCursor
+{
+   size_t seg;  // segment index
+   size_t off;  // offset within that segment
+   char prev;   // last char of the segments before seg ('\0' if none)
+};
+
+/**
+ * @brief Parse out the first unsigned integer occurrence at or after cursor.
+ * @note Segments are parsed in place, as if they were one contiguous string:
+ *       no concatenated copy is made, and NPARSY_MAX_PARSABLE_STRING_LEN
+ *       doesn't apply. Empty segments are fine.
+ * @note Can be repeatedly called with the same cursor to walk through every number.
+ * @param[in] iov : segments to parse through, in order
+ * @param[in] iovcnt : how many segments are in iov
+ * @param[out] parsed_val : where the parse result is placed, if one is found; otherwise, nothing is done.
+ * @param[in,out] cursor : [Optional] where to start; moved past the number found
+ *                         (or to the end if none was). If nullptr, starts from the beginning.
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ *         NParsy_InvalidString if a segment has a nullptr base but a non-zero length.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntIov(
+      const struct iovec * iov,
+      size_t iovcnt,
+      uint64_t * parsed_val,
+      struct NParsyIovCursor * cursor,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief Parse out any unsigned integers found across the segments until buf is full.
+ * @note Numbers that need more than 64 bits are skipped, just like NParsyUIntList.
+ * @param[in] iov : segments to parse through, in order
+ * @param[in] iovcnt : how many segments are in iov
+ * @param[out] buf : where the parse results are placed, if found; otherwise, nothing is done.
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ *         NParsy_InvalidString if a segment has a nullptr base but a non-zero length.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU64ListIov(
+      const struct iovec * iov,
+      size_t iovcnt,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief Parse out the unsigned integers in the readable region of a ring
+ *        buffer, in place, until buf is full.
+ * @note The readable region is [tail, head), wrapping around at capacity
+ *       (head == tail is empty). It's parsed as two segments, with a number
+ *       spanning the wrap point stitched like any other (see
+ *       NPARSY_IOV_CARRY_LEN), so the region is never linearized.
+ * @note The region is taken to be still filling (e.g., by UART DMA): a number
+ *       it ends in may not have fully arrived, so it's left unconsumed and
+ *       parsed on a later call, once anything follows it.
+ * @note Numbers that need more than 64 bits are skipped, just like NParsyUIntList.
+ * @param[in] base : start of the ring buffer's storage
+ * @param[in] capacity : size of the storage in chars
+ * @param[in] head : index the producer writes to next
+ * @param[in] tail : index the consumer reads from next
+ * @param[out] buf : where the parse results are placed, if found; otherwise, nothing is done.
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[out] consumed : How many chars past tail were fully parsed - advance
+ *                        tail by this much (mod capacity).
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ *         NParsy_InvalidRingBuffer if capacity is 0 or head/tail isn't below it.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU64ListRing(
+      const char * base,
+      size_t capacity,
+      size_t head,
+      size_t tail,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      size_t * consumed,
+      enum NParsyNumFormat default_fmt );
+
+#endif // NPARSY_IOV_H_
@@ -0,0 +1,89 @@
+/**
+ * @file nparsy_npy.h
+ * @brief API for writing parsed values straight into a NumPy .npy file.
+ * @note POSIX only: the file is memory-mapped and grown in place.
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef NPARSY_NPY_H_
+#define NPARSY_NPY_H_
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nparsy_types.h"
+#include "nparsy_constants.h"
+
+/* Definitions */
+// Element type of the array, written into the .npy header as its descr
+enum NParsyNpyDtype
+{
+   NParsy_NpyU64, // uint64 - e.g., from NParsyUIntList
+   NParsy_NpyI64, // int64 - e.g., from NParsyFixedList at scale 0
+   NParsy_NpyF64, // float64
+   NParsy_NumOfNpyDtypes
+};
+
+// A 1-D .npy array being written. See NParsyNpyOpen.
+struct NParsyNpyWriter;
+
+/**
+ * @brief Create (or truncate) a .npy file to append values to.
+ * @note Values are stored in host byte order, which the header records, so
+ *       nothing is converted on either side: np.load(path, mmap_mode='r')
+ *       maps the data as-is.
+ * @note The file isn't a valid .npy until NParsyNpyClose writes the final shape.
+ * @param[out] writer : set to the new writer
+ * @param[in] path : file to write
+ * @param[in] dtype : element type of the array
+ * @return enum NParsyResult - library result type
+ *         NParsy_FileAccessFailed if the file couldn't be created or mapped.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyNpyOpen(
+      struct NParsyNpyWriter ** writer,
+      const char * path,
+      enum NParsyNpyDtype dtype );
+
+/**
+ * @brief Append values to the array.
+ * @note Each matches one dtype; appending the wrong type is NParsy_InvalidDtype.
+ * @param[in] writer : from NParsyNpyOpen
+ * @param[in] vals : values to append
+ * @param[in] n : how many values are in vals
+ * @return enum NParsyResult - library result type
+ *         NParsy_FileAccessFailed if the file couldn't be grown.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyNpyAppendU64(struct NParsyNpyWriter * writer, const uint64_t * vals, size_t n);
+[[nodiscard]]
+enum NParsyResult NParsyNpyAppendI64(struct NParsyNpyWriter * writer, const int64_t * vals, size_t n);
+[[nodiscard]]
+enum NParsyResult NParsyNpyAppendF64(struct NParsyNpyWriter * writer, const double * vals, size_t n);
+
+/**
+ * @brief NParsyUIntSink that appends to a uint64 writer, so e.g.
+ *        NParsyUIntStreamFd(fd, 0, NParsyNpyUIntSink, writer, ...) parses
+ *        a stream straight into a .npy file.
+ * @param[in] ctx : the struct NParsyNpyWriter *
+ * @return false (stop parsing) if the append failed
+ */
+bool NParsyNpyUIntSink(const uint64_t * vals, size_t n, void * ctx);
+
+/**
+ * @brief Write the final header, trim the file to size, and release the writer.
+ * @param[in] writer : from NParsyNpyOpen. Invalid after this call.
+ * @param[out] num_written : [Optional] How many values the array holds
+ * @return enum NParsyResult - library result type
+ *         NParsy_FileAccessFailed if an earlier append failed or the file
+ *         couldn't be trimmed; the file is then incomplete.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyNpyClose(
+      struct NParsyNpyWriter * writer,
+      size_t * num_written );
+
+#endif // NPARSY_NPY_H_
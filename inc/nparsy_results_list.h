@@ -29,3 +29,19 @@ NPARSY_RESULT( CantUseNoNewLineWithoutQuiet,                    "Can't use --no-
 NPARSY_RESULT( PrematureTerminatingCharEncounted,               "Premature terminating character encountered when a digit was expected." )
 NPARSY_RESULT( NoNumericalDigitsEnteredWithFormat,              "No numerical digits entered wit." )
 NPARSY_RESULT( HexPrefixAndSuffixEncountered,                   "Hexadecimal prefix and suffix encountered. That is not allowed." )
+NPARSY_RESULT( NoNumberFound,                                   "No number was found in the string." )
+NPARSY_RESULT( NumberOutOfRange,                                "Number found does not fit in the requested result type." )
+NPARSY_RESULT( InvalidScale,                                    "Fixed-point scale argument out-of-range." )
+NPARSY_RESULT( InvalidRoundingPolicy,                           "Rounding policy argument out-of-range." )
+NPARSY_RESULT( InvalidColumnLayout,                             "Column layout out-of-range (width, decimal position, offset, or stride)." )
+NPARSY_RESULT( ColumnRowMismatch,                               "A column field could not be parsed as a number." )
+NPARSY_RESULT( OutOfMemory,                                     "Failed to allocate working memory." )
+NPARSY_RESULT( FileAccessFailed,                                "Failed to open, size up, map, or read the input file." )
+NPARSY_RESULT( InvalidDtype,                                    "Array dtype argument out-of-range, or values don't match the array's dtype." )
+NPARSY_RESULT( InvalidLineRange,                                "Line range argument out-of-range of the line index." )
+NPARSY_RESULT( InvalidRingBuffer,                               "Ring buffer capacity, head, or tail out-of-range." )
+NPARSY_RESULT( InvalidFormat,                                   "Malformed scan format: unknown conversion, zero width, or %s without a width." )
+NPARSY_RESULT( FormatMismatch,                                  "Input doesn't match the scan format." )
+NPARSY_RESULT( InvalidDigitSeparators,                          "Digit separators argument has flags outside of enum NParsyDigitSep." )
+NPARSY_RESULT( InvalidGroupSeparator,                           "Thousands separator argument is not one of enum NParsyGroupSep." )
+NPARSY_RESULT( InvalidSyntax,                                   "Custom prefix/suffix is a digit, a hex letter, '-', '.', x, h, or listed twice, or its format is invalid." )
@@ -0,0 +1,86 @@
+/**
+ * @file nparsy_scan.h
+ * @brief API for scanf-style parsing with formats compiled ahead of time.
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef NPARSY_SCAN_H_
+#define NPARSY_SCAN_H_
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdarg.h>
+
+#include "nparsy_types.h"
+#include "nparsy_constants.h"
+
+/* Definitions */
+// A compiled scan format. See NParsyCompileFormat.
+struct NParsyScanPlan;
+
+/**
+ * @brief Compile a scanf-style format into a plan that NParsyScan can run
+ *        over and over without re-reading the format.
+ * @note Conversions (each may have a max field width, e.g. %8x, and a '*' to
+ *       match without assigning, e.g. %*u):
+ *          %u - decimal uint64_t *
+ *          %x - hex uint64_t *, optional 0x prefix
+ *          %o - octal uint64_t *, optional 0o prefix
+ *          %b - binary uint64_t *, optional 0b prefix
+ *          %d - signed decimal int64_t *
+ *          %f - decimal double *, optional fraction and exponent
+ *          %s - run of non-whitespace chars into a char *; a width is
+ *               required, and the buffer must hold width + 1 chars
+ *          %% - a literal '%'
+ * @note As with scanf, whitespace in the format matches any amount of
+ *       whitespace (including none), conversions other than %% skip leading
+ *       whitespace, and any other char must match exactly.
+ * @param[in] fmt : format to compile
+ * @param[out] plan : set to the new plan. Release with NParsyFreeFormat.
+ * @return enum NParsyResult - library result type
+ *         NParsy_InvalidFormat if fmt has an unknown conversion, a %s
+ *         without a width, or a zero width.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyCompileFormat(
+      const char * fmt,
+      struct NParsyScanPlan ** plan );
+
+/**
+ * @brief Run a compiled format against str, assigning through the pointers
+ *        that follow in order of the format's (assigning) conversions.
+ * @note Whatever follows the part of str the format matched is ignored.
+ * @param[in] plan : from NParsyCompileFormat
+ * @param[in] str : string to parse through
+ * @param[out] num_assigned : [Optional] How many conversions were assigned,
+ *                            which on failure tells how far the match got.
+ * @return enum NParsyResult - library result type
+ *         NParsy_FormatMismatch if str stops matching the format;
+ *         NParsy_NumberOutOfRange if a number doesn't fit its conversion.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyScan(
+      const struct NParsyScanPlan * plan,
+      const char * str,
+      size_t * num_assigned,
+      ... );
+
+/**
+ * @brief NParsyScan, with the pointers to assign through in a va_list.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyVScan(
+      const struct NParsyScanPlan * plan,
+      const char * str,
+      size_t * num_assigned,
+      va_list args );
+
+/**
+ * @brief Release a plan from NParsyCompileFormat.
+ * @param[in] plan : plan to release. nullptr is fine.
+ */
+void NParsyFreeFormat(struct NParsyScanPlan * plan);
+
+#endif // NPARSY_SCAN_H_
@@ -0,0 +1,185 @@
+/**
+ * @file nparsy_stream.h
+ * @brief API for parsing unsigned integers out of streams (pipes, sockets, ...).
+ * @note POSIX only.
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef NPARSY_STREAM_H_
+#define NPARSY_STREAM_H_
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+#include "nparsy_types.h"
+#include "nparsy_constants.h"
+
+/* Definitions */
+constexpr size_t NPARSY_STREAM_DEFAULT_CHUNK_LEN = 64u * 1024u;
+
+// A number split across chunks is carried over to the next chunk. Anything
+// longer than this (e.g., hundreds of leading zeros) is skipped as out-of-range.
+constexpr size_t NPARSY_STREAM_CARRY_LEN = 256u;
+
+/**
+ * @brief Receives a batch of parsed values.
+ * @param[in] vals : values parsed, in stream order. Only valid during the call.
+ * @param[in] n : how many values are in vals (at least 1)
+ * @param[in] ctx : whatever was passed alongside the sink
+ * @return true to keep parsing, false to stop early
+ */
+typedef bool (*NParsyUIntSink)(const uint64_t * vals, size_t n, void * ctx);
+
+/**
+ * @brief Parse out all unsigned integers read from fd until end-of-stream.
+ * @note fd is read into two alternating chunk_len buffers: one chunk is parsed
+ *       while the next read is in flight on a helper thread, so memory stays
+ *       at two buffers however long the stream is.
+ * @note Digits, prefixes, and suffixes split across reads are stitched back
+ *       together (see NPARSY_STREAM_CARRY_LEN).
+ * @note Numbers that need more than 64 bits are skipped, just like NParsyUIntList.
+ * @param[in] fd : file descriptor to read from (pipe, socket, file, ...). Left open.
+ * @param[in] chunk_len : size of each of the two read buffers. 0 picks NPARSY_STREAM_DEFAULT_CHUNK_LEN.
+ * @param[in] sink : called with batches of parsed values
+ * @param[in] ctx : [Optional] passed through to sink
+ * @param[out] num_parsed : [Optional] How many values were handed to sink
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ *         NParsy_FileAccessFailed if a read failed (values before it were still delivered).
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntStreamFd(
+      int fd,
+      size_t chunk_len,
+      NParsyUIntSink sink,
+      void * ctx,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+// In-progress parse of a stream fed in pieces. See NParsyUIntStreamBegin.
+struct NParsyUIntStream;
+
+/**
+ * @brief Start parsing a stream that the caller feeds in pieces.
+ * @note This lifts the NPARSY_MAX_PARSABLE_STRING_LEN limit from the input as
+ *       a whole: it only applies to each piece fed with NParsyUIntStreamFeedStr,
+ *       and not at all to pieces of caller-declared length. One parse can then
+ *       cover gigabytes without the caller pre-splitting it, and numbers split
+ *       across pieces are stitched back together (see NPARSY_STREAM_CARRY_LEN).
+ * @note Values are delivered to sink as they're parsed. Every stream begun must
+ *       be ended with NParsyUIntStreamEnd.
+ * @param[out] stream : set to the new stream
+ * @param[in] sink : called with batches of parsed values
+ * @param[in] ctx : [Optional] passed through to sink
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntStreamBegin(
+      struct NParsyUIntStream ** stream,
+      NParsyUIntSink sink,
+      void * ctx,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief Parse the next piece of the stream.
+ * @note Once sink has asked to stop, further pieces are ignored.
+ * @param[in] stream : from NParsyUIntStreamBegin
+ * @param[in] chunk : next piece of the stream; nulls in it are just more chars
+ * @param[in] len : length of chunk - no limit applies
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntStreamFeed(
+      struct NParsyUIntStream * stream,
+      const char * chunk,
+      size_t len );
+
+/**
+ * @brief Parse the next piece of the stream, given as a null-terminated string.
+ * @param[in] stream : from NParsyUIntStreamBegin
+ * @param[in] str : next piece of the stream, at most NPARSY_MAX_PARSABLE_STRING_LEN long
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntStreamFeedStr(
+      struct NParsyUIntStream * stream,
+      const char * str );
+
+/**
+ * @brief End of stream: parse whatever number the last piece ended in, and
+ *        release the stream.
+ * @param[in] stream : from NParsyUIntStreamBegin. Invalid after this call.
+ * @param[out] num_parsed : [Optional] How many values were handed to sink in all
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntStreamEnd(
+      struct NParsyUIntStream * stream,
+      size_t * num_parsed );
+
+// Incremental parse of a file that keeps growing, e.g. an append-only log.
+// See NParsyUIntTailBegin.
+struct NParsyUIntTail;
+
+/**
+ * @brief Start following a growing file.
+ * @note Each NParsyUIntTailPoll only reads what was appended since the last
+ *       one, so polling a log every second doesn't re-parse it from the start.
+ * @note Every tail begun must be ended with NParsyUIntTailEnd.
+ * @param[out] tail : set to the new tail
+ * @param[in] fd : regular file to follow. Left open, and must stay open until NParsyUIntTailEnd.
+ * @param[in] start : offset to start parsing from, e.g. the resume_offset of
+ *                    an earlier tail on the same file, or 0.
+ * @param[in] sink : called with batches of parsed values
+ * @param[in] ctx : [Optional] passed through to sink
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntTailBegin(
+      struct NParsyUIntTail ** tail,
+      int fd,
+      off_t start,
+      NParsyUIntSink sink,
+      void * ctx,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief Parse whatever was appended to the file since the last poll, and
+ *        hand just the new values to sink.
+ * @note A number the file currently ends in may still be being written, so
+ *       it's held back until more is appended (or NParsyUIntTailEnd).
+ * @note If the file shrank below what was already parsed (truncated or
+ *       rotated in place), parsing starts over from offset 0.
+ * @param[in] tail : from NParsyUIntTailBegin
+ * @param[out] num_new : [Optional] How many values were handed to sink by this poll
+ * @param[out] resume_offset : [Optional] Offset everything before which has
+ *                             been fully parsed - pass it as start to a later
+ *                             tail to carry on where this one left off.
+ * @return enum NParsyResult - library result type
+ *         NParsy_FileAccessFailed if fstat or a read failed (values before it were still delivered).
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntTailPoll(
+      struct NParsyUIntTail * tail,
+      size_t * num_new,
+      off_t * resume_offset );
+
+/**
+ * @brief Stop following the file: parse whatever number it ended in, and
+ *        release the tail.
+ * @param[in] tail : from NParsyUIntTailBegin. Invalid after this call.
+ * @param[out] num_parsed : [Optional] How many values were handed to sink in all
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntTailEnd(
+      struct NParsyUIntTail * tail,
+      size_t * num_parsed );
+
+#endif // NPARSY_STREAM_H_
@@ -12,14 +12,72 @@
 /* Definitions */
 constexpr size_t NPARSY_MAX_ERR_MSG_LEN = 250u;
 
+#ifdef __SIZEOF_INT128__
+// 128-bit unsigned integer, where the compiler provides one. __extension__
+// keeps -pedantic-errors quiet about the non-ISO type.
+__extension__ typedef unsigned __int128 nparsy_u128_t;
+#endif
+
 enum NParsyNumFormat
 {
    NParsy_Dec,
    NParsy_Hex,
    NParsy_Bin,
+   NParsy_Oct,
    NParsy_NumOfFmts
 };
 
+// Digit separators that may sit between two digits of a number (C23 and C++14
+// write 1'000'000; many config formats write 1_000_000). OR them together.
+enum NParsyDigitSep
+{
+   NParsy_NoSep         = 0,
+   NParsy_SepApostrophe = 1 << 0,
+   NParsy_SepUnderscore = 1 << 1,
+   NParsy_AllSeps       = NParsy_SepApostrophe | NParsy_SepUnderscore
+};
+
+// Thousands separators for grouped decimal numbers like 1,234,567. A number
+// then runs on through every separator that's followed by exactly three digits.
+enum NParsyGroupSep
+{
+   NParsy_NoGrouping,
+   NParsy_GroupComma,      // 1,234,567
+   NParsy_GroupPeriod,     // 1.234.567
+   NParsy_GroupSpace,      // 1 234 567
+   NParsy_GroupThinSpace,  // U+2009 THIN SPACE, as UTF-8 (E2 80 89)
+   NParsy_NumOfGroupSeps
+};
+
+// Magnitude suffixes that may follow a decimal number (e.g., 250k, 512Ki, 4G):
+// SI powers of 1000, then IEC powers of 1024, in the same order
+enum NParsyUnit
+{
+   NParsy_NoUnit,
+   NParsy_Kilo,   // k or K
+   NParsy_Mega,   // M
+   NParsy_Giga,   // G
+   NParsy_Tera,   // T
+   NParsy_Peta,   // P
+   NParsy_Exa,    // E
+   NParsy_Kibi,   // Ki or ki
+   NParsy_Mebi,   // Mi
+   NParsy_Gibi,   // Gi
+   NParsy_Tebi,   // Ti
+   NParsy_Pebi,   // Pi
+   NParsy_Exbi,   // Ei
+   NParsy_NumOfUnits
+};
+
+// What to do with fractional digits beyond the requested fixed-point scale
+enum NParsyRoundingPolicy
+{
+   NParsy_Truncate,              // 1.2349 @ scale 3 -> 1234
+   NParsy_RoundHalfAwayFromZero, // 1.2345 @ scale 3 -> 1235, -1.2345 -> -1235
+   NParsy_RoundHalfEven,         // 1.2345 @ scale 3 -> 1234, 1.2355 -> 1236
+   NParsy_NumOfRoundingPolicies
+};
+
 #define NPARSY_RESULT(enum, msg) NParsy_##enum,
 // All possible result types from the nparsy API
 enum NParsyResult
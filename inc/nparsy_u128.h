@@ -0,0 +1,63 @@
+/**
+ * @file nparsy_u128.h
+ * @brief API for parsing 128-bit unsigned integers out of a string.
+ * @note Only available where the compiler provides unsigned __int128.
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef NPARSY_U128_H_
+#define NPARSY_U128_H_
+
+/* File Inclusions */
+#include <stdint.h>
+
+#include "nparsy_types.h"
+#include "nparsy_constants.h"
+
+#ifdef __SIZEOF_INT128__
+
+/**
+ * @brief Parse out the first unsigned integer occurrence as a 128-bit value.
+ * @note Integers may be decimal, hex, binary, or octal - see README.md.
+ * @note Can be repeatedly called by making use of the accumulated_strlen param
+ * @param[in] str : string to parse through
+ * @param[out] parsed_val : where the parse result is placed, if one is found; otherwise, nothing is done.
+ * @param[out] accumulated_strlen : [Optional] How many chars were passed-through, including the number found.
+ *                                             If nullptr, nothing happens.
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult : nparsy library result type
+ *         NParsy_NumberOutOfRange if the first number found needs more than 128 bits
+ *         (accumulated_strlen still moves past it so the caller may carry on).
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU128(
+      const char * str,
+      nparsy_u128_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief Parse out any unsigned integers found as 128-bit values until a limit is hit (see below).
+ * @note Limits include the len of the buf passed in, the null terminator,
+ *       and NPARSY_MAX_PARSABLE_STRING_LEN characters reached.
+ * @note Numbers that need more than 128 bits are skipped.
+ * @param[in] str : string to parse through
+ * @param[out] buf : where the parse results are placed, if found; otherwise, nothing is done.
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU128List(
+      const char * str,
+      nparsy_u128_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+#endif // __SIZEOF_INT128__
+
+#endif // NPARSY_U128_H_
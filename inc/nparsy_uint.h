@@ -6,6 +6,9 @@
  * @copyright MIT License
  */
 
+#ifndef NPARSY_UINT_H_
+#define NPARSY_UINT_H_
+
 /* File Inclusions */
 #include <stdint.h>
 
@@ -16,7 +19,8 @@
  * @brief Parse out the first unsigned integer occurrence.
  * @note Integers may be decimal, hex, or binary - see README.md.
  * @note Can be repeatedly called by making use of the accumulated_strlen param
- * @note Up to 64-bit unsigned integers are parsable. Larger integers are skipped.
+ * @note Up to 64-bit unsigned integers are parsable. Larger integers give
+ *       NParsy_NumberOutOfRange (accumulated_strlen still moves past them).
  * @param[in] str : string to parse through
  * @param[out] parsed_val : where the parse result is placed, if one is found; otherwise, nothing is done.
  * @param[out] accumulated_strlen : [Optional] How many chars were passed-through before result was obtained
@@ -40,7 +44,430 @@ enum NParsyResult NParsyUInt(
  * @param[in] str : string to parse through
  * @param[out] buf : where the parse results are placed, if found; otherwise, nothing is done.
  * @param[in] len : length of buf
+ * @note Bare numbers are taken as decimal. See NParsyU64List for control over
+ *       that and for how many results were found.
  * @return enum NParsyResult - library result type
  */
 [[nodiscard]]
 enum NParsyResult NParsyUIntList(const char * str, uint64_t * buf, size_t len);
+
+/**
+ * @brief Width-specialized forms of NParsyUInt.
+ * @note Each width has its own digit-count limits per format (e.g., uint8_t
+ *       allows at most 3 dec, 2 hex, 8 bin, or 3 oct significant digits), so a
+ *       number that can't fit is rejected before any conversion work is done.
+ * @note Same parameters as NParsyUInt, with a narrower parsed_val.
+ * @return enum NParsyResult : nparsy library result type
+ *         NParsy_NumberOutOfRange if the first number found doesn't fit the width
+ *         (accumulated_strlen still moves past it so the caller may carry on).
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU8(
+      const char * str,
+      uint8_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt );
+
+[[nodiscard]]
+enum NParsyResult NParsyU16(
+      const char * str,
+      uint16_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt );
+
+[[nodiscard]]
+enum NParsyResult NParsyU32(
+      const char * str,
+      uint32_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief Width-specialized forms of NParsyUIntList writing narrow arrays.
+ * @note Numbers that don't fit the width are skipped.
+ * @param[in] str : string to parse through
+ * @param[out] buf : where the parse results are placed, if found; otherwise, nothing is done.
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU8List(
+      const char * str,
+      uint8_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+[[nodiscard]]
+enum NParsyResult NParsyU16List(
+      const char * str,
+      uint16_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+[[nodiscard]]
+enum NParsyResult NParsyU32List(
+      const char * str,
+      uint32_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+[[nodiscard]]
+enum NParsyResult NParsyU64List(
+      const char * str,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief Lenient forms of NParsyUInt and NParsyU64List, for hot loops over
+ *        input that's known to be well-formed.
+ * @note The prefix/suffix consistency checks are compiled out rather than
+ *       skipped at run time: a number is just its prefix (if any) and its
+ *       run of digits in the format. So 0x1Fh is 0x1F, and under
+ *       NParsy_Dec, 12ab is 12 where the strict forms would skip it.
+ *       Numbers that don't fit are still out of range.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntLenient(
+      const char * str,
+      uint64_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt );
+
+[[nodiscard]]
+enum NParsyResult NParsyU64ListLenient(
+      const char * str,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+// How many values NParsyU64ListAdaptive parses the general way before
+// picking a kernel for the rest of the string
+constexpr size_t NPARSY_ADAPTIVE_SAMPLE_LEN = 16u;
+
+/**
+ * @brief NParsyU64List for strings where one number format dominates (e.g.,
+ *        all 0x-prefixed hex, or all bare decimal).
+ * @note The first NPARSY_ADAPTIVE_SAMPLE_LEN values are parsed the general
+ *       way. If at least 3/4 of them share one of these shapes, the rest of
+ *       the string is parsed with a kernel specialized for it:
+ *          - bare decimal, under the dec default
+ *          - 0x/0X-prefixed hex, under any default
+ *          - bare hex, under the hex default
+ *       Any number the kernel can't vouch for (another format, a suffix, a
+ *       sign, a fraction, ...) drops back to the general path, so the results
+ *       are always exactly those of NParsyU64List.
+ * @param[in] str : string to parse through
+ * @param[out] buf : where the parse results are placed
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU64ListAdaptive(
+      const char * str,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief NParsyUInt that also accepts digit separators inside numbers, in
+ *        every format: 1'000'000, 0xFFFF_FFFF, 0b1010'1010, 7FF_FFh, ...
+ * @note A separator only counts when it sits between two digits. Anywhere
+ *       else (leading, trailing, doubled, right after a prefix) it ends the
+ *       number like any other non-digit: "1__2" is 1 and then 2.
+ * @param[in] str : string to parse through
+ * @param[out] parsed_val : where the parse result is placed, if one is found; otherwise, nothing is done.
+ * @param[out] accumulated_strlen : [Optional] How many chars were passed-through before result was obtained
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @param[in] seps : enum NParsyDigitSep flags, OR'd together
+ * @return enum NParsyResult - library result type
+ *         NParsy_InvalidDigitSeparators if seps has flags that aren't defined.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntSep(
+      const char * str,
+      uint64_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt,
+      unsigned seps );
+
+/**
+ * @brief NParsyU64List that also accepts digit separators (see NParsyUIntSep).
+ * @param[in] str : string to parse through
+ * @param[out] buf : where the parse results are placed
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @param[in] seps : enum NParsyDigitSep flags, OR'd together
+ * @return enum NParsyResult - library result type
+ *         NParsy_InvalidDigitSeparators if seps has flags that aren't defined.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU64ListSep(
+      const char * str,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt,
+      unsigned seps );
+
+/**
+ * @brief NParsyUInt that also takes a magnitude suffix right after a decimal
+ *        number and scales the value by it: 250k is 250'000, 512Ki is
+ *        524'288, 4G is 4'000'000'000.
+ * @note SI suffixes are k (or K), M, G, T, P, and E; an 'i' after one makes
+ *       it the IEC power of 1024 (Ki, Mi, ...). The suffix must end the word,
+ *       so "4Gb" is just 4. Numbers with a prefix or a format suffix (0x10,
+ *       10h, 10d) take no unit.
+ * @param[in] str : string to parse through
+ * @param[out] parsed_val : where the parse result is placed, if one is found; otherwise, nothing is done.
+ * @param[out] accumulated_strlen : [Optional] How many chars were passed-through before result was obtained
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @param[out] unit : which suffix was applied, or NParsy_NoUnit
+ * @return enum NParsyResult - library result type
+ *         NParsy_NumberOutOfRange if the scaled value doesn't fit in 64 bits.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntUnit(
+      const char * str,
+      uint64_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt,
+      enum NParsyUnit * unit );
+
+/**
+ * @brief NParsyU64List that also applies magnitude suffixes (see NParsyUIntUnit).
+ * @note Values that overflow once scaled are skipped, like any other
+ *       out-of-range number.
+ * @param[in] str : string to parse through
+ * @param[out] buf : where the parse results are placed
+ * @param[out] units : [Optional] the unit of each value in buf, of length len
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU64ListUnit(
+      const char * str,
+      uint64_t * buf,
+      enum NParsyUnit * units,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief NParsyUInt for human-formatted decimal numbers with thousands
+ *        separators, like 1,234,567 or 1 234 567.
+ * @note The first group has 1 to 3 digits and every later one exactly 3, so
+ *       "1,23" is 1 and then 23, and "1234,567" is 1234 and then 567.
+ *       Grouping is checked with a SWAR pass over the bytes, with no locale
+ *       or ctype involved.
+ * @note Bare numbers are read as decimal; prefixed ones (0x1F, ...) as usual.
+ * @param[in] str : string to parse through
+ * @param[out] parsed_val : where the parse result is placed, if one is found; otherwise, nothing is done.
+ * @param[out] accumulated_strlen : [Optional] How many chars were passed-through before result was obtained
+ * @param[in] group : the thousands separator
+ * @return enum NParsyResult - library result type
+ *         NParsy_InvalidGroupSeparator if group isn't one of enum NParsyGroupSep.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntGrouped(
+      const char * str,
+      uint64_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyGroupSep group );
+
+/**
+ * @brief NParsyU64List for decimal numbers with thousands separators (see
+ *        NParsyUIntGrouped). "1,234,567, 89" is 1234567 and 89.
+ * @param[in] str : string to parse through
+ * @param[out] buf : where the parse results are placed
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] group : the thousands separator
+ * @return enum NParsyResult - library result type
+ *         NParsy_InvalidGroupSeparator if group isn't one of enum NParsyGroupSep.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU64ListGrouped(
+      const char * str,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyGroupSep group );
+
+// A custom prefix or suffix char, and the format of the numbers it marks
+struct NParsyAffix
+{
+   char ch;
+   enum NParsyNumFormat fmt;
+};
+
+// Custom number syntax. See NParsyCompileSyntax.
+struct NParsySyntax;
+
+/**
+ * @brief Register custom prefixes and suffixes (e.g., '$' and '#' for hex and
+ *        '%' for binary, as in assembler listings, or a 'q' suffix for octal)
+ *        on top of the built-in ones, for NParsyUIntSyntax and
+ *        NParsyU64ListSyntax.
+ * @note The affixes are compiled into per-char lookup tables, so parsing with
+ *       them costs a table lookup where the built-in ones cost a compare.
+ * @note A prefix only counts at the start of a word and right before a digit
+ *       of its format ("$1F"). A suffix ends the word ("17q"); under strict
+ *       parsing, every digit before it must belong to its format.
+ * @param[in] prefixes : [Optional if nprefixes is 0] custom prefixes
+ * @param[in] nprefixes : how many prefixes there are
+ * @param[in] suffixes : [Optional if nsuffixes is 0] custom suffixes
+ * @param[in] nsuffixes : how many suffixes there are
+ * @param[out] syntax : set to the compiled syntax. Release with NParsyFreeSyntax.
+ * @return enum NParsyResult - library result type
+ *         NParsy_InvalidSyntax if an affix is a digit, a hex letter, '-', '.',
+ *         one of the built-in x/X/h/H, has an invalid format, or is listed
+ *         twice in the same list.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyCompileSyntax(
+      const struct NParsyAffix * prefixes,
+      size_t nprefixes,
+      const struct NParsyAffix * suffixes,
+      size_t nsuffixes,
+      struct NParsySyntax ** syntax );
+
+/**
+ * @brief Release a syntax from NParsyCompileSyntax.
+ * @param[in] syntax : syntax to release. nullptr is fine.
+ */
+void NParsyFreeSyntax(struct NParsySyntax * syntax);
+
+/**
+ * @brief NParsyUInt that also takes the custom prefixes and suffixes of syntax.
+ * @param[in] syntax : from NParsyCompileSyntax
+ * @param[in] str : string to parse through
+ * @param[out] parsed_val : where the parse result is placed, if one is found; otherwise, nothing is done.
+ * @param[out] accumulated_strlen : [Optional] How many chars were passed-through before result was obtained
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyUIntSyntax(
+      const struct NParsySyntax * syntax,
+      const char * str,
+      uint64_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief NParsyU64List that also takes the custom prefixes and suffixes of syntax.
+ * @param[in] syntax : from NParsyCompileSyntax
+ * @param[in] str : string to parse through
+ * @param[out] buf : where the parse results are placed
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU64ListSyntax(
+      const struct NParsySyntax * syntax,
+      const char * str,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+// Where each line of a parsed string starts and how many values it held,
+// recorded by NParsyU64ListLines. The caller provides both arrays.
+struct NParsyLineIndex
+{
+   size_t * line_starts; // offset of each line's first char within the string
+   size_t * line_counts; // how many values were placed in buf from each line
+   size_t cap;           // length of line_starts and line_counts
+   size_t num_lines;     // [out] how many lines were recorded
+};
+
+/**
+ * @brief NParsyU64List that also records, in the same pass, the start of
+ *        every line and how many values came from it.
+ * @note Line i's values are buf[k] for k from line_counts[0] + ... +
+ *       line_counts[i-1], line_counts[i] of them.
+ * @note A '\n' right at the end of str doesn't start another line.
+ * @note Parsing stops early, and lines stop being recorded, once buf or the
+ *       index is full. When buf filled up, the last line recorded may have
+ *       more values past the ones counted.
+ * @param[in] str : string to parse through
+ * @param[out] buf : where the parse results are placed
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @param[in,out] index : line_starts, line_counts, and cap in; num_lines out
+ * @return enum NParsyResult - library result type
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU64ListLines(
+      const char * str,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt,
+      struct NParsyLineIndex * index );
+
+/**
+ * @brief Re-parse just some of the lines recorded by NParsyU64ListLines,
+ *        starting right at the first one's offset.
+ * @param[in] str : the same string that was indexed
+ * @param[in] index : from NParsyU64ListLines on str
+ * @param[in] first_line : first line to parse
+ * @param[in] num_lines : how many lines to parse
+ * @param[out] buf : where the parse results are placed
+ * @param[in] len : length of buf
+ * @param[out] num_parsed : [Optional] How many results were placed in buf
+ * @param[in] default_fmt : Assume bare numbers like 10 (which could be dec, hex, bin, or oct) are of this format.
+ * @return enum NParsyResult - library result type
+ *         NParsy_InvalidLineRange if the lines asked for weren't all recorded.
+ */
+[[nodiscard]]
+enum NParsyResult NParsyU64ListLineRange(
+      const char * str,
+      const struct NParsyLineIndex * index,
+      size_t first_line,
+      size_t num_lines,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt );
+
+/**
+ * @brief Pick the width-specialized parser from the type of parsed_val.
+ * @note For example:
+ *          uint16_t port;
+ *          enum NParsyResult res = NParsyUIntOf( "port 8080", &port, nullptr, NParsy_Dec );
+ */
+#define NParsyUIntOf(str, parsed_val, accumulated_strlen, default_fmt) \
+   _Generic( (parsed_val),                                              \
+             uint8_t *  : NParsyU8,                                     \
+             uint16_t * : NParsyU16,                                    \
+             uint32_t * : NParsyU32,                                    \
+             uint64_t * : NParsyUInt )                                  \
+   ( (str), (parsed_val), (accumulated_strlen), (default_fmt) )
+
+#define NParsyUIntListOf(str, buf, len, num_parsed, default_fmt) \
+   _Generic( (buf),                                               \
+             uint8_t *  : NParsyU8List,                           \
+             uint16_t * : NParsyU16List,                          \
+             uint32_t * : NParsyU32List,                          \
+             uint64_t * : NParsyU64List )                         \
+   ( (str), (buf), (len), (num_parsed), (default_fmt) )
+
+#endif // NPARSY_UINT_H_
@@ -0,0 +1,239 @@
+# Compile every regex in lin_pid_supported_formats.h into one minimized DFA and
+# write it out as C tables, so classifying an ID is a single pass over the
+# string instead of one regex match per LIN_PID_NUMERIC_FORMAT entry.
+#
+# Usage: python gen_lin_pid_dfa.py <lin_pid_supported_formats.h> <out.h>
+#
+# Only the regex subset the format list uses is supported: a leading ^, a
+# trailing $, literal chars, [...] classes with ranges, and the ? quantifier.
+# Anything else is an error, so a new format can't silently be mis-compiled.
+
+import re
+import sys
+
+ENTRY_RE = re.compile(r'^\s*LIN_PID_NUMERIC_FORMAT\(\s*(\w+)\s*,\s*"([^"]*)"')
+
+def read_formats(path):
+    formats = []
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            m = ENTRY_RE.match(line)
+            if m:
+                formats.append((m.group(1), m.group(2)))
+    if not formats:
+        sys.exit(f'{path}: no LIN_PID_NUMERIC_FORMAT entries found')
+    if len(formats) > 64:
+        sys.exit(f'{path}: {len(formats)} formats won\'t fit a 64-bit match mask')
+    return formats
+
+# Regex -> list of (charset, optional) items, matched in sequence
+def parse_regex(name, rx):
+    if not (rx.startswith('^') and rx.endswith('$')):
+        sys.exit(f'{name}: regex "{rx}" must be anchored with ^ and $')
+    body = rx[1:-1]
+    items = []
+    i = 0
+    while i < len(body):
+        c = body[i]
+        if c == '[':
+            close = body.find(']', i + 1)
+            if close < 0:
+                sys.exit(f'{name}: unterminated [ in "{rx}"')
+            spec = body[i + 1:close]
+            chars = set()
+            j = 0
+            while j < len(spec):
+                if (j + 2 < len(spec)) and (spec[j + 1] == '-'):
+                    chars.update(range(ord(spec[j]), ord(spec[j + 2]) + 1))
+                    j += 3
+                else:
+                    chars.add(ord(spec[j]))
+                    j += 1
+            items.append([frozenset(chars), False])
+            i = close + 1
+        elif c == '?':
+            if not items:
+                sys.exit(f'{name}: dangling ? in "{rx}"')
+            items[-1][1] = True
+            i += 1
+        elif c in '^$.*+()|{}\\':
+            sys.exit(f'{name}: unsupported regex syntax "{c}" in "{rx}"')
+        else:
+            items.append([frozenset([ord(c)]), False])
+            i += 1
+    return [(cs, opt) for cs, opt in items]
+
+# Positions past any run of optional items (the epsilon closure of one regex)
+def closure(items, pos):
+    out = {pos}
+    while (pos < len(items)) and items[pos][1]:
+        pos += 1
+        out.add(pos)
+    return out
+
+# Split the 256 byte values into classes that every charset treats alike
+def char_classes(all_items):
+    charsets = sorted({cs for items in all_items for cs, _ in items}, key=sorted)
+    sig_to_class = {}
+    byte_class = []
+    for b in range(256):
+        sig = tuple(b in cs for cs in charsets)
+        byte_class.append(sig_to_class.setdefault(sig, len(sig_to_class)))
+    reps = [byte_class.index(k) for k in range(len(sig_to_class))]
+    return byte_class, reps
+
+def build_dfa(all_items, reps):
+    def accepts(state):
+        mask = 0
+        for fmt, pos in state:
+            if pos == len(all_items[fmt]):
+                mask |= 1 << fmt
+        return mask
+
+    dead = frozenset()
+    start = frozenset((fmt, p) for fmt, items in enumerate(all_items)
+                      for p in closure(items, 0))
+    states = [dead, start]
+    index = {dead: 0, start: 1}
+    trans = []
+    k = 0
+    while k < len(states):
+        row = []
+        for b in reps:
+            nxt = set()
+            for fmt, pos in states[k]:
+                items = all_items[fmt]
+                if (pos < len(items)) and (b in items[pos][0]):
+                    nxt.update((fmt, p) for p in closure(items, pos + 1))
+            nxt = frozenset(nxt)
+            if nxt not in index:
+                index[nxt] = len(states)
+                states.append(nxt)
+            row.append(index[nxt])
+        trans.append(row)
+        k += 1
+    return trans, [accepts(s) for s in states]
+
+# Moore partition refinement, starting from "same set of formats accepted"
+def minimize(trans, acc):
+    block = {}
+    part = [block.setdefault(a, len(block)) for a in acc]
+    while True:
+        sigs = {}
+        new_part = [sigs.setdefault((part[s], tuple(part[t] for t in trans[s])), len(sigs))
+                    for s in range(len(trans))]
+        if len(sigs) == len(set(part)):
+            break
+        part = new_part
+
+    # Renumber so the dead state stays 0 and the start state stays 1
+    order = []
+    for s in range(len(trans)):
+        if part[s] not in order:
+            order.append(part[s])
+    renum = {blk: i for i, blk in enumerate(order)}
+    n = len(order)
+    min_trans = [None] * n
+    min_acc = [0] * n
+    for s in range(len(trans)):
+        i = renum[part[s]]
+        min_trans[i] = [renum[part[t]] for t in trans[s]]
+        min_acc[i] = acc[s]
+    assert (renum[part[0]] == 0) and (renum[part[1]] == 1)
+    return min_trans, min_acc
+
+def c_rows(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('   ' + ', '.join(fmt(v) for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+def emit(out_path, src_name, formats, byte_class, trans, acc):
+    nstates = len(trans)
+    nclasses = len(trans[0])
+    if nstates > 256:
+        sys.exit(f'{nstates} DFA states won\'t fit the uint8_t transition table')
+
+    names = '\n'.join(f' *    bit {i:2}: {name}' for i, (name, _) in enumerate(formats))
+    next_rows = '\n'.join('   { ' + ', '.join(f'{t:3}' for t in row) + ' },' for row in trans)
+
+    text = f'''/**
+ * @file lin_pid_formats_dfa.h
+ * @brief Minimized DFA over every regex in {src_name}.
+ *
+ * @note GENERATED by scripts/gen_lin_pid_dfa.py - do not edit. Edit
+ *       {src_name} and rebuild instead.
+ *
+ * @note Each accepting state's mask has bit i set when the string is matched
+ *       by the i-th LIN_PID_NUMERIC_FORMAT entry (i.e., bit NumericFormat_E):
+{names}
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @copyright MIT License
+ */
+
+#ifndef LIN_PID_FORMATS_DFA_H_
+#define LIN_PID_FORMATS_DFA_H_
+
+/* File Inclusions */
+#include <stdint.h>
+
+/* Definitions */
+#define LIN_PID_DFA_NUM_FORMATS   {len(formats)}
+#define LIN_PID_DFA_NUM_STATES    {nstates}
+#define LIN_PID_DFA_NUM_CLASSES   {nclasses}
+#define LIN_PID_DFA_DEAD_STATE    0
+#define LIN_PID_DFA_START_STATE   1
+
+// Byte -> character class. Bytes every regex treats alike share a class.
+static const uint8_t LIN_PID_DFA_CHAR_CLASS[256] =
+{{
+{c_rows(byte_class, 16, lambda v: f'{v:2}')}
+}};
+
+// [state][character class] -> next state
+static const uint8_t LIN_PID_DFA_NEXT[LIN_PID_DFA_NUM_STATES][LIN_PID_DFA_NUM_CLASSES] =
+{{
+{next_rows}
+}};
+
+// State -> mask of the formats matched if the string ends there
+static const uint64_t LIN_PID_DFA_ACCEPTS[LIN_PID_DFA_NUM_STATES] =
+{{
+{c_rows(acc, 4, lambda v: f'0x{v:016X}u')}
+}};
+
+/**
+ * @brief Find every LIN_PID_NUMERIC_FORMAT the whole of str matches, in one pass.
+ * @param[in] str : NUL-terminated string to classify
+ * @return Mask with bit i set for each i-th format matched; 0 if none.
+ */
+static inline uint64_t LinPID_FormatsMatching( const char * str )
+{{
+   uint8_t state = LIN_PID_DFA_START_STATE;
+   for ( ; (*str != '\\0') && (state != LIN_PID_DFA_DEAD_STATE); str++ )
+   {{
+      state = LIN_PID_DFA_NEXT[state][ LIN_PID_DFA_CHAR_CLASS[(uint8_t)*str] ];
+   }}
+
+   return (*str == '\\0') ? LIN_PID_DFA_ACCEPTS[state] : 0u;
+}}
+
+#endif // LIN_PID_FORMATS_DFA_H_
+'''
+    with open(out_path, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(text)
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: gen_lin_pid_dfa.py <lin_pid_supported_formats.h> <out.h>')
+    src, out = sys.argv[1], sys.argv[2]
+    formats = read_formats(src)
+    all_items = [parse_regex(name, rx) for name, rx in formats]
+    byte_class, reps = char_classes(all_items)
+    trans, acc = build_dfa(all_items, reps)
+    trans, acc = minimize(trans, acc)
+    emit(out, src.replace('\\', '/').split('/')[-1], formats, byte_class, trans, acc)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,109 @@
+/*!
+ * @file    lin_pid_formats.c
+ * @brief   Single-pass classification of LIN ID entries into their
+ *          LIN_PID_NUMERIC_FORMAT.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "lin_pid_formats.h"
+#include "lin_pid_formats_dfa.h"
+
+/* Local Macro Definitions */
+
+/* Local Data */
+
+static_assert( NUM_OF_NUMERIC_FORMATS == LIN_PID_DFA_NUM_FORMATS,
+               "lin_pid_formats_dfa.h is stale - regenerate it from lin_pid_supported_formats.h" );
+
+// Masks of the formats flagged IsHex / IsDec, bit i for the i-th format
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd ) \
+   | ((ish) ? (1ull << (enum)) : 0ull)
+static const uint64_t HexFormats = 0ull
+   #include "lin_pid_supported_formats.h"
+   ;
+#undef LIN_PID_NUMERIC_FORMAT
+
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd ) \
+   | ((isd) ? (1ull << (enum)) : 0ull)
+static const uint64_t DecFormats = 0ull
+   #include "lin_pid_supported_formats.h"
+   ;
+#undef LIN_PID_NUMERIC_FORMAT
+
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd ) \
+   prnt_fmt,
+static const char * const PrintFormats[NUM_OF_NUMERIC_FORMATS] =
+{
+   #include "lin_pid_supported_formats.h"
+};
+#undef LIN_PID_NUMERIC_FORMAT
+
+/* Public Function Implementations */
+
+/******************************************************************************/
+[[nodiscard]]
+enum NumericFormat_E LinPID_ParseFormattedID( const char * str,
+                                              bool ishex,
+                                              bool isdec,
+                                              uint16_t * val )
+{
+   assert( (str != nullptr) && (!ishex || !isdec) );
+
+   // Run the DFA and, in the same loop, accumulate the value both ways. The
+   // base isn't known until the end (12 vs 12d), but the prefix/suffix chars
+   // can never count as digits of the base they go with: x/X/h/H aren't hex
+   // digits, and d/D aren't dec digits. So each accumulator just skips the
+   // chars that aren't its digits. Matches are at most 4 chars, and the DFA
+   // dies before anything longer, so neither accumulator can overflow.
+   uint_fast8_t state = LIN_PID_DFA_START_STATE;
+   uint32_t hexval = 0;
+   uint32_t decval = 0;
+   const char * p = str;
+   for ( ; (*p != '\0') && (state != LIN_PID_DFA_DEAD_STATE); p++ )
+   {
+      const unsigned char c = (unsigned char)*p;
+      state = LIN_PID_DFA_NEXT[state][ LIN_PID_DFA_CHAR_CLASS[c] ];
+
+      if ( (c >= '0') && (c <= '9') )
+      {
+         hexval = (hexval << 4) | (uint32_t)(c - '0');
+         decval = (decval * 10u) + (uint32_t)(c - '0');
+      }
+      else if ( ((c | 0x20u) >= 'a') && ((c | 0x20u) <= 'f') )
+      {
+         hexval = (hexval << 4) | (uint32_t)((c | 0x20u) - 'a' + 10u);
+      }
+   }
+
+   uint64_t matches = (*p == '\0') ? LIN_PID_DFA_ACCEPTS[state] : 0u;
+   if ( isdec )
+      matches &= DecFormats;
+   else if ( ishex || ((matches & HexFormats) != 0u) )
+      matches &= HexFormats;
+
+   if ( matches == 0u )
+      return INVALID_NUMERIC_FORMAT;
+
+   const enum NumericFormat_E fmt = (enum NumericFormat_E)__builtin_ctzll(matches);
+   if ( val != nullptr )
+      *val = (uint16_t)( ((DecFormats >> fmt) & 1u) ? decval : hexval );
+
+   return fmt;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+const char * LinPID_PrintFormat( enum NumericFormat_E fmt )
+{
+   if ( (fmt < (enum NumericFormat_E)0) || (fmt >= NUM_OF_NUMERIC_FORMATS) )
+      return nullptr;
+
+   return PrintFormats[fmt];
+}
@@ -0,0 +1,63 @@
+/**
+ * @file lin_pid_formats.h
+ * @brief Classify a LIN ID entry into its exact LIN_PID_NUMERIC_FORMAT and
+ *        parse its value, in one pass.
+ *
+ * @note The formats (and their order) come from lin_pid_supported_formats.h.
+ *       Matching runs on the DFA generated from it (lin_pid_formats_dfa.h).
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef LIN_PID_FORMATS_H_
+#define LIN_PID_FORMATS_H_
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Datatypes */
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd ) \
+   enum,
+
+enum NumericFormat_E
+{
+   #include "lin_pid_supported_formats.h"
+   NUM_OF_NUMERIC_FORMATS,
+   INVALID_NUMERIC_FORMAT
+};
+
+#undef LIN_PID_NUMERIC_FORMAT
+
+/* Public API */
+
+/**
+ * @brief Find the exact format str is written in and parse its value, in the
+ *        same pass over str.
+ * @note The whole of str must be the entry (no surrounding whitespace).
+ * @note When str fits several formats (e.g., "12" is bare dec or bare hex, and
+ *       either case of hex), the first one listed among those allowed wins.
+ *       Bare digits are taken as hex unless isdec is set, as the CLI does.
+ * @param[in] str : NUL-terminated entry to classify
+ * @param[in] ishex : only consider hex formats
+ * @param[in] isdec : only consider dec formats
+ * @param[out] val : [Optional] value of the entry, if a format was found
+ * @return the matching format, or INVALID_NUMERIC_FORMAT if none fits
+ */
+[[nodiscard]]
+enum NumericFormat_E LinPID_ParseFormattedID( const char * str,
+                                              bool ishex,
+                                              bool isdec,
+                                              uint16_t * val );
+
+/**
+ * @brief printf format specifier that writes an ID back out in fmt's style.
+ * @param[in] fmt : a format from LinPID_ParseFormattedID
+ * @return e.g. "0x%02X", or nullptr for INVALID_NUMERIC_FORMAT
+ */
+[[nodiscard]]
+const char * LinPID_PrintFormat( enum NumericFormat_E fmt );
+
+#endif // LIN_PID_FORMATS_H_
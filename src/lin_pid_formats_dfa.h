@@ -0,0 +1,211 @@
+/**
+ * @file lin_pid_formats_dfa.h
+ * @brief Minimized DFA over every regex in lin_pid_supported_formats.h.
+ *
+ * @note GENERATED by scripts/gen_lin_pid_dfa.py - do not edit. Edit
+ *       lin_pid_supported_formats.h and rebuild instead.
+ *
+ * @note Each accepting state's mask has bit i set when the string is matched
+ *       by the i-th LIN_PID_NUMERIC_FORMAT entry (i.e., bit NumericFormat_E):
+ *    bit  0: DecNoPrefixOrSuffix_NoLeadingZeros
+ *    bit  1: DecNoPrefixOrSuffix_LeadingZeros
+ *    bit  2: HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase
+ *    bit  3: HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase
+ *    bit  4: HexNoPrefixOrSuffix_LeadingZeros_Uppercase
+ *    bit  5: HexNoPrefixOrSuffix_LeadingZeros_Lowercase
+ *    bit  6: ClassicHexPrefix_NoLeadingZeros_Uppercase
+ *    bit  7: ClassicHexPrefix_NoLeadingZeros_Lowercase
+ *    bit  8: ClassicHexPrefix_LeadingZeros_Uppercase
+ *    bit  9: ClassicHexPrefix_LeadingZeros_Lowercase
+ *    bit 10: LowercasexPrefix_NoLeadingZeros_Uppercase
+ *    bit 11: LowercasexPrefix_NoLeadingZeros_Lowercase
+ *    bit 12: LowercasexPrefix_LeadingZeros_Uppercase
+ *    bit 13: LowercasexPrefix_LeadingZeros_Lowercase
+ *    bit 14: UppercaseXPrefix_NoLeadingZeros_Uppercase
+ *    bit 15: UppercaseXPrefix_NoLeadingZeros_Lowercase
+ *    bit 16: UppercaseXPrefix_LeadingZeros_Uppercase
+ *    bit 17: UppercaseXPrefix_LeadingZeros_Lowercase
+ *    bit 18: LowercasehSuffix_NoLeadingZeros_Uppercase
+ *    bit 19: LowercasehSuffix_NoLeadingZeros_Lowercase
+ *    bit 20: LowercasehSuffix_LeadingZeros_Uppercase
+ *    bit 21: LowercasehSuffix_LeadingZeros_Lowercase
+ *    bit 22: UppercaseHSuffix_NoLeadingZeros_Uppercase
+ *    bit 23: UppercaseHSuffix_NoLeadingZeros_Lowercase
+ *    bit 24: UppercaseHSuffix_LeadingZeros_Uppercase
+ *    bit 25: UppercaseHSuffix_LeadingZeros_Lowercase
+ *    bit 26: LowercasexSuffix_NoLeadingZeros_Uppercase
+ *    bit 27: LowercasexSuffix_NoLeadingZeros_Lowercase
+ *    bit 28: LowercasexSuffix_LeadingZeros_Uppercase
+ *    bit 29: LowercasexSuffix_LeadingZeros_Lowercase
+ *    bit 30: UppercaseXSuffix_NoLeadingZeros_Uppercase
+ *    bit 31: UppercaseXSuffix_NoLeadingZeros_Lowercase
+ *    bit 32: UppercaseXSuffix_LeadingZeros_Uppercase
+ *    bit 33: UppercaseXSuffix_LeadingZeros_Lowercase
+ *    bit 34: LowercasedSuffix_NoLeadingZeros
+ *    bit 35: LowercasedSuffix_LeadingZeros
+ *    bit 36: UppercaseDSuffix_NoLeadingZeros
+ *    bit 37: UppercaseDSuffix_LeadingZeros
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @copyright MIT License
+ */
+
+#ifndef LIN_PID_FORMATS_DFA_H_
+#define LIN_PID_FORMATS_DFA_H_
+
+/* File Inclusions */
+#include <stdint.h>
+
+/* Definitions */
+#define LIN_PID_DFA_NUM_FORMATS   38
+#define LIN_PID_DFA_NUM_STATES    78
+#define LIN_PID_DFA_NUM_CLASSES   11
+#define LIN_PID_DFA_DEAD_STATE    0
+#define LIN_PID_DFA_START_STATE   1
+
+// Byte -> character class. Bytes every regex treats alike share a class.
+static const uint8_t LIN_PID_DFA_CHAR_CLASS[256] =
+{
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    1,  2,  2,  2,  2,  2,  2,  2,  2,  2,  0,  0,  0,  0,  0,  0,
+    0,  3,  3,  3,  4,  3,  3,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+    0,  7,  7,  7,  8,  7,  7,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+// [state][character class] -> next state
+static const uint8_t LIN_PID_DFA_NEXT[LIN_PID_DFA_NUM_STATES][LIN_PID_DFA_NUM_CLASSES] =
+{
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   2,   3,   4,   4,   0,   5,   6,   6,   0,   7 },
+   {   0,   8,   8,   9,  10,  11,  12,  13,  14,  15,  16 },
+   {   0,  17,  17,  18,  19,  20,  21,  22,  23,  24,  25 },
+   {   0,  18,  18,  18,  18,  26,  27,   0,   0,  28,  29 },
+   {   0,  30,  31,  32,  32,   0,   0,  33,  33,   0,   0 },
+   {   0,  22,  22,   0,   0,  34,  35,  22,  22,  36,  37 },
+   {   0,  38,  39,  40,  40,   0,   0,  41,  41,   0,   0 },
+   {   0,  42,  42,   0,  43,  11,  12,   0,  44,  15,  45 },
+   {   0,   0,   0,   0,   0,  46,  47,   0,   0,  48,  49 },
+   {   0,   0,   0,   0,   0,  46,  47,   0,   0,  48,  49 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,  50,  51,   0,   0,  52,  53 },
+   {   0,   0,   0,   0,   0,  50,  51,   0,   0,  52,  53 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,  54,  55,  56,  56,   0,   0,  57,  57,   0,   0 },
+   {   0,  42,  42,   0,  58,  20,  21,   0,  59,  24,  25 },
+   {   0,   0,   0,   0,   0,  26,  27,   0,   0,  28,  29 },
+   {   0,   0,   0,   0,   0,  26,  27,   0,   0,  28,  29 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,  34,  35,   0,   0,  36,  37 },
+   {   0,   0,   0,   0,   0,  34,  35,   0,   0,  36,  37 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,  60,  60,  61,  61,   0,   0,  62,  62,   0,   0 },
+   {   0,  63,  63,  64,  64,   0,   0,  65,  65,   0,   0 },
+   {   0,  64,  64,  64,  64,   0,   0,   0,   0,   0,   0 },
+   {   0,  65,  65,   0,   0,   0,   0,  65,  65,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,  66,  66,  67,  67,   0,   0,  68,  68,   0,   0 },
+   {   0,  69,  69,  70,  70,   0,   0,  71,  71,   0,   0 },
+   {   0,  70,  70,  70,  70,   0,   0,   0,   0,   0,   0 },
+   {   0,  71,  71,   0,   0,   0,   0,  71,  71,   0,   0 },
+   {   0,   0,   0,   0,  43,   0,   0,   0,  44,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,  72,  72,  73,  73,   0,   0,  74,  74,   0,   0 },
+   {   0,  75,  75,  76,  76,   0,   0,  77,  77,   0,   0 },
+   {   0,  76,  76,  76,  76,   0,   0,   0,   0,   0,   0 },
+   {   0,  77,  77,   0,   0,   0,   0,  77,  77,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+   {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0 },
+};
+
+// State -> mask of the formats matched if the string ends there
+static const uint64_t LIN_PID_DFA_ACCEPTS[LIN_PID_DFA_NUM_STATES] =
+{
+   0x0000000000000000u, 0x0000000000000000u, 0x0000000000000032u, 0x000000000000003Fu,
+   0x0000000000000014u, 0x0000000000000000u, 0x0000000000000028u, 0x0000000000000000u,
+   0x0000000000000032u, 0x0000000000000010u, 0x0000002000000010u, 0x0000000003000000u,
+   0x0000000300000000u, 0x0000000000000020u, 0x0000000800000020u, 0x0000000000300000u,
+   0x0000000030000000u, 0x000000000000003Fu, 0x0000000000000014u, 0x0000003000000014u,
+   0x0000000003C00000u, 0x00000003C0000000u, 0x0000000000000028u, 0x0000000C00000028u,
+   0x00000000003C0000u, 0x000000003C000000u, 0x0000000001400000u, 0x0000000140000000u,
+   0x0000000000140000u, 0x0000000014000000u, 0x0000000000030000u, 0x000000000003C000u,
+   0x0000000000014000u, 0x0000000000028000u, 0x0000000002800000u, 0x0000000280000000u,
+   0x0000000000280000u, 0x0000000028000000u, 0x0000000000003000u, 0x0000000000003C00u,
+   0x0000000000001400u, 0x0000000000002800u, 0x0000000000000000u, 0x0000002000000000u,
+   0x0000000800000000u, 0x0000000030000000u, 0x0000000001000000u, 0x0000000100000000u,
+   0x0000000000100000u, 0x0000000010000000u, 0x0000000002000000u, 0x0000000200000000u,
+   0x0000000000200000u, 0x0000000020000000u, 0x0000000000000300u, 0x00000000000003C0u,
+   0x0000000000000140u, 0x0000000000000280u, 0x0000003000000000u, 0x0000000C00000000u,
+   0x0000000000030000u, 0x0000000000010000u, 0x0000000000020000u, 0x000000000003C000u,
+   0x0000000000014000u, 0x0000000000028000u, 0x0000000000003000u, 0x0000000000001000u,
+   0x0000000000002000u, 0x0000000000003C00u, 0x0000000000001400u, 0x0000000000002800u,
+   0x0000000000000300u, 0x0000000000000100u, 0x0000000000000200u, 0x00000000000003C0u,
+   0x0000000000000140u, 0x0000000000000280u,
+};
+
+/**
+ * @brief Find every LIN_PID_NUMERIC_FORMAT the whole of str matches, in one pass.
+ * @param[in] str : NUL-terminated string to classify
+ * @return Mask with bit i set for each i-th format matched; 0 if none.
+ */
+static inline uint64_t LinPID_FormatsMatching( const char * str )
+{
+   uint8_t state = LIN_PID_DFA_START_STATE;
+   for ( ; (*str != '\0') && (state != LIN_PID_DFA_DEAD_STATE); str++ )
+   {
+      state = LIN_PID_DFA_NEXT[state][ LIN_PID_DFA_CHAR_CLASS[(uint8_t)*str] ];
+   }
+
+   return (*str == '\0') ? LIN_PID_DFA_ACCEPTS[state] : 0u;
+}
+
+#endif // LIN_PID_FORMATS_DFA_H_
@@ -0,0 +1,166 @@
+/*!
+ * @file    nparsy_any.c
+ * @brief   Implementation of NParsy's mixed-type (tagged value) parsing.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "nparsy.h"
+#include "nparsy_kernels.h"
+
+/* Local Macro Definitions */
+
+/* Datatypes */
+
+/* Local Data */
+
+/*** Private Function Prototypes ***/
+static inline enum NParsyResult nparsy_any_validate(
+      const char * str,
+      bool have_out,
+      enum NParsyNumFormat default_fmt,
+      size_t * slen );
+static inline enum NParsyResult nparsy_token_to_value(const struct Token * tok, struct NParsyValue * val);
+
+/* Public Function Implementations */
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyAny(
+      const char * str,
+      struct NParsyValue * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt )
+{
+   size_t slen = 0;
+   enum NParsyResult result = nparsy_any_validate(str, (parsed_val != nullptr), default_fmt, &slen);
+   if ( result != NParsy_GoodResult )
+      return result;
+
+   const char * p = str;
+   const char * end = str + slen;
+   struct Token tok;
+
+   result = NParsy_NoNumberFound;
+   while ( nparsy_next_token(p, end, (p > str) ? p[-1] : '\0', true, default_fmt, &tok) == Scan_Found )
+   {
+      p = tok.end;
+      if ( tok.kind == Token_Malformed )
+         continue;
+
+      result = nparsy_token_to_value(&tok, parsed_val);
+      break;
+   }
+
+   if ( result == NParsy_NoNumberFound )
+      p = end;
+
+   if ( accumulated_strlen != nullptr )
+      *accumulated_strlen = (size_t)(p - str);
+
+   return result;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyAnyList(
+      const char * str,
+      struct NParsyValue * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt )
+{
+   size_t slen = 0;
+   enum NParsyResult result = nparsy_any_validate(str, (buf != nullptr), default_fmt, &slen);
+   if ( result != NParsy_GoodResult )
+      return result;
+
+   const char * p = str;
+   const char * end = str + slen;
+   struct Token tok;
+   size_t n = 0;
+
+   while ( (n < len)
+           && (nparsy_next_token(p, end, (p > str) ? p[-1] : '\0', true, default_fmt, &tok) == Scan_Found) )
+   {
+      p = tok.end;
+
+      // Malformed and out-of-range numbers are skipped
+      if ( (tok.kind != Token_Malformed) && (nparsy_token_to_value(&tok, &buf[n]) == NParsy_GoodResult) )
+         n++;
+   }
+
+   if ( num_parsed != nullptr )
+      *num_parsed = n;
+
+   return NParsy_GoodResult;
+}
+
+/*** Private Function Implementations ***/
+
+/**
+ * @brief Input validation shared by NParsyAny and NParsyAnyList.
+ */
+static inline enum NParsyResult nparsy_any_validate(
+      const char * str,
+      bool have_out,
+      enum NParsyNumFormat default_fmt,
+      size_t * slen )
+{
+   if ( str == nullptr || !nparsy_bounded_strlen(str, slen) )
+      return NParsy_InvalidString;
+   else if ( !have_out )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+
+   return NParsy_GoodResult;
+}
+
+/**
+ * @brief Convert a token straight into the member of val its kind calls for.
+ * @note val is left alone unless the conversion succeeds.
+ */
+static inline enum NParsyResult nparsy_token_to_value(const struct Token * tok, struct NParsyValue * val)
+{
+   uint64_t mag = 0;
+   double f = 0.0;
+
+   switch ( tok->kind )
+   {
+      case Token_UInt:
+         if ( !nparsy_token_to_u64(tok, &mag) )
+            return NParsy_NumberOutOfRange;
+         val->type = NParsy_U64;
+         val->u64 = mag;
+         break;
+
+      case Token_Negative:
+         // -2^63 is the one magnitude past INT64_MAX that still fits
+         if ( !nparsy_token_to_u64(tok, &mag) || (mag > ((uint64_t)INT64_MAX + 1u)) )
+            return NParsy_NumberOutOfRange;
+         val->type = NParsy_I64;
+         val->i64 = (int64_t)(0u - mag);
+         break;
+
+      case Token_Float:
+         if ( !nparsy_dec_to_double(tok->begin, tok->end, &f) )
+            return NParsy_NumberOutOfRange;
+         val->type = NParsy_F64;
+         val->f64 = f;
+         break;
+
+      case Token_Malformed:
+      default:
+         return NParsy_NoNumberFound;
+   }
+
+   return NParsy_GoodResult;
+}
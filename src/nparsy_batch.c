@@ -0,0 +1,653 @@
+/*!
+ * @file    nparsy_batch.c
+ * @brief   Implementation of NParsy's batched multi-file parsing.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* Feature Test Macros */
+// syscall, pread, O_CLOEXEC, and MAP_POPULATE are hidden under a strict -std
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define NPARSY_HAVE_IO_URING
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+
+#include "nparsy_batch.h"
+#include "nparsy_kernels.h"
+
+/* Local Macro Definitions */
+#ifdef MAP_POPULATE
+#define NPARSY_RING_MMAP_FLAGS  (MAP_SHARED | MAP_POPULATE) // Pre-fault the rings in one go
+#else
+#define NPARSY_RING_MMAP_FLAGS  (MAP_SHARED)
+#endif
+
+/* Datatypes */
+constexpr unsigned NPARSY_BATCH_MAX_WORKERS = 64u;
+constexpr size_t NPARSY_BATCH_MAX_READ_LEN = 1u << 30; // per read request
+
+// One file, from open to results
+struct FileJob
+{
+   size_t idx;
+   int fd;
+   char * buf;
+   size_t size;
+   size_t done;      // bytes read so far
+   enum NParsyResult result;
+   struct FileJob * next;
+};
+
+// State shared between the reading thread and the parser workers
+struct Batch
+{
+   pthread_mutex_t mtx;
+   pthread_cond_t work_cv;  // a job was queued, or no more are coming
+   pthread_cond_t slot_cv;  // a job was finished
+   struct FileJob * head;
+   struct FileJob * tail;
+   unsigned outstanding;    // jobs opened but not yet finished
+   bool closing;
+   struct FileJob spare;    // reports a file whose own job couldn't be allocated
+   bool spare_busy;
+
+   NParsyFileSink sink;
+   void * ctx;
+   enum NParsyNumFormat default_fmt;
+};
+
+#ifdef NPARSY_HAVE_IO_URING
+// Just enough of an io_uring to queue reads and reap their completions
+struct Ring
+{
+   int fd;
+   unsigned sq_entries;
+   unsigned * sq_head;
+   unsigned * sq_tail;
+   unsigned * sq_mask;
+   unsigned * sq_array;
+   struct io_uring_sqe * sqes;
+   unsigned * cq_head;
+   unsigned * cq_tail;
+   unsigned * cq_mask;
+   struct io_uring_cqe * cqes;
+   void * sq_map;
+   size_t sq_map_len;
+   void * cq_map;
+   size_t cq_map_len;
+   size_t sqes_len;
+};
+#endif
+
+/* Local Data */
+
+/*** Private Function Prototypes ***/
+static void * nparsy_batch_worker(void * arg);
+static void nparsy_batch_parse(struct Batch * b, struct FileJob * job);
+static struct FileJob * nparsy_batch_open(struct Batch * b, size_t idx, const char * path);
+static void nparsy_batch_enqueue(struct Batch * b, struct FileJob * job);
+static void nparsy_batch_wait_slot(struct Batch * b, unsigned qd);
+static bool nparsy_batch_has_slot(struct Batch * b, unsigned qd);
+static void nparsy_batch_pread_rest(struct FileJob * job);
+static void nparsy_batch_read_all_pread(
+      struct Batch * b,
+      const char * const * paths,
+      size_t first,
+      size_t npaths,
+      unsigned qd );
+#ifdef NPARSY_HAVE_IO_URING
+static bool nparsy_ring_init(struct Ring * r, unsigned entries);
+static void nparsy_ring_free(struct Ring * r);
+static void nparsy_ring_prep_read(struct Ring * r, struct FileJob * job);
+static void nparsy_batch_read_all_uring(
+      struct Batch * b,
+      struct Ring * r,
+      const char * const * paths,
+      size_t npaths,
+      unsigned qd );
+#endif
+
+/* Public Function Implementations */
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntFiles(
+      const char * const * paths,
+      size_t npaths,
+      NParsyFileSink sink,
+      void * ctx,
+      const struct NParsyBatchOptions * opts,
+      enum NParsyNumFormat default_fmt )
+{
+   // Initial input validation
+   if ( (paths == nullptr) || (sink == nullptr) )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+
+   struct NParsyBatchOptions o = { 0 };
+   if ( opts != nullptr )
+      o = *opts;
+
+   if ( o.workers == 0u )
+   {
+      long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+      o.workers = (ncpu > 0) ? (unsigned)ncpu : 1u;
+   }
+   if ( o.workers > NPARSY_BATCH_MAX_WORKERS )
+      o.workers = NPARSY_BATCH_MAX_WORKERS;
+   if ( o.queue_depth == 0u )
+      o.queue_depth = NPARSY_BATCH_DEFAULT_QUEUE_DEPTH;
+
+   struct Batch b = { .sink = sink, .ctx = ctx, .default_fmt = default_fmt };
+   (void)pthread_mutex_init(&b.mtx, nullptr);
+   (void)pthread_cond_init(&b.work_cv, nullptr);
+   (void)pthread_cond_init(&b.slot_cv, nullptr);
+
+   pthread_t workers[NPARSY_BATCH_MAX_WORKERS];
+   unsigned nworkers = 0;
+   while ( (nworkers < o.workers)
+           && (pthread_create(&workers[nworkers], nullptr, nparsy_batch_worker, &b) == 0) )
+      ++nworkers;
+
+   enum NParsyResult result = NParsy_GoodResult;
+   if ( nworkers == 0u )
+   {
+      result = NParsy_OutOfMemory;
+   }
+   else
+   {
+#ifdef NPARSY_HAVE_IO_URING
+      struct Ring ring;
+      if ( !o.no_io_uring && nparsy_ring_init(&ring, o.queue_depth) )
+      {
+         nparsy_batch_read_all_uring(&b, &ring, paths, npaths, o.queue_depth);
+         nparsy_ring_free(&ring);
+      }
+      else
+#endif
+      {
+         nparsy_batch_read_all_pread(&b, paths, 0, npaths, o.queue_depth);
+      }
+   }
+
+   // Let the workers drain the queue and exit
+   (void)pthread_mutex_lock(&b.mtx);
+   b.closing = true;
+   (void)pthread_cond_broadcast(&b.work_cv);
+   (void)pthread_mutex_unlock(&b.mtx);
+   for ( unsigned i = 0; i < nworkers; i++ )
+      (void)pthread_join(workers[i], nullptr);
+
+   (void)pthread_cond_destroy(&b.slot_cv);
+   (void)pthread_cond_destroy(&b.work_cv);
+   (void)pthread_mutex_destroy(&b.mtx);
+
+   return result;
+}
+
+/*** Private Function Implementations ***/
+
+static void * nparsy_batch_worker(void * arg)
+{
+   struct Batch * b = arg;
+
+   for ( ;; )
+   {
+      (void)pthread_mutex_lock(&b->mtx);
+      while ( (b->head == nullptr) && !b->closing )
+         (void)pthread_cond_wait(&b->work_cv, &b->mtx);
+
+      struct FileJob * job = b->head;
+      if ( job != nullptr )
+      {
+         b->head = job->next;
+         if ( b->head == nullptr )
+            b->tail = nullptr;
+      }
+      (void)pthread_mutex_unlock(&b->mtx);
+
+      if ( job == nullptr )
+         break; // Closing and nothing left
+
+      nparsy_batch_parse(b, job);
+      bool spare = (job == &b->spare);
+      if ( !spare )
+         free(job);
+
+      (void)pthread_mutex_lock(&b->mtx);
+      --b->outstanding;
+      if ( spare )
+         b->spare_busy = false;
+      (void)pthread_cond_signal(&b->slot_cv);
+      (void)pthread_mutex_unlock(&b->mtx);
+   }
+
+   return nullptr;
+}
+
+/**
+ * @brief Parse one file's buffer and hand the results to the sink.
+ */
+static void nparsy_batch_parse(struct Batch * b, struct FileJob * job)
+{
+   uint64_t * vals = nullptr;
+   size_t n = 0;
+   size_t cap = 0;
+
+   if ( job->result == NParsy_GoodResult )
+   {
+      const char * p = job->buf;
+      const char * end = job->buf + job->size;
+      uint64_t val = 0;
+
+      while ( nparsy_next_u64(job->buf, &p, end, b->default_fmt, &val) )
+      {
+         if ( n == cap )
+         {
+            cap = (cap == 0u) ? 64u : (2u * cap);
+            uint64_t * grown = realloc(vals, cap * sizeof *vals);
+            if ( grown == nullptr )
+            {
+               job->result = NParsy_OutOfMemory;
+               n = 0;
+               break;
+            }
+            vals = grown;
+         }
+         vals[n++] = val;
+      }
+   }
+
+   b->sink(job->idx, vals, n, job->result, b->ctx);
+
+   free(vals);
+   free(job->buf);
+}
+
+/**
+ * @brief Open a file and set up its read buffer.
+ * @note Failures are recorded in the job, which then goes straight to a
+ *       worker to be reported. If the job itself can't be allocated, the
+ *       batch's spare job carries the failure instead (once the worker that
+ *       has it is done with it), so the sink still only runs on workers.
+ */
+static struct FileJob * nparsy_batch_open(struct Batch * b, size_t idx, const char * path)
+{
+   struct FileJob * job = calloc(1, sizeof *job);
+   if ( job == nullptr )
+   {
+      (void)pthread_mutex_lock(&b->mtx);
+      while ( b->spare_busy )
+         (void)pthread_cond_wait(&b->slot_cv, &b->mtx);
+      b->spare_busy = true;
+      (void)pthread_mutex_unlock(&b->mtx);
+
+      job = &b->spare;
+      *job = (struct FileJob){ .idx = idx, .fd = -1, .result = NParsy_OutOfMemory };
+      return job;
+   }
+
+   job->idx = idx;
+   job->fd = -1;
+   job->result = NParsy_GoodResult;
+
+   struct stat st;
+   if ( path == nullptr )
+      job->result = NParsy_InvalidString;
+   else if ( (job->fd = open(path, O_RDONLY | O_CLOEXEC)) < 0 )
+      job->result = NParsy_FileAccessFailed;
+   else if ( (fstat(job->fd, &st) != 0) || !S_ISREG(st.st_mode)
+             || ((uintmax_t)st.st_size > (uintmax_t)SIZE_MAX) )
+      job->result = NParsy_FileAccessFailed;
+   else if ( (job->size = (size_t)st.st_size) > 0u
+             && (job->buf = malloc(job->size)) == nullptr )
+      job->result = NParsy_OutOfMemory;
+
+   if ( (job->result != NParsy_GoodResult) && (job->fd >= 0) )
+   {
+      (void)close(job->fd);
+      job->fd = -1;
+   }
+
+   return job;
+}
+
+/**
+ * @brief Hand a job whose reading is over to the workers.
+ */
+static void nparsy_batch_enqueue(struct Batch * b, struct FileJob * job)
+{
+   if ( job->fd >= 0 )
+   {
+      (void)close(job->fd);
+      job->fd = -1;
+   }
+
+   (void)pthread_mutex_lock(&b->mtx);
+   if ( b->tail != nullptr )
+      b->tail->next = job;
+   else
+      b->head = job;
+   b->tail = job;
+   (void)pthread_cond_signal(&b->work_cv);
+   (void)pthread_mutex_unlock(&b->mtx);
+}
+
+/**
+ * @brief Block until fewer than qd jobs are outstanding, then claim a slot.
+ */
+static void nparsy_batch_wait_slot(struct Batch * b, unsigned qd)
+{
+   (void)pthread_mutex_lock(&b->mtx);
+   while ( b->outstanding >= qd )
+      (void)pthread_cond_wait(&b->slot_cv, &b->mtx);
+   ++b->outstanding;
+   (void)pthread_mutex_unlock(&b->mtx);
+}
+
+/**
+ * @brief Claim a slot if one is free right now.
+ */
+static bool nparsy_batch_has_slot(struct Batch * b, unsigned qd)
+{
+   (void)pthread_mutex_lock(&b->mtx);
+   bool free_slot = (b->outstanding < qd);
+   if ( free_slot )
+      ++b->outstanding;
+   (void)pthread_mutex_unlock(&b->mtx);
+   return free_slot;
+}
+
+/**
+ * @brief Read whatever is left of a job's file with pread().
+ */
+static void nparsy_batch_pread_rest(struct FileJob * job)
+{
+   while ( (job->result == NParsy_GoodResult) && (job->done < job->size) )
+   {
+      ssize_t n = pread(job->fd, job->buf + job->done, job->size - job->done, (off_t)job->done);
+      if ( n > 0 )
+         job->done += (size_t)n;
+      else if ( n == 0 )
+         job->size = job->done; // Shrunk since it was sized up
+      else if ( errno != EINTR )
+         job->result = NParsy_FileAccessFailed;
+   }
+}
+
+/**
+ * @brief Fallback: read each file with pread() on this thread while the
+ *        workers parse the ones already read.
+ */
+static void nparsy_batch_read_all_pread(
+      struct Batch * b,
+      const char * const * paths,
+      size_t first,
+      size_t npaths,
+      unsigned qd )
+{
+   for ( size_t i = first; i < npaths; i++ )
+   {
+      nparsy_batch_wait_slot(b, qd);
+
+      struct FileJob * job = nparsy_batch_open(b, i, paths[i]);
+      nparsy_batch_pread_rest(job);
+      nparsy_batch_enqueue(b, job);
+   }
+}
+
+#ifdef NPARSY_HAVE_IO_URING
+
+static bool nparsy_ring_init(struct Ring * r, unsigned entries)
+{
+   struct io_uring_params p;
+   memset(&p, 0, sizeof p);
+   memset(r, 0, sizeof *r);
+
+   long fd = syscall(__NR_io_uring_setup, entries, &p);
+   if ( fd < 0 )
+      return false;
+   r->fd = (int)fd;
+   r->sq_entries = p.sq_entries;
+
+   r->sq_map_len = p.sq_off.array + (p.sq_entries * sizeof(unsigned));
+   r->cq_map_len = p.cq_off.cqes + (p.cq_entries * sizeof(struct io_uring_cqe));
+   bool single_mmap = (p.features & IORING_FEAT_SINGLE_MMAP) != 0u;
+   if ( single_mmap && (r->cq_map_len > r->sq_map_len) )
+      r->sq_map_len = r->cq_map_len;
+
+   r->sq_map = mmap(nullptr, r->sq_map_len, PROT_READ | PROT_WRITE, NPARSY_RING_MMAP_FLAGS, r->fd, IORING_OFF_SQ_RING);
+   if ( r->sq_map == MAP_FAILED )
+      goto fail_close;
+
+   if ( single_mmap )
+   {
+      r->cq_map = r->sq_map;
+   }
+   else
+   {
+      r->cq_map = mmap(nullptr, r->cq_map_len, PROT_READ | PROT_WRITE, NPARSY_RING_MMAP_FLAGS, r->fd, IORING_OFF_CQ_RING);
+      if ( r->cq_map == MAP_FAILED )
+         goto fail_sq;
+   }
+
+   r->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+   r->sqes = mmap(nullptr, r->sqes_len, PROT_READ | PROT_WRITE, NPARSY_RING_MMAP_FLAGS, r->fd, IORING_OFF_SQES);
+   if ( r->sqes == MAP_FAILED )
+      goto fail_cq;
+
+   char * sq = r->sq_map;
+   char * cq = r->cq_map;
+   r->sq_head = (unsigned *)(void *)(sq + p.sq_off.head);
+   r->sq_tail = (unsigned *)(void *)(sq + p.sq_off.tail);
+   r->sq_mask = (unsigned *)(void *)(sq + p.sq_off.ring_mask);
+   r->sq_array = (unsigned *)(void *)(sq + p.sq_off.array);
+   r->cq_head = (unsigned *)(void *)(cq + p.cq_off.head);
+   r->cq_tail = (unsigned *)(void *)(cq + p.cq_off.tail);
+   r->cq_mask = (unsigned *)(void *)(cq + p.cq_off.ring_mask);
+   r->cqes = (struct io_uring_cqe *)(void *)(cq + p.cq_off.cqes);
+   return true;
+
+fail_cq:
+   if ( !single_mmap )
+      (void)munmap(r->cq_map, r->cq_map_len);
+fail_sq:
+   (void)munmap(r->sq_map, r->sq_map_len);
+fail_close:
+   (void)close(r->fd);
+   return false;
+}
+
+static void nparsy_ring_free(struct Ring * r)
+{
+   (void)munmap(r->sqes, r->sqes_len);
+   if ( r->cq_map != r->sq_map )
+      (void)munmap(r->cq_map, r->cq_map_len);
+   (void)munmap(r->sq_map, r->sq_map_len);
+   (void)close(r->fd);
+}
+
+/**
+ * @brief Queue a read of the rest of the job's file (not yet submitted).
+ */
+static void nparsy_ring_prep_read(struct Ring * r, struct FileJob * job)
+{
+   // Only this thread produces SQEs, so a plain load of our own tail is fine
+   unsigned tail = *r->sq_tail;
+   unsigned idx = tail & *r->sq_mask;
+   struct io_uring_sqe * sqe = &r->sqes[idx];
+
+   size_t len = job->size - job->done;
+   if ( len > NPARSY_BATCH_MAX_READ_LEN )
+      len = NPARSY_BATCH_MAX_READ_LEN;
+
+   memset(sqe, 0, sizeof *sqe);
+   sqe->opcode = IORING_OP_READ;
+   sqe->fd = job->fd;
+   sqe->addr = (uint64_t)(uintptr_t)(job->buf + job->done);
+   sqe->len = (uint32_t)len;
+   sqe->off = (uint64_t)job->done;
+   sqe->user_data = (uint64_t)(uintptr_t)job;
+
+   r->sq_array[idx] = idx;
+   __atomic_store_n(r->sq_tail, tail + 1u, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Keep up to qd files being read through io_uring at once, handing
+ *        each to the workers as its read completes.
+ * @note Each file has at most one read in flight, and at most qd files are
+ *       outstanding, so the submission queue can't overflow.
+ */
+static void nparsy_batch_read_all_uring(
+      struct Batch * b,
+      struct Ring * r,
+      const char * const * paths,
+      size_t npaths,
+      unsigned qd )
+{
+   size_t next = 0;
+   unsigned inflight = 0;  // reads queued or in the kernel
+   unsigned unsubmitted = 0;
+
+   if ( qd > r->sq_entries )
+      qd = r->sq_entries;
+
+   while ( (next < npaths) || (inflight > 0u) )
+   {
+      // Open as many files as there are free slots
+      while ( (next < npaths) && nparsy_batch_has_slot(b, qd) )
+      {
+         size_t idx = next++;
+         struct FileJob * job = nparsy_batch_open(b, idx, paths[idx]);
+         if ( (job->result != NParsy_GoodResult) || (job->size == 0u) )
+         {
+            nparsy_batch_enqueue(b, job);
+         }
+         else
+         {
+            nparsy_ring_prep_read(r, job);
+            ++inflight;
+            ++unsubmitted;
+         }
+      }
+
+      if ( inflight == 0u )
+      {
+         // Every slot is taken by files waiting on the workers
+         if ( next < npaths )
+         {
+            nparsy_batch_wait_slot(b, qd);
+            (void)pthread_mutex_lock(&b->mtx);
+            --b->outstanding; // Just wanted to know one freed up
+            (void)pthread_mutex_unlock(&b->mtx);
+         }
+         continue;
+      }
+
+      long ret = syscall(__NR_io_uring_enter, r->fd, unsubmitted, 1u, IORING_ENTER_GETEVENTS, nullptr, 0);
+      if ( ret < 0 )
+      {
+         if ( (errno == EINTR) || (errno == EAGAIN) || (errno == EBUSY) )
+            continue;
+
+         // The ring is unusable; finish up with pread() below
+         break;
+      }
+      unsubmitted -= (unsigned)ret;
+
+      // Reap completions
+      unsigned head = *r->cq_head;
+      unsigned tail = __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE);
+      for ( ; head != tail; ++head )
+      {
+         struct io_uring_cqe * cqe = &r->cqes[head & *r->cq_mask];
+         struct FileJob * job = (struct FileJob *)(uintptr_t)cqe->user_data;
+         int res = cqe->res;
+
+         if ( res > 0 )
+            job->done += (size_t)res;
+         else if ( res == 0 )
+            job->size = job->done; // Shrunk since it was sized up
+         else if ( (res == -EINVAL) || (res == -EOPNOTSUPP) )
+            nparsy_batch_pread_rest(job); // Kernel without IORING_OP_READ
+         else if ( (res != -EINTR) && (res != -EAGAIN) )
+            job->result = NParsy_FileAccessFailed;
+
+         if ( (job->result == NParsy_GoodResult) && (job->done < job->size) )
+         {
+            // Short read: go again for the rest
+            nparsy_ring_prep_read(r, job);
+            ++unsubmitted;
+         }
+         else
+         {
+            --inflight;
+            nparsy_batch_enqueue(b, job);
+         }
+      }
+      __atomic_store_n(r->cq_head, head, __ATOMIC_RELEASE);
+   }
+
+   // Only reached early if io_uring_enter() itself failed
+   if ( (next < npaths) || (inflight > 0u) )
+   {
+      // Reads still sitting in the submission queue were never seen by the
+      // kernel, so they can be finished right here...
+      unsigned sq_head = __atomic_load_n(r->sq_head, __ATOMIC_ACQUIRE);
+      for ( unsigned t = *r->sq_tail; sq_head != t; ++sq_head, --inflight )
+      {
+         struct FileJob * job = (struct FileJob *)(uintptr_t)r->sqes[r->sq_array[sq_head & *r->sq_mask]].user_data;
+         nparsy_batch_pread_rest(job);
+         nparsy_batch_enqueue(b, job);
+      }
+
+      // ...but ones the kernel took still write into their buffers, so wait
+      // for their completions before touching them.
+      while ( inflight > 0u )
+      {
+         unsigned head = *r->cq_head;
+         unsigned tail = __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE);
+         if ( head == tail )
+         {
+            (void)sched_yield();
+            continue;
+         }
+         for ( ; head != tail; ++head, --inflight )
+         {
+            struct io_uring_cqe * cqe = &r->cqes[head & *r->cq_mask];
+            struct FileJob * job = (struct FileJob *)(uintptr_t)cqe->user_data;
+            if ( cqe->res > 0 )
+               job->done += (size_t)cqe->res;
+            nparsy_batch_pread_rest(job);
+            nparsy_batch_enqueue(b, job);
+         }
+         __atomic_store_n(r->cq_head, head, __ATOMIC_RELEASE);
+      }
+
+      nparsy_batch_read_all_pread(b, paths, next, npaths, qd);
+   }
+}
+
+#endif // NPARSY_HAVE_IO_URING
@@ -0,0 +1,436 @@
+/*!
+ * @file    nparsy_bigint.c
+ * @brief   Implementation of NParsy's arbitrary-width unsigned integer parsing.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "nparsy_bigint.h"
+#include "nparsy_kernels.h"
+
+/* Local Macro Definitions */
+
+/* Datatypes */
+// Powers (10^19)^(2^k), each 2^k limbs long, computed as the conversion needs them
+struct DecPowers
+{
+   uint64_t * pow[64];
+   size_t npow;
+};
+
+/* Local Data */
+constexpr size_t NPARSY_DIGITS_PER_BLOCK = 19u;            // 10^19 < 2^64
+constexpr uint64_t NPARSY_BLOCK_BASE = 10'000'000'000'000'000'000u;
+constexpr size_t NPARSY_KARATSUBA_THRESHOLD = 32u;         // limbs
+constexpr size_t NPARSY_DEC_DC_THRESHOLD = 32u;            // blocks
+
+/*** Private Function Prototypes ***/
+static enum NParsyResult nparsy_pow2_base_to_limbs(
+      const struct Token * tok,
+      uint64_t * limbs,
+      size_t nlimbs,
+      size_t * limbs_used );
+static enum NParsyResult nparsy_dec_to_limbs(
+      const struct Token * tok,
+      uint64_t * limbs,
+      size_t nlimbs,
+      size_t * limbs_used );
+static bool nparsy_dec_blocks_to_limbs(
+      const uint64_t * blocks,
+      size_t count,
+      uint64_t * out,
+      struct DecPowers * powers );
+static bool nparsy_karatsuba(uint64_t * r, const uint64_t * a, const uint64_t * b, size_t n);
+static void nparsy_mul_schoolbook(uint64_t * r, const uint64_t * a, size_t an, const uint64_t * b, size_t bn);
+static uint64_t nparsy_mul_1(uint64_t * r, size_t n, uint64_t m, uint64_t carry);
+static uint64_t nparsy_add_n(uint64_t * r, const uint64_t * a, const uint64_t * b, size_t n);
+static uint64_t nparsy_sub_n(uint64_t * r, const uint64_t * a, const uint64_t * b, size_t n);
+static uint64_t nparsy_add_1(uint64_t * r, size_t n, uint64_t b);
+static inline uint64_t nparsy_mul_64x64(uint64_t a, uint64_t b, uint64_t * hi);
+
+/* Public Function Implementations */
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyBigUInt(
+      const char * str,
+      uint64_t * limbs,
+      size_t nlimbs,
+      size_t * limbs_used,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt )
+{
+   size_t slen = 0;
+
+   // Initial input validation
+   if ( str == nullptr || !nparsy_bounded_strlen(str, &slen) )
+      return NParsy_InvalidString;
+   else if ( limbs == nullptr || limbs_used == nullptr )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+
+   const char * p = str;
+   const char * end = str + slen;
+   enum NParsyResult result = NParsy_NoNumberFound;
+   struct Token tok;
+
+   while ( nparsy_next_token(p, end, (p > str) ? p[-1] : '\0', true, default_fmt, &tok) == Scan_Found )
+   {
+      p = tok.end;
+      if ( tok.kind != Token_UInt )
+         continue;
+
+      if ( tok.fmt == NParsy_Dec )
+         result = nparsy_dec_to_limbs(&tok, limbs, nlimbs, limbs_used);
+      else
+         result = nparsy_pow2_base_to_limbs(&tok, limbs, nlimbs, limbs_used);
+      break;
+   }
+
+   if ( result == NParsy_NoNumberFound )
+      p = end;
+
+   if ( accumulated_strlen != nullptr )
+      *accumulated_strlen = (size_t)(p - str);
+
+   return result;
+}
+
+/*** Private Function Implementations ***/
+
+/**
+ * @brief Hex, binary, and octal: every digit maps onto a fixed bit position,
+ *        so fill the limbs straight from the least significant digit up.
+ */
+static enum NParsyResult nparsy_pow2_base_to_limbs(
+      const struct Token * tok,
+      uint64_t * limbs,
+      size_t nlimbs,
+      size_t * limbs_used )
+{
+   const char * d = tok->digits;
+   size_t n = nparsy_strip_leading_zeros(&d, tok->ndigits);
+   unsigned bits = nparsy_fmt_bits(tok->fmt);
+
+   // Size up the value: all digits are full width except the leading one
+   size_t total_bits = (n - 1u) * bits;
+   for ( uint8_t lead = nparsy_digit_val(*d); lead != 0u; lead >>= 1 )
+      ++total_bits;
+
+   size_t needed = (total_bits == 0u) ? 1u : ((total_bits + 63u) / 64u);
+   *limbs_used = needed;
+   if ( needed > nlimbs )
+      return NParsy_NumberOutOfRange;
+
+   memset(limbs, 0, needed * sizeof limbs[0]);
+   const char * p = d + n; // walk backwards from one past the last digit
+   size_t limb = 0;
+
+   // Whole limbs at a time where the kernels allow it
+   if ( tok->fmt == NParsy_Hex )
+   {
+      for ( ; (p - d) >= 16; p -= 16 )
+         limbs[limb++] = ((uint64_t)nparsy_swar_hex8( nparsy_load8(p - 16) ) << 32)
+                         | nparsy_swar_hex8( nparsy_load8(p - 8) );
+   }
+   else if ( tok->fmt == NParsy_Bin )
+   {
+      for ( ; (p - d) >= 64; p -= 64 )
+      {
+         uint64_t acc = 0;
+         for ( const char * q = p - 64; q < p; q += 8 )
+            acc = (acc << 8) | nparsy_swar_bin8( nparsy_load8(q) );
+         limbs[limb++] = acc;
+      }
+   }
+
+   // Whatever is left, one digit at a time
+   size_t bit = limb * 64u;
+   while ( p > d )
+   {
+      --p;
+      uint64_t val = nparsy_digit_val(*p);
+      size_t idx = bit / 64u;
+      unsigned off = (unsigned)(bit % 64u);
+
+      limbs[idx] |= val << off;
+      if ( ((off + bits) > 64u) && ((val >> (64u - off)) != 0u) )
+         limbs[idx + 1u] |= val >> (64u - off);
+
+      bit += bits;
+   }
+
+   return NParsy_GoodResult;
+}
+
+/**
+ * @brief Decimal: convert 19-digit blocks with the SWAR kernel, then combine
+ *        the blocks by divide-and-conquer.
+ */
+static enum NParsyResult nparsy_dec_to_limbs(
+      const struct Token * tok,
+      uint64_t * limbs,
+      size_t nlimbs,
+      size_t * limbs_used )
+{
+   const char * d = tok->digits;
+   size_t n = nparsy_strip_leading_zeros(&d, tok->ndigits);
+   size_t count = (n + NPARSY_DIGITS_PER_BLOCK - 1u) / NPARSY_DIGITS_PER_BLOCK;
+
+   // Blocks most significant first; only the first one may be short
+   uint64_t * blocks = malloc(2u * count * sizeof *blocks);
+   if ( blocks == nullptr )
+      return NParsy_OutOfMemory;
+   uint64_t * out = blocks + count;
+
+   size_t first_len = n - ((count - 1u) * NPARSY_DIGITS_PER_BLOCK);
+   const char * p = d;
+   for ( size_t i = 0; i < count; i++ )
+   {
+      size_t len = (i == 0u) ? first_len : NPARSY_DIGITS_PER_BLOCK;
+      size_t ndigits = 0;
+      bool overflow = false;
+      p = nparsy_dec_run(p, p + len, len, &blocks[i], &ndigits, &overflow);
+      assert( (ndigits == len) && !overflow );
+   }
+
+   struct DecPowers powers = { .npow = 0 };
+   bool ok = nparsy_dec_blocks_to_limbs(blocks, count, out, &powers);
+   for ( size_t k = 0; k < powers.npow; k++ )
+      free(powers.pow[k]);
+
+   enum NParsyResult result = NParsy_OutOfMemory;
+   if ( ok )
+   {
+      size_t used = count;
+      while ( (used > 1u) && (out[used - 1u] == 0u) )
+         --used;
+
+      *limbs_used = used;
+      result = NParsy_NumberOutOfRange;
+      if ( used <= nlimbs )
+      {
+         memcpy(limbs, out, used * sizeof limbs[0]);
+         result = NParsy_GoodResult;
+      }
+   }
+
+   free(blocks);
+   return result;
+}
+
+/**
+ * @brief value(blocks) = value(high blocks) * (10^19)^half + value(low half blocks)
+ * @param[out] out : count limbs
+ */
+static bool nparsy_dec_blocks_to_limbs(
+      const uint64_t * blocks,
+      size_t count,
+      uint64_t * out,
+      struct DecPowers * powers )
+{
+   if ( count <= NPARSY_DEC_DC_THRESHOLD )
+   {
+      // Horner's method is plenty fast for a few hundred digits
+      memset(out, 0, count * sizeof out[0]);
+      for ( size_t i = 0; i < count; i++ )
+      {
+         uint64_t carry = nparsy_mul_1(out, i + 1u, NPARSY_BLOCK_BASE, 0u);
+         assert( carry == 0u );
+         (void)carry;
+         (void)nparsy_add_1(out, i + 1u, blocks[i]);
+      }
+      return true;
+   }
+
+   size_t k = 0;
+   size_t half = 1;
+   while ( (half * 2u) < count )
+   {
+      half *= 2u;
+      ++k;
+   }
+   size_t high = count - half;
+
+   // Make sure (10^19)^half is available
+   while ( powers->npow <= k )
+   {
+      size_t len = (size_t)1 << powers->npow;
+      uint64_t * pw = malloc(len * sizeof *pw);
+      if ( pw == nullptr )
+         return false;
+
+      if ( powers->npow == 0u )
+         pw[0] = NPARSY_BLOCK_BASE;
+      else if ( !nparsy_karatsuba(pw, powers->pow[powers->npow - 1u], powers->pow[powers->npow - 1u], len / 2u) )
+      {
+         free(pw);
+         return false;
+      }
+      powers->pow[powers->npow++] = pw;
+   }
+
+   uint64_t * tmp = calloc(3u * half, sizeof *tmp);
+   if ( tmp == nullptr )
+      return false;
+   uint64_t * hi = tmp;           // half limbs, zero padded
+   uint64_t * prod = tmp + half;  // 2 * half limbs
+
+   bool ok = nparsy_dec_blocks_to_limbs(blocks, high, hi, powers)
+             && nparsy_dec_blocks_to_limbs(blocks + high, half, out, powers)
+             && nparsy_karatsuba(prod, hi, powers->pow[k], half);
+
+   if ( ok )
+   {
+      memset(out + half, 0, (count - half) * sizeof out[0]);
+      uint64_t carry = nparsy_add_n(out, out, prod, count);
+      assert( carry == 0u );
+      (void)carry;
+   }
+
+   free(tmp);
+   return ok;
+}
+
+/**
+ * @brief r[0, 2n) = a[0, n) * b[0, n), n a power of two.
+ */
+static bool nparsy_karatsuba(uint64_t * r, const uint64_t * a, const uint64_t * b, size_t n)
+{
+   if ( n <= NPARSY_KARATSUBA_THRESHOLD )
+   {
+      nparsy_mul_schoolbook(r, a, n, b, n);
+      return true;
+   }
+
+   size_t h = n / 2u;
+   uint64_t * tmp = malloc(((2u * h) + n + 1u) * sizeof *tmp);
+   if ( tmp == nullptr )
+      return false;
+   uint64_t * sa = tmp;          // a0 + a1
+   uint64_t * sb = tmp + h;      // b0 + b1
+   uint64_t * z1 = tmp + (2u * h); // (a0 + a1)(b0 + b1) - z0 - z2, n + 1 limbs
+
+   uint64_t ca = nparsy_add_n(sa, a, a + h, h);
+   uint64_t cb = nparsy_add_n(sb, b, b + h, h);
+
+   bool ok = nparsy_karatsuba(r, a, b, h)                // z0
+             && nparsy_karatsuba(r + n, a + h, b + h, h) // z2
+             && nparsy_karatsuba(z1, sa, sb, h);
+
+   if ( ok )
+   {
+      // Account for the carries out of the half sums
+      z1[n] = ca & cb;
+      if ( ca != 0u )
+         z1[n] += nparsy_add_n(z1 + h, z1 + h, sb, h);
+      if ( cb != 0u )
+         z1[n] += nparsy_add_n(z1 + h, z1 + h, sa, h);
+
+      z1[n] -= nparsy_sub_n(z1, z1, r, n);
+      z1[n] -= nparsy_sub_n(z1, z1, r + n, n);
+
+      uint64_t carry = nparsy_add_n(r + h, r + h, z1, n + 1u);
+      carry = nparsy_add_1(r + h + n + 1u, n - h - 1u, carry);
+      assert( carry == 0u );
+      (void)carry;
+   }
+
+   free(tmp);
+   return ok;
+}
+
+/**
+ * @brief r[0, an + bn) = a * b
+ */
+static void nparsy_mul_schoolbook(uint64_t * r, const uint64_t * a, size_t an, const uint64_t * b, size_t bn)
+{
+   memset(r, 0, (an + bn) * sizeof r[0]);
+
+   for ( size_t j = 0; j < bn; j++ )
+   {
+      uint64_t carry = 0;
+      for ( size_t i = 0; i < an; i++ )
+      {
+         uint64_t hi = 0;
+         uint64_t lo = nparsy_mul_64x64(a[i], b[j], &hi);
+         hi += ckd_add(&lo, lo, carry);
+         hi += ckd_add(&r[i + j], r[i + j], lo);
+         carry = hi;
+      }
+      r[an + j] = carry;
+   }
+}
+
+/**
+ * @brief r[0, n) = r * m + carry, returning the carry out.
+ */
+static uint64_t nparsy_mul_1(uint64_t * r, size_t n, uint64_t m, uint64_t carry)
+{
+   for ( size_t i = 0; i < n; i++ )
+   {
+      uint64_t hi = 0;
+      uint64_t lo = nparsy_mul_64x64(r[i], m, &hi);
+      hi += ckd_add(&r[i], lo, carry);
+      carry = hi;
+   }
+   return carry;
+}
+
+static uint64_t nparsy_add_n(uint64_t * r, const uint64_t * a, const uint64_t * b, size_t n)
+{
+   uint64_t carry = 0;
+   for ( size_t i = 0; i < n; i++ )
+   {
+      uint64_t sum = 0;
+      uint64_t c1 = ckd_add(&sum, a[i], b[i]);
+      uint64_t c2 = ckd_add(&r[i], sum, carry);
+      carry = c1 | c2;
+   }
+   return carry;
+}
+
+static uint64_t nparsy_sub_n(uint64_t * r, const uint64_t * a, const uint64_t * b, size_t n)
+{
+   uint64_t borrow = 0;
+   for ( size_t i = 0; i < n; i++ )
+   {
+      uint64_t diff = 0;
+      uint64_t b1 = ckd_sub(&diff, a[i], b[i]);
+      uint64_t b2 = ckd_sub(&r[i], diff, borrow);
+      borrow = b1 | b2;
+   }
+   return borrow;
+}
+
+static uint64_t nparsy_add_1(uint64_t * r, size_t n, uint64_t b)
+{
+   for ( size_t i = 0; (i < n) && (b != 0u); i++ )
+      b = ckd_add(&r[i], r[i], b);
+   return b;
+}
+
+static inline uint64_t nparsy_mul_64x64(uint64_t a, uint64_t b, uint64_t * hi)
+{
+#ifdef __SIZEOF_INT128__
+   nparsy_u128_t prod = (nparsy_u128_t)a * b;
+   *hi = (uint64_t)(prod >> 64);
+   return (uint64_t)prod;
+#else
+   uint64_t a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+   uint64_t b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+   uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+   uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+   *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+   return (mid << 32) | (ll & 0xFFFFFFFFu);
+#endif
+}
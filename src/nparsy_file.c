@@ -0,0 +1,143 @@
+/*!
+ * @file    nparsy_file.c
+ * @brief   Implementation of NParsy's memory-mapped file parsing.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* Feature Test Macros */
+// mmap/madvise, MAP_POPULATE, and O_CLOEXEC are hidden under a strict -std
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "nparsy_file.h"
+#include "nparsy_kernels.h"
+
+/* Local Macro Definitions */
+#ifdef MAP_POPULATE
+#define NPARSY_MMAP_FLAGS  (MAP_PRIVATE | MAP_POPULATE) // Pre-fault the pages in one go
+#else
+#define NPARSY_MMAP_FLAGS  (MAP_PRIVATE)
+#endif
+
+/* Datatypes */
+
+/* Local Data */
+
+/*** Private Function Prototypes ***/
+static size_t nparsy_uint_list_span(
+      const char * p,
+      const char * end,
+      uint64_t * buf,
+      size_t len,
+      enum NParsyNumFormat default_fmt );
+
+/* Public Function Implementations */
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntFile(
+      const char * path,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt )
+{
+   // Initial input validation
+   if ( path == nullptr )
+      return NParsy_InvalidString;
+   else if ( buf == nullptr )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+
+   int fd = open(path, O_RDONLY | O_CLOEXEC);
+   if ( fd < 0 )
+      return NParsy_FileAccessFailed;
+
+   enum NParsyResult result = NParsyUIntFd(fd, buf, len, num_parsed, default_fmt);
+   (void)close(fd);
+
+   return result;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntFd(
+      int fd,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt )
+{
+   // Initial input validation
+   if ( buf == nullptr )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+
+   struct stat st;
+   if ( (fd < 0) || (fstat(fd, &st) != 0) || !S_ISREG(st.st_mode)
+        || ((uintmax_t)st.st_size > (uintmax_t)SIZE_MAX) )
+      return NParsy_FileAccessFailed;
+
+   size_t fsize = (size_t)st.st_size;
+   size_t nparsed = 0;
+
+   // Nothing to map for an empty file (mmap rejects a zero length)
+   if ( fsize > 0u )
+   {
+      void * map = mmap(nullptr, fsize, PROT_READ, NPARSY_MMAP_FLAGS, fd, 0);
+      if ( map == MAP_FAILED )
+         return NParsy_FileAccessFailed;
+
+      // Advisory only; a failure here just means the kernel reads ahead less
+      (void)madvise(map, fsize, MADV_SEQUENTIAL);
+
+      const char * p = map;
+      nparsed = nparsy_uint_list_span(p, p + fsize, buf, len, default_fmt);
+
+      (void)munmap(map, fsize);
+   }
+
+   if ( num_parsed != nullptr )
+      *num_parsed = nparsed;
+
+   return NParsy_GoodResult;
+}
+
+/*** Private Function Implementations ***/
+
+/**
+ * @brief NParsyUIntList over [p, end) - no null terminator involved.
+ * @return how many results were placed in buf
+ */
+static size_t nparsy_uint_list_span(
+      const char * p,
+      const char * end,
+      uint64_t * buf,
+      size_t len,
+      enum NParsyNumFormat default_fmt )
+{
+   const char * begin = p;
+   size_t nparsed = 0;
+
+   // Out-of-range numbers are skipped, just like NParsyUIntList
+   while ( (nparsed < len) && nparsy_next_u64(begin, &p, end, default_fmt, &buf[nparsed]) )
+      ++nparsed;
+
+   return nparsed;
+}
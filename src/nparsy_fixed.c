@@ -0,0 +1,237 @@
+/*!
+ * @file    nparsy_fixed.c
+ * @brief   Implementation of NParsy's fixed-point decimal parsing.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdckdint.h>
+
+#include "nparsy_fixed.h"
+#include "nparsy_kernels.h"
+
+/* Local Macro Definitions */
+
+/* Datatypes */
+
+/* Local Data */
+
+/*** Private Function Prototypes ***/
+static const char * nparsy_find_fixed_start(const char * p, const char * end);
+static enum NParsyResult nparsy_fixed_at(
+      const char * p,
+      const char * end,
+      uint8_t scale,
+      enum NParsyRoundingPolicy rounding,
+      int64_t * parsed_val,
+      const char ** next );
+
+/* Public Function Implementations */
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyFixed(
+      const char * str,
+      uint8_t scale,
+      int64_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyRoundingPolicy rounding )
+{
+   size_t slen = 0;
+
+   // Initial input validation
+   if ( str == nullptr || !nparsy_bounded_strlen(str, &slen) )
+      return NParsy_InvalidString;
+   else if ( parsed_val == nullptr )
+      return NParsy_NullPtr;
+   else if ( scale > NPARSY_MAX_FIXED_SCALE )
+      return NParsy_InvalidScale;
+   else if ( (int)rounding < 0 || (int)rounding >= (int)NParsy_NumOfRoundingPolicies )
+      return NParsy_InvalidRoundingPolicy;
+
+   const char * end = str + slen;
+   const char * start = nparsy_find_fixed_start(str, end);
+   const char * next = end;
+   enum NParsyResult result = NParsy_NoNumberFound;
+
+   if ( start != end )
+      result = nparsy_fixed_at(start, end, scale, rounding, parsed_val, &next);
+
+   if ( accumulated_strlen != nullptr )
+      *accumulated_strlen = (size_t)(next - str);
+
+   return result;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyFixedList(
+      const char * str,
+      uint8_t scale,
+      int64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyRoundingPolicy rounding )
+{
+   size_t slen = 0;
+
+   // Initial input validation
+   if ( str == nullptr || !nparsy_bounded_strlen(str, &slen) )
+      return NParsy_InvalidString;
+   else if ( buf == nullptr )
+      return NParsy_NullPtr;
+   else if ( scale > NPARSY_MAX_FIXED_SCALE )
+      return NParsy_InvalidScale;
+   else if ( (int)rounding < 0 || (int)rounding >= (int)NParsy_NumOfRoundingPolicies )
+      return NParsy_InvalidRoundingPolicy;
+
+   const char * p = str;
+   const char * end = str + slen;
+   size_t nparsed = 0;
+
+   while ( nparsed < len )
+   {
+      p = nparsy_find_fixed_start(p, end);
+      if ( p == end )
+         break;
+
+      int64_t val = 0;
+      if ( nparsy_fixed_at(p, end, scale, rounding, &val, &p) == NParsy_GoodResult )
+         buf[nparsed++] = val;
+      // Out-of-range numbers are skipped, just like NParsyUIntList
+   }
+
+   if ( num_parsed != nullptr )
+      *num_parsed = nparsed;
+
+   return NParsy_GoodResult;
+}
+
+/*** Private Function Implementations ***/
+
+/**
+ * @brief Find the first char that begins [+|-]digit or [+|-].digit
+ * @return end if nothing was found
+ */
+static const char * nparsy_find_fixed_start(const char * p, const char * end)
+{
+   for ( ; p < end; ++p )
+   {
+      const char * q = p;
+
+      if ( (*q == '-' || *q == '+') )
+         ++q;
+      if ( (q < end) && (*q == '.') )
+         ++q;
+
+      if ( (q < end) && nparsy_is_dec_digit(*q) )
+         return p;
+   }
+
+   return end;
+}
+
+/**
+ * @brief Convert the number starting at p (as located by nparsy_find_fixed_start).
+ * @note The integer and fractional digit runs both go through the SWAR
+ *       decimal kernel; the fractional run is capped at scale digits so the
+ *       kernel never converts digits that would just be thrown away.
+ */
+static enum NParsyResult nparsy_fixed_at(
+      const char * p,
+      const char * end,
+      uint8_t scale,
+      enum NParsyRoundingPolicy rounding,
+      int64_t * parsed_val,
+      const char ** next )
+{
+   assert( (p != nullptr) && (p < end) && (parsed_val != nullptr) && (next != nullptr) );
+   assert( scale <= NPARSY_MAX_FIXED_SCALE );
+
+   bool negative = false;
+   if ( (*p == '-') || (*p == '+') )
+   {
+      negative = (*p == '-');
+      ++p;
+   }
+
+   // Integer half
+   uint64_t int_part = 0;
+   size_t int_digits = 0;
+   bool overflow = false;
+   p = nparsy_dec_run(p, end, SIZE_MAX, &int_part, &int_digits, &overflow);
+
+   // Fractional half
+   uint64_t frac_part = 0;
+   size_t frac_digits = 0;
+   unsigned round_digit = 0;
+   bool sticky = false; // any non-zero digit past the round digit?
+   bool has_frac = (end - p) >= 2 && (*p == '.') && nparsy_is_dec_digit(p[1]);
+   if ( has_frac )
+   {
+      bool frac_overflow = false;
+      p = nparsy_dec_run(p + 1, end, scale, &frac_part, &frac_digits, &frac_overflow);
+      assert( !frac_overflow ); // scale <= 18 digits always fits
+
+      if ( (p < end) && nparsy_is_dec_digit(*p) )
+      {
+         round_digit = (unsigned)(*p - '0');
+         for ( ++p; (p < end) && nparsy_is_dec_digit(*p); ++p )
+            sticky = sticky || (*p != '0');
+      }
+   }
+   // At scale 0, a lone fractional digit (".5") only lands in round_digit
+   assert( (int_digits > 0u) || has_frac );
+
+   *next = p;
+
+   // Scale up and combine the two halves
+   uint64_t magnitude = 0;
+   overflow = overflow
+              || ckd_mul(&magnitude, int_part, nparsy_pow10[scale])
+              || ckd_add(&magnitude, magnitude, frac_part * nparsy_pow10[scale - frac_digits]);
+
+   bool round_up = false;
+   switch ( rounding )
+   {
+      case NParsy_Truncate:
+         break;
+
+      case NParsy_RoundHalfAwayFromZero:
+         round_up = (round_digit >= 5u);
+         break;
+
+      case NParsy_RoundHalfEven:
+         round_up = (round_digit > 5u)
+                    || ( (round_digit == 5u) && (sticky || ((magnitude & 1u) != 0u)) );
+         break;
+
+      case NParsy_NumOfRoundingPolicies:
+      default:
+         assert(false); // Validated by the public functions
+         break;
+   }
+   if ( round_up )
+      overflow = overflow || ckd_add(&magnitude, magnitude, 1u);
+
+   // The negative range reaches one further than the positive range
+   constexpr uint64_t INT64_MAG_LIMIT = (uint64_t)INT64_MAX + 1u;
+   if ( overflow || (magnitude > INT64_MAG_LIMIT) || (!negative && magnitude == INT64_MAG_LIMIT) )
+      return NParsy_NumberOutOfRange;
+
+   if ( !negative )
+      *parsed_val = (int64_t)magnitude;
+   else if ( magnitude == INT64_MAG_LIMIT )
+      *parsed_val = INT64_MIN;
+   else
+      *parsed_val = -(int64_t)magnitude;
+
+   return NParsy_GoodResult;
+}
@@ -0,0 +1,271 @@
+/*!
+ * @file    nparsy_float_column.c
+ * @brief   Implementation of NParsy's fixed-width floating-point column parsing.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "nparsy_float.h"
+#include "nparsy_kernels.h"
+
+/* Local Macro Definitions */
+// Stamp out the column parser for one result type. Each gets its own copy of
+// the batch loop with the type's exactness limits, power table, and strto*
+// fallback folded in as constants. The fallback only ever sees the
+// locale-free text nparsy_dec_canon writes.
+#define NPARSY_DEFINE_COLUMN_PARSER(name, type, max_mantissa, pow10, strto) \
+   [[nodiscard]]                                                          \
+   enum NParsyResult name(                                                \
+         const char * buf,                                                \
+         size_t buflen,                                                   \
+         const struct NParsyColumnLayout * layout,                        \
+         type * out,                                                      \
+         size_t len,                                                      \
+         size_t * num_parsed )                                            \
+   {                                                                      \
+      struct ColumnPlan plan;                                             \
+                                                                          \
+      /* Initial input validation */                                      \
+      if ( buf == nullptr )                                               \
+         return NParsy_InvalidString;                                     \
+      else if ( out == nullptr || layout == nullptr )                     \
+         return NParsy_NullPtr;                                           \
+      else if ( !nparsy_column_plan(layout, &plan) )                      \
+         return NParsy_InvalidColumnLayout;                               \
+                                                                          \
+      size_t nrows = nparsy_column_rows(&plan, buflen);                   \
+      if ( nrows > len )                                                  \
+         nrows = len;                                                     \
+                                                                          \
+      /* Division is only correctly rounded while the power of ten is */  \
+      /* exact, otherwise every row goes through the strto* fallback  */  \
+      plan.fast = plan.fast                                               \
+                  && (plan.frac_digits < (sizeof (pow10) / sizeof (pow10)[0])); \
+                                                                          \
+      enum NParsyResult result = NParsy_GoodResult;                       \
+      size_t row = 0;                                                     \
+      while ( row < nrows )                                               \
+      {                                                                   \
+         size_t batch = (nrows - row) < NPARSY_COLUMN_BATCH ? (nrows - row) \
+                                                            : NPARSY_COLUMN_BATCH; \
+         const char * first = buf + (row * plan.stride) + plan.offset;    \
+         uint64_t mantissa[NPARSY_COLUMN_BATCH] = {0};                    \
+         bool negative[NPARSY_COLUMN_BATCH] = {0};                        \
+         bool fast[NPARSY_COLUMN_BATCH] = {0};                            \
+                                                                          \
+         for ( size_t k = 0; k < batch; k++ )                             \
+            fast[k] = plan.fast                                           \
+                      && nparsy_column_field_fast(&plan, first + (k * plan.stride), \
+                                                  &mantissa[k], &negative[k]) \
+                      && (mantissa[k] <= (max_mantissa));                 \
+                                                                          \
+         for ( size_t k = 0; k < batch; k++ )                             \
+         {                                                                \
+            if ( fast[k] )                                                \
+            {                                                             \
+               type val = (type)mantissa[k] / (pow10)[plan.frac_digits];  \
+               out[row + k] = negative[k] ? -val : val;                   \
+               continue;                                                  \
+            }                                                             \
+                                                                          \
+            /* Per-value fallback for rows that deviate from the layout */ \
+            const char * field = first + (k * plan.stride);               \
+            const char * field_end = field + plan.width;                  \
+            char canon[NPARSY_DEC_CANON_LEN];                             \
+            char * endp = nullptr;                                        \
+            type val = 0;                                                 \
+            nparsy_column_field_trim(&field, &field_end);                 \
+            if ( nparsy_dec_canon(field, field_end, false, canon) )       \
+               val = strto(canon, &endp);                                 \
+                                                                          \
+            if ( endp == nullptr || *endp != '\0' )                       \
+            {                                                             \
+               result = NParsy_ColumnRowMismatch;                         \
+               nrows = row + k;                                           \
+               break;                                                     \
+            }                                                             \
+            out[row + k] = val;                                           \
+         }                                                                \
+                                                                          \
+         row += batch;                                                    \
+         if ( row > nrows )                                               \
+            row = nrows;                                                  \
+      }                                                                   \
+                                                                          \
+      if ( num_parsed != nullptr )                                        \
+         *num_parsed = nrows;                                             \
+                                                                          \
+      return result;                                                      \
+   }
+
+/* Datatypes */
+// What the layout boils down to once validated
+struct ColumnPlan
+{
+   size_t offset;
+   size_t stride;
+   size_t width;
+   size_t int_chars;   // chars before the '.'
+   size_t frac_digits; // digits after the '.'
+   bool fast;          // narrow enough for the packed 16-char fast path?
+};
+
+/* Local Data */
+// Rows classified and converted together per iteration. The fast path keeps
+// no state between rows of a batch so the compiler is free to interleave them.
+constexpr size_t NPARSY_COLUMN_BATCH = 4u;
+
+// Limits within which (double)mantissa / 10^frac (or the float equivalent)
+// is correctly rounded
+constexpr uint64_t NPARSY_MAX_EXACT_DBL_MANTISSA = 1ull << 53;
+constexpr uint64_t NPARSY_MAX_EXACT_FLT_MANTISSA = 1ull << 24;
+
+/*** Private Function Prototypes ***/
+static bool nparsy_column_plan(const struct NParsyColumnLayout * layout, struct ColumnPlan * plan);
+static size_t nparsy_column_rows(const struct ColumnPlan * plan, size_t buflen);
+static inline bool nparsy_column_field_fast(
+      const struct ColumnPlan * plan,
+      const char * field,
+      uint64_t * mantissa,
+      bool * negative );
+static void nparsy_column_field_trim(const char ** field, const char ** field_end);
+
+/* Public Function Implementations */
+
+/******************************************************************************/
+NPARSY_DEFINE_COLUMN_PARSER( NParsyDoubleColumn, double, NPARSY_MAX_EXACT_DBL_MANTISSA, nparsy_pow10_dbl, strtod )
+NPARSY_DEFINE_COLUMN_PARSER( NParsyFloatColumn,  float,  NPARSY_MAX_EXACT_FLT_MANTISSA, nparsy_pow10_flt, strtof )
+
+/*** Private Function Implementations ***/
+
+/**
+ * @brief Validate the layout and work out the per-row constants.
+ */
+static bool nparsy_column_plan(const struct NParsyColumnLayout * layout, struct ColumnPlan * plan)
+{
+   assert( (layout != nullptr) && (plan != nullptr) );
+
+   if (   layout->width == 0
+       || layout->decimal_pos >= layout->width
+       || layout->stride == 0
+       || layout->offset > layout->stride
+       || layout->width > (layout->stride - layout->offset) )
+   {
+      return false;
+   }
+
+   plan->offset = layout->offset;
+   plan->stride = layout->stride;
+   plan->width = layout->width;
+   plan->int_chars = layout->decimal_pos;
+   plan->frac_digits = layout->width - layout->decimal_pos - 1u;
+   plan->fast = (layout->width <= NPARSY_MAX_FAST_COLUMN_WIDTH) && (plan->int_chars > 0);
+
+   return true;
+}
+
+/**
+ * @brief How many complete fields are in the buffer.
+ */
+static size_t nparsy_column_rows(const struct ColumnPlan * plan, size_t buflen)
+{
+   if ( buflen < (plan->offset + plan->width) )
+      return 0;
+
+   return ((buflen - plan->offset - plan->width) / plan->stride) + 1u;
+}
+
+/**
+ * @brief Fast path: check the field against the layout and convert its digits.
+ * @note The integer and fractional digits are packed, right-aligned and without
+ *       the '.', into 16 space-filled chars. A matching field then reads as
+ *       spaces, an optional sign, and nothing but digits after that, which two
+ *       SWAR words can both validate and convert.
+ * @return false if the field deviates from the layout
+ */
+static inline bool nparsy_column_field_fast(
+      const struct ColumnPlan * plan,
+      const char * field,
+      uint64_t * mantissa,
+      bool * negative )
+{
+   constexpr size_t PACKED_LEN = 16u;
+   assert( (plan->int_chars + plan->frac_digits) <= PACKED_LEN );
+
+   if ( field[plan->int_chars] != '.' )
+      return false;
+
+   char packed[PACKED_LEN];
+   memset(packed, ' ', PACKED_LEN);
+   memcpy(packed + PACKED_LEN - plan->frac_digits - plan->int_chars, field, plan->int_chars);
+   memcpy(packed + PACKED_LEN - plan->frac_digits, field + plan->int_chars + 1u, plan->frac_digits);
+
+   uint64_t hi = nparsy_load8(packed);      // most significant 8 chars
+   uint64_t lo = nparsy_load8(packed + 8u); // least significant 8 chars
+   uint64_t hi_nd = nparsy_swar_non_digits(hi);
+   uint64_t lo_nd = nparsy_swar_non_digits(lo);
+
+   // The non-digits must be a prefix of the packed chars, leaving at least one
+   // integer digit before the fraction.
+   unsigned nnd = (unsigned)(__builtin_popcountll(hi_nd) + __builtin_popcountll(lo_nd));
+   if ( nnd >= (PACKED_LEN - plan->frac_digits) )
+      return false;
+
+   uint64_t hi_want = (nnd >= 8u) ? NPARSY_SWAR_HIGHBITS
+                                  : (NPARSY_SWAR_HIGHBITS & ((1ull << (8u * nnd)) - 1u));
+   uint64_t lo_want = (nnd <= 8u) ? 0u
+                                  : (NPARSY_SWAR_HIGHBITS & ((1ull << (8u * (nnd - 8u))) - 1u));
+   if ( (hi_nd != hi_want) || (lo_nd != lo_want) )
+      return false;
+
+   // ... and all of them spaces, except possibly a sign right before the digits
+   uint64_t hi_odd = hi_nd & ~nparsy_swar_eq(hi, ' ');
+   uint64_t lo_odd = lo_nd & ~nparsy_swar_eq(lo, ' ');
+   *negative = false;
+   if ( (hi_odd | lo_odd) != 0u )
+   {
+      unsigned sign_idx = nnd - 1u;
+      char sign = packed[sign_idx];
+      uint64_t sign_bit = 0x80ull << (8u * (sign_idx % 8u));
+      bool sign_only = (sign_idx < 8u) ? ((hi_odd == sign_bit) && (lo_odd == 0u))
+                                       : ((hi_odd == 0u) && (lo_odd == sign_bit));
+      if ( !sign_only || ((sign != '-') && (sign != '+')) )
+         return false;
+
+      *negative = (sign == '-');
+   }
+
+   // Turn the padding and sign into leading zeros and convert
+   uint64_t hi_fill = (hi_nd >> 7) * 0xFFu;
+   uint64_t lo_fill = (lo_nd >> 7) * 0xFFu;
+   hi = (hi & ~hi_fill) | (NPARSY_SWAR_ZEROS & hi_fill);
+   lo = (lo & ~lo_fill) | (NPARSY_SWAR_ZEROS & lo_fill);
+
+   *mantissa = ((uint64_t)nparsy_swar_dec8(hi) * nparsy_pow10[8]) + nparsy_swar_dec8(lo);
+   return true;
+}
+
+/**
+ * @brief Narrow [*field, *field_end) to what's between its space padding.
+ */
+static void nparsy_column_field_trim(const char ** field, const char ** field_end)
+{
+   const char * first = *field;
+   const char * last = *field_end;
+
+   while ( (first < last) && (*first == ' ') )
+      ++first;
+   while ( (last > first) && (last[-1] == ' ') )
+      --last;
+
+   *field = first;
+   *field_end = last;
+}
@@ -0,0 +1,394 @@
+/*!
+ * @file    nparsy_iov.c
+ * @brief   Implementation of NParsy's scatter/gather (iovec) and ring buffer parsing.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "nparsy_iov.h"
+#include "nparsy_kernels.h"
+
+/* Local Macro Definitions */
+
+/* Datatypes */
+// The number cut off at the end of a segment, plus enough of what follows
+// it to finish scanning it
+struct IovCarry
+{
+   char buf[2u * NPARSY_IOV_CARRY_LEN];
+};
+
+/* Local Data */
+
+/*** Private Function Prototypes ***/
+static enum NParsyResult nparsy_iov_validate(
+      const struct iovec * iov,
+      size_t iovcnt,
+      size_t first_seg,
+      bool have_out,
+      enum NParsyNumFormat default_fmt );
+static bool nparsy_iov_next_token(
+      const struct iovec * iov,
+      size_t iovcnt,
+      bool eof,
+      struct NParsyIovCursor * cur,
+      enum NParsyNumFormat default_fmt,
+      struct IovCarry * carry,
+      struct Token * tok );
+static enum ScanStatus nparsy_iov_stitch(
+      const struct iovec * iov,
+      size_t iovcnt,
+      bool eof,
+      struct NParsyIovCursor * cur,
+      enum NParsyNumFormat default_fmt,
+      struct IovCarry * carry,
+      struct Token * tok );
+static void nparsy_iov_advance(const struct iovec * iov, size_t iovcnt, struct NParsyIovCursor * cur, size_t n);
+static bool nparsy_iov_skip_token_tail(
+      const struct iovec * iov,
+      size_t iovcnt,
+      bool eof,
+      struct NParsyIovCursor * cur );
+static void nparsy_iov_next_seg(const struct iovec * iov, struct NParsyIovCursor * cur);
+static bool nparsy_iov_rest_empty(const struct iovec * iov, size_t iovcnt, size_t seg);
+
+/* Public Function Implementations */
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntIov(
+      const struct iovec * iov,
+      size_t iovcnt,
+      uint64_t * parsed_val,
+      struct NParsyIovCursor * cursor,
+      enum NParsyNumFormat default_fmt )
+{
+   struct NParsyIovCursor start = { 0 };
+   struct NParsyIovCursor * cur = (cursor != nullptr) ? cursor : &start;
+
+   enum NParsyResult result = nparsy_iov_validate(iov, iovcnt, cur->seg, (parsed_val != nullptr), default_fmt);
+   if ( result != NParsy_GoodResult )
+      return result;
+
+   struct IovCarry carry;
+   struct Token tok;
+
+   result = NParsy_NoNumberFound;
+   while ( nparsy_iov_next_token(iov, iovcnt, true, cur, default_fmt, &carry, &tok) )
+   {
+      if ( tok.kind != Token_UInt )
+         continue;
+
+      result = nparsy_token_to_u64(&tok, parsed_val) ? NParsy_GoodResult : NParsy_NumberOutOfRange;
+      break;
+   }
+
+   return result;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyU64ListIov(
+      const struct iovec * iov,
+      size_t iovcnt,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt )
+{
+   enum NParsyResult result = nparsy_iov_validate(iov, iovcnt, 0, (buf != nullptr), default_fmt);
+   if ( result != NParsy_GoodResult )
+      return result;
+
+   struct NParsyIovCursor cur = { 0 };
+   struct IovCarry carry;
+   struct Token tok;
+   size_t n = 0;
+
+   while ( (n < len) && nparsy_iov_next_token(iov, iovcnt, true, &cur, default_fmt, &carry, &tok) )
+   {
+      // Negatives, floats, malformed, and out-of-range numbers are skipped
+      if ( (tok.kind == Token_UInt) && nparsy_token_to_u64(&tok, &buf[n]) )
+         n++;
+   }
+
+   if ( num_parsed != nullptr )
+      *num_parsed = n;
+
+   return NParsy_GoodResult;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyU64ListRing(
+      const char * base,
+      size_t capacity,
+      size_t head,
+      size_t tail,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      size_t * consumed,
+      enum NParsyNumFormat default_fmt )
+{
+   // Initial input validation
+   if ( base == nullptr )
+      return NParsy_InvalidString;
+   else if ( (buf == nullptr) || (consumed == nullptr) )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+   else if ( (capacity == 0u) || (head >= capacity) || (tail >= capacity) )
+      return NParsy_InvalidRingBuffer;
+
+   // [tail, end of storage) then [start of storage, head) once wrapped
+   bool wrapped = (head < tail);
+   struct iovec iov[2] =
+   {
+      { .iov_base = (void *)(base + tail), .iov_len = (wrapped ? capacity : head) - tail },
+      { .iov_base = (void *)base,          .iov_len = wrapped ? head : 0u },
+   };
+
+   struct NParsyIovCursor cur = { 0 };
+   struct IovCarry carry;
+   struct Token tok;
+   size_t n = 0;
+
+   while ( (n < len) && nparsy_iov_next_token(iov, 2u, false, &cur, default_fmt, &carry, &tok) )
+   {
+      // Negatives, floats, malformed, and out-of-range numbers are skipped
+      if ( (tok.kind == Token_UInt) && nparsy_token_to_u64(&tok, &buf[n]) )
+         n++;
+   }
+
+   if ( num_parsed != nullptr )
+      *num_parsed = n;
+   *consumed = (cur.seg == 0u) ? cur.off : (iov[0].iov_len + ((cur.seg == 1u) ? cur.off : iov[1].iov_len));
+
+   return NParsy_GoodResult;
+}
+
+/*** Private Function Implementations ***/
+
+static enum NParsyResult nparsy_iov_validate(
+      const struct iovec * iov,
+      size_t iovcnt,
+      size_t first_seg,
+      bool have_out,
+      enum NParsyNumFormat default_fmt )
+{
+   if ( (iov == nullptr) && (iovcnt > 0u) )
+      return NParsy_InvalidString;
+   else if ( !have_out )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+
+   for ( size_t i = first_seg; i < iovcnt; i++ )
+   {
+      if ( (iov[i].iov_base == nullptr) && (iov[i].iov_len > 0u) )
+         return NParsy_InvalidString;
+   }
+
+   return NParsy_GoodResult;
+}
+
+/**
+ * @brief Find the next token at or after cur and move cur past it.
+ * @note tok may point into carry, so carry has to outlive any use of tok.
+ * @param[in] eof : whether the input ends with the last segment. If not, a
+ *                  number the last segment ends in may be incomplete, so it's
+ *                  left for later: cur stops at its start.
+ * @return false once nothing (complete) is left
+ */
+static bool nparsy_iov_next_token(
+      const struct iovec * iov,
+      size_t iovcnt,
+      bool eof,
+      struct NParsyIovCursor * cur,
+      enum NParsyNumFormat default_fmt,
+      struct IovCarry * carry,
+      struct Token * tok )
+{
+   while ( cur->seg < iovcnt )
+   {
+      const char * base = iov[cur->seg].iov_base;
+      size_t seg_len = iov[cur->seg].iov_len;
+      if ( cur->off >= seg_len )
+      {
+         nparsy_iov_next_seg(iov, cur);
+         continue;
+      }
+
+      const char * p = base + cur->off;
+      const char * end = base + seg_len;
+      bool at_eof = eof && nparsy_iov_rest_empty(iov, iovcnt, cur->seg);
+      enum ScanStatus st = nparsy_next_token(p, end, (cur->off > 0u) ? p[-1] : cur->prev, at_eof, default_fmt, tok);
+
+      if ( st == Scan_Found )
+      {
+         cur->off = (size_t)(tok->end - base);
+         return true;
+      }
+      else if ( st == Scan_None )
+      {
+         nparsy_iov_next_seg(iov, cur);
+      }
+      else
+      {
+         cur->off = (size_t)(tok->begin - base);
+         st = nparsy_iov_stitch(iov, iovcnt, eof, cur, default_fmt, carry, tok);
+         if ( st != Scan_None )
+            return (st == Scan_Found);
+      }
+   }
+
+   return false;
+}
+
+/**
+ * @brief Finish scanning a token cut off at the end of the current segment,
+ *        by copying it and the start of the following segments into carry.
+ * @note cur is at the start of the cut-off token.
+ * @return Scan_Found if a token starting in the current segment was found,
+ *         Scan_NeedMore if it runs into the end of input that isn't eof (cur
+ *         stays at its start), or Scan_None if cur has moved on and scanning
+ *         carries on from there.
+ */
+static enum ScanStatus nparsy_iov_stitch(
+      const struct iovec * iov,
+      size_t iovcnt,
+      bool eof,
+      struct NParsyIovCursor * cur,
+      enum NParsyNumFormat default_fmt,
+      struct IovCarry * carry,
+      struct Token * tok )
+{
+   const char * base = iov[cur->seg].iov_base;
+   size_t head = iov[cur->seg].iov_len - cur->off;
+   char before = (cur->off > 0u) ? base[cur->off - 1u] : cur->prev;
+
+   if ( head > NPARSY_IOV_CARRY_LEN )
+      return nparsy_iov_skip_token_tail(iov, iovcnt, eof, cur) ? Scan_None : Scan_NeedMore;
+
+   memcpy(carry->buf, base + cur->off, head);
+   size_t n = head;
+   bool all_in = true; // whether the rest of the input all fit in carry
+   for ( size_t s = cur->seg + 1u; s < iovcnt; s++ )
+   {
+      size_t take = sizeof carry->buf - n;
+      if ( iov[s].iov_len < take )
+         take = iov[s].iov_len;
+      if ( take > 0u )
+         memcpy(carry->buf + n, iov[s].iov_base, take);
+      n += take;
+      if ( take < iov[s].iov_len )
+      {
+         all_in = false;
+         break;
+      }
+   }
+
+   enum ScanStatus st = nparsy_next_token(carry->buf, carry->buf + n, before, all_in && eof, default_fmt, tok);
+   size_t tok_off = (st == Scan_None) ? n : (size_t)(tok->begin - carry->buf);
+
+   if ( tok_off >= head )
+   {
+      // Nothing starts in this segment after all
+      nparsy_iov_next_seg(iov, cur);
+      return Scan_None;
+   }
+
+   cur->off += tok_off;
+   if ( (st == Scan_NeedMore) && all_in )
+      return Scan_NeedMore; // The rest of it hasn't arrived yet
+   else if ( st == Scan_NeedMore )
+   {
+      // Longer than any carry could hold
+      return nparsy_iov_skip_token_tail(iov, iovcnt, eof, cur) ? Scan_None : Scan_NeedMore;
+   }
+
+   nparsy_iov_advance(iov, iovcnt, cur, (size_t)(tok->end - tok->begin));
+   return Scan_Found;
+}
+
+/**
+ * @brief Move cur n chars forward, across segments as needed.
+ */
+static void nparsy_iov_advance(const struct iovec * iov, size_t iovcnt, struct NParsyIovCursor * cur, size_t n)
+{
+   while ( cur->seg < iovcnt )
+   {
+      size_t avail = iov[cur->seg].iov_len - cur->off;
+      if ( n < avail )
+      {
+         cur->off += n;
+         return;
+      }
+      n -= avail;
+      nparsy_iov_next_seg(iov, cur);
+   }
+}
+
+/**
+ * @brief Skip an overly long number, starting from its first char.
+ * @return false if the input ends inside it and isn't eof, in which case the
+ *         rest of it may still arrive and cur stays at its start
+ */
+static bool nparsy_iov_skip_token_tail(
+      const struct iovec * iov,
+      size_t iovcnt,
+      bool eof,
+      struct NParsyIovCursor * cur )
+{
+   const struct NParsyIovCursor start = *cur;
+
+   nparsy_iov_advance(iov, iovcnt, cur, 1u); // Past any sign or prefix
+   while ( cur->seg < iovcnt )
+   {
+      const char * base = iov[cur->seg].iov_base;
+      size_t seg_len = iov[cur->seg].iov_len;
+      while ( (cur->off < seg_len) && (nparsy_is_alnum(base[cur->off]) || (base[cur->off] == '.')) )
+         cur->off++;
+      if ( cur->off < seg_len )
+         return true;
+      nparsy_iov_next_seg(iov, cur);
+   }
+
+   if ( !eof )
+   {
+      *cur = start;
+      return false;
+   }
+
+   return true;
+}
+
+static void nparsy_iov_next_seg(const struct iovec * iov, struct NParsyIovCursor * cur)
+{
+   size_t seg_len = iov[cur->seg].iov_len;
+   if ( seg_len > 0u )
+      cur->prev = ((const char *)iov[cur->seg].iov_base)[seg_len - 1u];
+   cur->seg++;
+   cur->off = 0;
+}
+
+/**
+ * @brief Whether every segment after seg is empty, i.e., seg ends the input.
+ */
+static bool nparsy_iov_rest_empty(const struct iovec * iov, size_t iovcnt, size_t seg)
+{
+   for ( size_t s = seg + 1u; s < iovcnt; s++ )
+   {
+      if ( iov[s].iov_len > 0u )
+         return false;
+   }
+   return true;
+}
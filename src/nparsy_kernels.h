@@ -0,0 +1,1253 @@
+/**
+ * @file nparsy_kernels.h
+ * @brief Private digit-conversion kernels shared by the nparsy translation units.
+ *
+ * @note Everything in here is static inline so that each API translation unit
+ *       only pulls in the kernels it actually uses.
+ * @note The SWAR (SIMD-within-a-register) kernels operate on 8 characters at a
+ *       time loaded into a uint64_t, first character in the least significant
+ *       byte. They never read past the `end` pointer they're handed.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 2026
+ * @copyright MIT License
+ */
+
+#ifndef NPARSY_KERNELS_H_
+#define NPARSY_KERNELS_H_
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <stdckdint.h>
+
+#include "nparsy_types.h"
+#include "nparsy_constants.h"
+
+/* Local Macro Definitions */
+#define NPARSY_SWAR_ONES     0x0101010101010101u
+#define NPARSY_SWAR_HIGHBITS 0x8080808080808080u
+#define NPARSY_SWAR_ZEROS    0x3030303030303030u // "00000000"
+
+/* Datatypes */
+// What kind of number a token turned out to be
+enum TokenKind
+{
+   Token_UInt,
+   Token_Negative,   // '-' directly in front of the digits
+   Token_Float,      // decimal digits with a fraction and/or exponent
+   Token_Malformed,  // looks numeric but isn't, e.g. 0x1Fh or 12ab under dec (strict only)
+};
+
+// One number located by nparsy_next_token()
+struct Token
+{
+   const char * begin;   // first char, including any sign or prefix
+   const char * end;     // one past the last char, including any suffix
+   const char * digits;  // first digit
+   size_t ndigits;
+   enum NParsyNumFormat fmt;
+   enum TokenKind kind;
+   char prefix;          // 'x', 'X', 'b', 'B', 'o', 'O', a custom prefix, or '\0'
+   char suffix;          // 'h', 'H', 'x', 'X', 'd', 'D', a custom suffix, or '\0'
+};
+
+enum ScanStatus
+{
+   Scan_Found,
+   Scan_None,     // nothing left in [p, end)
+   Scan_NeedMore, // a token may continue past end; resume from tok->begin
+};
+
+// Custom prefix and suffix chars compiled by NParsyCompileSyntax: the format
+// each char marks, indexed by the char, or NParsy_NumOfFmts if none
+struct NParsySyntax
+{
+   uint8_t prefix_fmt[256];
+   uint8_t suffix_fmt[256];
+};
+
+// Book-keeping for looking ahead without running off the end of a chunk
+struct Scanner
+{
+   const char * end;
+   bool touched_end;
+   unsigned seps;     // enum NParsyDigitSep flags allowed between digits
+   enum NParsyGroupSep group;
+   bool lenient;
+   const struct NParsySyntax * syntax;
+};
+
+// Number syntax beyond what every parser accepts, chosen by the caller
+struct ScanOptions
+{
+   unsigned seps;              // enum NParsyDigitSep flags allowed between digits
+   enum NParsyGroupSep group;  // thousands separator of grouped decimal numbers
+   bool lenient;               // skip the prefix/suffix consistency checks
+   const struct NParsySyntax * syntax; // custom prefixes and suffixes, or nullptr
+};
+
+// Callers pass one of these constants, rather than building options at run
+// time, so each inlined copy of the scanner has the checks it doesn't need
+// folded away: strict and lenient get a state machine apiece.
+static const struct ScanOptions nparsy_no_options =
+{
+   .seps = NParsy_NoSep, .group = NParsy_NoGrouping, .lenient = false, .syntax = nullptr
+};
+static const struct ScanOptions nparsy_lenient_options =
+{
+   .seps = NParsy_NoSep, .group = NParsy_NoGrouping, .lenient = true, .syntax = nullptr
+};
+
+/* Local Data */
+static const uint64_t nparsy_pow10[20] =
+{
+   1u, 10u, 100u, 1'000u, 10'000u, 100'000u, 1'000'000u, 10'000'000u,
+   100'000'000u, 1'000'000'000u, 10'000'000'000u, 100'000'000'000u,
+   1'000'000'000'000u, 10'000'000'000'000u, 100'000'000'000'000u,
+   1'000'000'000'000'000u, 10'000'000'000'000'000u,
+   100'000'000'000'000'000u, 1'000'000'000'000'000'000u,
+   10'000'000'000'000'000'000u
+};
+
+// Powers of ten that are exact as a double (every one up to 1e22) and as a
+// float (up to 1e10), for the short-decimal fast paths
+static const double nparsy_pow10_dbl[23] =
+{
+   1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+static const float nparsy_pow10_flt[11] =
+{
+   1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+// (double)mantissa / 10^frac is correctly rounded while both are exact,
+// which holds for anything up to 15 digits in all
+constexpr size_t NPARSY_MAX_FAST_DBL_DIGITS = 15u;
+
+// Significant digits nparsy_dec_canon keeps. Any past these only matter to a
+// value within 10^-40 of a rounding boundary, and are folded into one sticky
+// digit so a value just past a boundary doesn't round as if it were on it.
+constexpr size_t NPARSY_MAX_DEC_SIG_DIGITS = 40u;
+
+// Room for nparsy_dec_canon's "[-]digits[sticky]e[-]ddddd"
+constexpr size_t NPARSY_DEC_CANON_LEN = NPARSY_MAX_DEC_SIG_DIGITS + 10u;
+
+// Thousands separators by enum NParsyGroupSep, as UTF-8. packed holds the
+// bytes as nparsy_load8() would see them.
+struct GroupSep
+{
+   unsigned len;
+   char bytes[3];
+   uint32_t packed;
+};
+
+static const struct GroupSep nparsy_group_seps[NParsy_NumOfGroupSeps] =
+{
+   [NParsy_NoGrouping]    = { 0u, { 0 },                  0u },
+   [NParsy_GroupComma]    = { 1u, { ',' },                0x2Cu },
+   [NParsy_GroupPeriod]   = { 1u, { '.' },                0x2Eu },
+   [NParsy_GroupSpace]    = { 1u, { ' ' },                0x20u },
+   [NParsy_GroupThinSpace] = { 3u, { '\xE2', '\x80', '\x89' }, 0x8980E2u },
+};
+
+// Perfect hash of the SI magnitude letters: slot = ((c * 15) >> 5) & 7 puts
+// each of E G k K M P T in its own slot. The letter is kept to reject misses.
+struct UnitSlot
+{
+   char letter;
+   enum NParsyUnit si;
+};
+
+static const struct UnitSlot nparsy_unit_slots[8] =
+{
+   { 'E', NParsy_Exa  },
+   { 'G', NParsy_Giga },
+   { 'k', NParsy_Kilo },
+   { 'K', NParsy_Kilo },
+   { 'M', NParsy_Mega },
+   { 'P', NParsy_Peta },
+   { '\0', NParsy_NoUnit },
+   { 'T', NParsy_Tera },
+};
+
+/*** Kernels ***/
+
+/**
+ * @brief Bounded strlen. Fails if no null terminator is found within
+ *        NPARSY_MAX_PARSABLE_STRING_LEN characters.
+ */
+static inline bool nparsy_bounded_strlen(const char * str, size_t * len)
+{
+   const char * nul = memchr(str, '\0', NPARSY_MAX_PARSABLE_STRING_LEN);
+   if ( nul == nullptr )
+      return false;
+
+   *len = (size_t)(nul - str);
+   return true;
+}
+
+static inline bool nparsy_is_dec_digit(char ch)
+{
+   return (ch >= '0') && (ch <= '9');
+}
+
+static inline bool nparsy_is_hex_digit(char ch)
+{
+   return nparsy_is_dec_digit(ch)
+          || ( (ch >= 'a') && (ch <= 'f') )
+          || ( (ch >= 'A') && (ch <= 'F') );
+}
+
+/**
+ * @brief Load 8 chars into a uint64_t, first char in the least significant byte.
+ */
+static inline uint64_t nparsy_load8(const char * p)
+{
+   uint64_t v;
+   memcpy(&v, p, sizeof v);
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+   v = __builtin_bswap64(v);
+#endif
+   return v;
+}
+
+/**
+ * @brief High bit set in every byte of the chunk that is NOT a decimal digit.
+ */
+static inline uint64_t nparsy_swar_non_digits(uint64_t chunk)
+{
+   // Bytes that are digits become 0..9 after the xor. Everything else either
+   // is >= 10 or has its high bit set. Masking off the high bit before the add
+   // keeps carries from rippling into the neighbouring byte.
+   uint64_t x = chunk ^ NPARSY_SWAR_ZEROS;
+   return ( ((x & ~NPARSY_SWAR_HIGHBITS) + (0x76u * NPARSY_SWAR_ONES)) | x )
+          & NPARSY_SWAR_HIGHBITS;
+}
+
+/**
+ * @brief High bit set in every byte of the chunk that is NOT a hex digit.
+ */
+static inline uint64_t nparsy_swar_non_hex_digits(uint64_t chunk)
+{
+   // Folding to lowercase and xoring with '`' takes a-f/A-F to 1..6. The high
+   // bit is kept out of the range check adds for the same reason as above.
+   uint64_t y = (chunk | (0x20u * NPARSY_SWAR_ONES)) ^ (0x60u * NPARSY_SWAR_ONES);
+   uint64_t y7 = y & ~NPARSY_SWAR_HIGHBITS;
+   uint64_t letters = (y7 + (0x7Fu * NPARSY_SWAR_ONES)) & ~(y7 + (0x79u * NPARSY_SWAR_ONES)) & ~y;
+   return nparsy_swar_non_digits(chunk) & ~letters & NPARSY_SWAR_HIGHBITS;
+}
+
+/**
+ * @brief High bit set in every byte of the chunk that equals ch.
+ */
+static inline uint64_t nparsy_swar_eq(uint64_t chunk, char ch)
+{
+   uint64_t x = chunk ^ ((uint64_t)(unsigned char)ch * NPARSY_SWAR_ONES);
+   return ~( ((x & ~NPARSY_SWAR_HIGHBITS) + ~NPARSY_SWAR_HIGHBITS) | x )
+          & NPARSY_SWAR_HIGHBITS;
+}
+
+/**
+ * @brief Number of leading (lowest-addressed) decimal digit chars in the chunk.
+ */
+static inline unsigned nparsy_swar_dec_prefix_len(uint64_t chunk)
+{
+   uint64_t non_digits = nparsy_swar_non_digits(chunk);
+   if ( non_digits == 0 )
+      return 8u;
+
+   return (unsigned)__builtin_ctzll(non_digits) / 8u;
+}
+
+/**
+ * @brief Convert 8 decimal digit chars to their value.
+ * @note Assumes every byte of the chunk is a decimal digit.
+ */
+static inline uint32_t nparsy_swar_dec8(uint64_t chunk)
+{
+   constexpr uint64_t MASK = 0x000000FF000000FFu;
+   constexpr uint64_t MUL1 = 0x000F424000000064u; // 100 + (1000000 << 32)
+   constexpr uint64_t MUL2 = 0x0000271000000001u; // 1 + (10000 << 32)
+
+   chunk -= NPARSY_SWAR_ZEROS;
+   chunk = (chunk * 10u) + (chunk >> 8);
+   chunk = ( ((chunk & MASK) * MUL1) + (((chunk >> 16) & MASK) * MUL2) ) >> 32;
+   return (uint32_t)chunk;
+}
+
+/**
+ * @brief Convert the first ndigits (1..8) decimal digit chars of the chunk.
+ */
+static inline uint32_t nparsy_swar_dec_n(uint64_t chunk, unsigned ndigits)
+{
+   if ( ndigits < 8u )
+   {
+      // Shift the digits up to the most significant end and back-fill with '0'
+      unsigned shift = 8u * (8u - ndigits);
+      chunk = (chunk << shift) | (NPARSY_SWAR_ZEROS >> (64u - shift));
+   }
+   return nparsy_swar_dec8(chunk);
+}
+
+/**
+ * @brief SWAR decimal kernel: convert the run of decimal digits at p.
+ * @param[in]  p, end  : bounds of the readable region
+ * @param[in]  max_digits : stop after this many digits even if the run goes on
+ * @param[out] val : accumulated value (only meaningful if !*overflow)
+ * @param[out] ndigits : how many digits were consumed
+ * @param[out] overflow : set if the run doesn't fit in a uint64_t
+ * @return one past the last digit consumed
+ */
+static inline const char * nparsy_dec_run(
+      const char * p,
+      const char * end,
+      size_t max_digits,
+      uint64_t * val,
+      size_t * ndigits,
+      bool * overflow )
+{
+   const char * start = p;
+   uint64_t acc = 0;
+   bool ovf = false;
+
+   if ( (size_t)(end - p) > max_digits )
+      end = p + max_digits;
+
+   while ( (end - p) >= 8 )
+   {
+      uint64_t chunk = nparsy_load8(p);
+      unsigned n = nparsy_swar_dec_prefix_len(chunk);
+      if ( n == 0u )
+         break;
+
+      uint64_t part = nparsy_swar_dec_n(chunk, n);
+      ovf = ovf || ckd_mul(&acc, acc, nparsy_pow10[n]) || ckd_add(&acc, acc, part);
+      p += n;
+
+      if ( n < 8u )
+         goto run_done;
+   }
+
+   while ( (p < end) && nparsy_is_dec_digit(*p) )
+   {
+      ovf = ovf || ckd_mul(&acc, acc, 10u) || ckd_add(&acc, acc, (uint64_t)(*p - '0'));
+      ++p;
+   }
+
+run_done:
+   *val = acc;
+   *ndigits = (size_t)(p - start);
+   *overflow = ovf;
+   return p;
+}
+
+/**
+ * @brief Skip a run of decimal digits without converting them.
+ */
+static inline const char * nparsy_skip_dec_run(const char * p, const char * end)
+{
+   while ( (end - p) >= 8 )
+   {
+      unsigned n = nparsy_swar_dec_prefix_len( nparsy_load8(p) );
+      p += n;
+      if ( n < 8u )
+         return p;
+   }
+
+   while ( (p < end) && nparsy_is_dec_digit(*p) )
+      ++p;
+
+   return p;
+}
+
+/**
+ * @brief Skip a run of hex digits without converting them.
+ */
+static inline const char * nparsy_skip_hex_run(const char * p, const char * end)
+{
+   while ( (end - p) >= 8 )
+   {
+      uint64_t non_hex = nparsy_swar_non_hex_digits( nparsy_load8(p) );
+      if ( non_hex != 0u )
+         return p + ((unsigned)__builtin_ctzll(non_hex) / 8u);
+      p += 8;
+   }
+
+   while ( (p < end) && nparsy_is_hex_digit(*p) )
+      ++p;
+
+   return p;
+}
+
+/**
+ * @brief SWAR hex kernel: convert 8 hex digit chars to their value.
+ * @note Assumes every byte of the chunk is a hex digit.
+ */
+static inline uint32_t nparsy_swar_hex8(uint64_t chunk)
+{
+   // Letters have bit 6 set and their low nibble is 9 short of their value
+   uint64_t letters = (chunk >> 6) & NPARSY_SWAR_ONES;
+   uint64_t nibbles = (chunk & (0x0Fu * NPARSY_SWAR_ONES)) + (9u * letters);
+
+   // First char is the most significant nibble, so gather from the top down
+   nibbles = __builtin_bswap64(nibbles);
+   nibbles = (nibbles | (nibbles >> 4))  & 0x00FF00FF00FF00FFu;
+   nibbles = (nibbles | (nibbles >> 8))  & 0x0000FFFF0000FFFFu;
+   nibbles = (nibbles | (nibbles >> 16)) & 0x00000000FFFFFFFFu;
+   return (uint32_t)nibbles;
+}
+
+/**
+ * @brief SWAR binary kernel: convert 8 '0'/'1' chars to their value.
+ */
+static inline uint8_t nparsy_swar_bin8(uint64_t chunk)
+{
+   return (uint8_t)( ((chunk - NPARSY_SWAR_ZEROS) * 0x8040201008040201u) >> 56 );
+}
+
+/*** Token Scanning ***/
+
+// ASCII only on purpose: no locale, no ctype
+static inline bool nparsy_is_alnum(char ch)
+{
+   return nparsy_is_dec_digit(ch)
+          || ( (ch >= 'a') && (ch <= 'z') )
+          || ( (ch >= 'A') && (ch <= 'Z') );
+}
+
+static inline bool nparsy_is_fmt_digit(char ch, enum NParsyNumFormat fmt)
+{
+   switch ( fmt )
+   {
+      case NParsy_Dec: return nparsy_is_dec_digit(ch);
+      case NParsy_Hex: return nparsy_is_hex_digit(ch);
+      case NParsy_Bin: return (ch == '0') || (ch == '1');
+      case NParsy_Oct: return (ch >= '0') && (ch <= '7');
+      case NParsy_NumOfFmts:
+      default:         return false;
+   }
+}
+
+/**
+ * @brief Value of a (valid) hex digit char.
+ */
+static inline uint8_t nparsy_digit_val(char ch)
+{
+   return (uint8_t)( ((unsigned char)ch & 0x0Fu) + (9u * (((unsigned char)ch >> 6) & 1u)) );
+}
+
+static inline unsigned nparsy_fmt_bits(enum NParsyNumFormat fmt)
+{
+   return (fmt == NParsy_Hex) ? 4u : (fmt == NParsy_Oct) ? 3u : 1u;
+}
+
+/**
+ * @brief Format marked by ch as a custom prefix, or NParsy_NumOfFmts if none.
+ */
+static inline enum NParsyNumFormat nparsy_custom_prefix(const struct Scanner * sc, char ch)
+{
+   return (sc->syntax == nullptr) ? NParsy_NumOfFmts
+                                  : (enum NParsyNumFormat)sc->syntax->prefix_fmt[(unsigned char)ch];
+}
+
+/**
+ * @brief Format marked by ch as a custom suffix, or NParsy_NumOfFmts if none.
+ */
+static inline enum NParsyNumFormat nparsy_custom_suffix(const struct Scanner * sc, char ch)
+{
+   return (sc->syntax == nullptr) ? NParsy_NumOfFmts
+                                  : (enum NParsyNumFormat)sc->syntax->suffix_fmt[(unsigned char)ch];
+}
+
+static inline char nparsy_peek(struct Scanner * sc, const char * q)
+{
+   if ( q < sc->end )
+      return *q;
+
+   sc->touched_end = true;
+   return '\0';
+}
+
+static inline bool nparsy_is_sep(unsigned seps, char ch)
+{
+   return ( ((seps & NParsy_SepApostrophe) != 0u) && (ch == '\'') )
+          || ( ((seps & NParsy_SepUnderscore) != 0u) && (ch == '_') );
+}
+
+/**
+ * @brief End of the run of fmt digits in [q, limit), looking through any
+ *        separator in seps that sits between two digits (e.g., 1'000).
+ */
+static inline const char * nparsy_sep_run_to(
+      unsigned seps,
+      const char * q,
+      const char * limit,
+      enum NParsyNumFormat fmt )
+{
+   for ( const char * start = q; ; q++ )
+   {
+      if ( fmt == NParsy_Dec )
+         q = nparsy_skip_dec_run(q, limit);
+      else if ( fmt == NParsy_Hex )
+         q = nparsy_skip_hex_run(q, limit);
+      else
+         while ( (q < limit) && nparsy_is_fmt_digit(*q, fmt) )
+            ++q;
+
+      if ( (seps == 0u) || (q == start) || ((limit - q) < 2)
+           || !nparsy_is_sep(seps, *q) || !nparsy_is_fmt_digit(q[1], fmt) )
+         return q;
+   }
+}
+
+/**
+ * @brief End of the run of fmt digits starting at q.
+ */
+static inline const char * nparsy_fmt_run(struct Scanner * sc, const char * q, enum NParsyNumFormat fmt)
+{
+   q = nparsy_sep_run_to(sc->seps, q, sc->end, fmt);
+
+   // Record whether the run may continue past end, including through a
+   // separator that's the last char before it
+   if ( ((sc->end - q) == 1) && nparsy_is_sep(sc->seps, *q) )
+      (void)nparsy_peek(sc, q + 1);
+   (void)nparsy_peek(sc, q);
+   return q;
+}
+
+/**
+ * @brief Whether q starts another thousands group: the separator, exactly
+ *        three digits, then anything but a digit.
+ */
+static inline bool nparsy_is_group(struct Scanner * sc, const char * q)
+{
+   const struct GroupSep * g = &nparsy_group_seps[sc->group];
+
+   if ( (sc->end - q) >= 8 )
+   {
+      // One classification of the chunk checks the whole shape: non-digits
+      // over the separator and the byte after the group, digits in between
+      uint64_t chunk = nparsy_load8(q);
+      uint64_t shape = ((uint64_t)1u << (8u * (g->len + 4u))) - 1u;
+      uint64_t sep_bytes = ((uint64_t)1u << (8u * g->len)) - 1u;
+      uint64_t want = (sep_bytes | ((uint64_t)0xFFu << (8u * (g->len + 3u)))) & NPARSY_SWAR_HIGHBITS;
+
+      return ((nparsy_swar_non_digits(chunk) & shape) == want)
+             && ((chunk & sep_bytes) == g->packed);
+   }
+
+   for ( unsigned i = 0; i < g->len; i++ )
+      if ( nparsy_peek(sc, q + i) != g->bytes[i] )
+         return false;
+
+   q += g->len;
+   return nparsy_is_dec_digit(nparsy_peek(sc, q)) && nparsy_is_dec_digit(nparsy_peek(sc, q + 1))
+          && nparsy_is_dec_digit(nparsy_peek(sc, q + 2)) && !nparsy_is_dec_digit(nparsy_peek(sc, q + 3));
+}
+
+/**
+ * @brief If q starts a fraction (".5") and/or exponent ("e-3"), skip it.
+ * @return end of the float tail, or q if there is none
+ */
+static inline const char * nparsy_float_tail(struct Scanner * sc, const char * q)
+{
+   if ( (nparsy_peek(sc, q) == '.') && nparsy_is_dec_digit(nparsy_peek(sc, q + 1)) )
+      q = nparsy_fmt_run(sc, q + 1, NParsy_Dec);
+
+   char e = nparsy_peek(sc, q);
+   if ( (e == 'e') || (e == 'E') )
+   {
+      const char * x = q + 1;
+      if ( (nparsy_peek(sc, x) == '-') || (nparsy_peek(sc, x) == '+') )
+         ++x;
+      if ( nparsy_is_dec_digit(nparsy_peek(sc, x)) )
+         q = nparsy_fmt_run(sc, x, NParsy_Dec);
+   }
+
+   return q;
+}
+
+/**
+ * @brief Work out the extent and format of the number whose first digit is d.
+ * @note Acceptable formats:
+ *          Hex:     0xZZ, xZZ, XZZ, ZZh, ZZH, ZZx, ZZX, ZZ (hex default)
+ *          Decimal: ZZd, ZZD, ZZ (dec default), with optional fraction/exponent
+ *          Binary:  0bZZ, ZZ (bin default)
+ *          Octal:   0oZZ, ZZ (oct default)
+ */
+static inline void nparsy_scan_number(
+      struct Scanner * sc,
+      const char * begin,
+      const char * d,
+      bool negative,
+      enum NParsyNumFormat default_fmt,
+      struct Token * tok )
+{
+   tok->begin = begin;
+   tok->kind = negative ? Token_Negative : Token_UInt;
+   tok->prefix = '\0';
+   tok->suffix = '\0';
+
+   // Prefixed: 0x / 0b / 0o, or a lone x/X (handled by the caller passing d at the x)
+   enum NParsyNumFormat prefix_fmt = NParsy_NumOfFmts;
+   const char * digits = d;
+   if ( (*d == 'x') || (*d == 'X') )
+   {
+      prefix_fmt = NParsy_Hex;
+      tok->prefix = *d;
+      digits = d + 1;
+   }
+   else if ( nparsy_custom_prefix(sc, *d) != NParsy_NumOfFmts )
+   {
+      // The caller has checked that a digit of the format follows
+      prefix_fmt = nparsy_custom_prefix(sc, *d);
+      tok->prefix = *d;
+      digits = d + 1;
+   }
+   else if ( *d == '0' )
+   {
+      char p1 = nparsy_peek(sc, d + 1);
+      enum NParsyNumFormat fmt = ( (p1 == 'x') || (p1 == 'X') ) ? NParsy_Hex
+                               : ( (p1 == 'b') || (p1 == 'B') ) ? NParsy_Bin
+                               : ( (p1 == 'o') || (p1 == 'O') ) ? NParsy_Oct
+                               : NParsy_NumOfFmts;
+      if ( (fmt != NParsy_NumOfFmts) && nparsy_is_fmt_digit(nparsy_peek(sc, d + 2), fmt) )
+      {
+         prefix_fmt = fmt;
+         tok->prefix = p1;
+         digits = d + 2;
+      }
+   }
+
+   if ( prefix_fmt != NParsy_NumOfFmts )
+   {
+      const char * run_end = nparsy_fmt_run(sc, digits, prefix_fmt);
+
+      tok->fmt = prefix_fmt;
+      tok->digits = digits;
+      tok->ndigits = (size_t)(run_end - digits);
+      tok->end = run_end;
+      if ( !sc->lenient && (prefix_fmt == NParsy_Hex) )
+      {
+         // Hexadecimal prefix and suffix at once is not allowed
+         char s = nparsy_peek(sc, run_end);
+         if ( (s == 'h') || (s == 'H') )
+         {
+            tok->kind = Token_Malformed;
+            tok->end = run_end + 1;
+         }
+      }
+      return;
+   }
+
+   // Bare digits, possibly with a suffix
+   const char * hex_end = nparsy_fmt_run(sc, d, NParsy_Hex);
+   const char * dec_end = nparsy_sep_run_to(sc->seps, d, hex_end, NParsy_Dec);
+   char s = nparsy_peek(sc, hex_end);
+   enum NParsyNumFormat suffix_fmt = nparsy_custom_suffix(sc, s);
+
+   tok->digits = d;
+   if ( (sc->group != NParsy_NoGrouping) && (default_fmt == NParsy_Dec)
+        && (dec_end == hex_end) && ((dec_end - d) <= 3) && nparsy_is_group(sc, dec_end) )
+   {
+      // Thousands groups: the first of 1 to 3 digits, every other of exactly 3
+      const char * q = dec_end;
+      do
+         q += nparsy_group_seps[sc->group].len + 3u;
+      while ( nparsy_is_group(sc, q) );
+
+      tok->fmt = NParsy_Dec;
+      tok->ndigits = (size_t)(q - d);
+      tok->end = nparsy_float_tail(sc, q);
+      if ( tok->end != q )
+      {
+         tok->kind = Token_Float;
+      }
+      else if ( !sc->lenient && nparsy_is_alnum(nparsy_peek(sc, q)) )
+      {
+         tok->kind = Token_Malformed;
+         tok->end = nparsy_fmt_run(sc, q, NParsy_Hex);
+      }
+   }
+   else if ( ((s == 'h') || (s == 'H') || (s == 'x') || (s == 'X'))
+        && !nparsy_is_alnum(nparsy_peek(sc, hex_end + 1)) )
+   {
+      tok->fmt = NParsy_Hex;
+      tok->suffix = s;
+      tok->ndigits = (size_t)(hex_end - d);
+      tok->end = hex_end + 1;
+   }
+   else if ( (suffix_fmt != NParsy_NumOfFmts) && !nparsy_is_alnum(nparsy_peek(sc, hex_end + 1)) )
+   {
+      // Custom suffixes are never hex digits, so they sit right at hex_end
+      tok->fmt = suffix_fmt;
+      tok->suffix = s;
+      tok->ndigits = (size_t)(hex_end - d);
+      tok->end = hex_end + 1;
+      if ( !sc->lenient && (nparsy_sep_run_to(sc->seps, d, hex_end, suffix_fmt) != hex_end) )
+         tok->kind = Token_Malformed;
+   }
+   else if ( (default_fmt != NParsy_Hex)
+             && (dec_end == hex_end - 1) && (dec_end > d)
+             && ((*dec_end == 'd') || (*dec_end == 'D'))
+             && !nparsy_is_alnum(s) )
+   {
+      tok->fmt = NParsy_Dec;
+      tok->suffix = *dec_end;
+      tok->ndigits = (size_t)(dec_end - d);
+      tok->end = hex_end;
+   }
+   else if ( default_fmt == NParsy_Hex )
+   {
+      tok->fmt = NParsy_Hex;
+      tok->ndigits = (size_t)(hex_end - d);
+      tok->end = hex_end;
+   }
+   else
+   {
+      tok->fmt = default_fmt;
+      tok->end = hex_end;
+
+      const char * run_end = dec_end;
+      if ( default_fmt != NParsy_Dec )
+         run_end = nparsy_sep_run_to(sc->seps, d, hex_end, default_fmt);
+      tok->ndigits = (size_t)(run_end - d);
+
+      const char * float_end = (default_fmt == NParsy_Dec) ? nparsy_float_tail(sc, dec_end) : dec_end;
+      if ( float_end != dec_end )
+      {
+         tok->kind = Token_Float;
+         tok->end = float_end;
+      }
+      else if ( !sc->lenient && (run_end != hex_end) )
+      {
+         // Digits that don't belong to the format run straight into the number
+         tok->kind = Token_Malformed;
+      }
+   }
+}
+
+/**
+ * @brief A float without integer digits, like ".5" or "-.5e3" (dot at q).
+ */
+static inline void nparsy_scan_fraction(
+      struct Scanner * sc,
+      const char * begin,
+      const char * dot,
+      struct Token * tok )
+{
+   tok->begin = begin;
+   tok->end = nparsy_float_tail(sc, dot);
+   tok->digits = dot;
+   tok->ndigits = 0;
+   tok->fmt = NParsy_Dec;
+   tok->kind = Token_Float;
+   tok->prefix = '\0';
+   tok->suffix = '\0';
+}
+
+/**
+ * @brief Find the next number in [p, end).
+ * @param[in] p, end : region to scan
+ * @param[in] prev : the char right before p ('\0' if none)
+ * @param[in] at_eof : whether end is the true end of the input. If not, a
+ *                     token that may continue past end isn't reported as
+ *                     found; Scan_NeedMore is returned with tok->begin set to
+ *                     where scanning should resume once more input arrives.
+ * @param[in] default_fmt : format assumed for bare numbers
+ * @param[in] opts : optional number syntax. A token's digits may then have
+ *                   digit or thousands separators in them (see
+ *                   nparsy_token_compact).
+ * @param[out] tok : the token found
+ */
+static inline enum ScanStatus nparsy_next_token_opts(
+      const char * p,
+      const char * end,
+      char prev,
+      bool at_eof,
+      enum NParsyNumFormat default_fmt,
+      const struct ScanOptions * opts,
+      struct Token * tok )
+{
+   for ( const char * q = p; q < end; ++q )
+   {
+      struct Scanner sc = { .end = end, .touched_end = false, .seps = opts->seps,
+                            .group = opts->group, .lenient = opts->lenient, .syntax = opts->syntax };
+      char ch = *q;
+      char before = (q > p) ? q[-1] : prev;
+      bool found = false;
+
+      if ( nparsy_is_dec_digit(ch) )
+      {
+         nparsy_scan_number(&sc, q, q, false, default_fmt, tok);
+         found = true;
+      }
+      else if ( (default_fmt == NParsy_Hex) && nparsy_is_hex_digit(ch) && !nparsy_is_alnum(before) )
+      {
+         // Bare hex may lead with a letter when hex is the default (e.g., "ff")
+         nparsy_scan_number(&sc, q, q, false, default_fmt, tok);
+         found = true;
+      }
+      else if ( (ch == '-') && !nparsy_is_alnum(before) )
+      {
+         char n1 = nparsy_peek(&sc, q + 1);
+         if ( nparsy_is_dec_digit(n1) )
+         {
+            nparsy_scan_number(&sc, q, q + 1, true, default_fmt, tok);
+            found = true;
+         }
+         else if ( (default_fmt == NParsy_Dec) && (n1 == '.')
+                   && nparsy_is_dec_digit(nparsy_peek(&sc, q + 2)) )
+         {
+            nparsy_scan_fraction(&sc, q, q + 1, tok);
+            found = true;
+         }
+      }
+      else if ( (ch == '.') && (default_fmt == NParsy_Dec) && !nparsy_is_dec_digit(before)
+                && nparsy_is_dec_digit(nparsy_peek(&sc, q + 1)) )
+      {
+         nparsy_scan_fraction(&sc, q, q, tok);
+         found = true;
+      }
+      else if ( ((ch == 'x') || (ch == 'X')) && !nparsy_is_alnum(before)
+                && nparsy_is_hex_digit(nparsy_peek(&sc, q + 1)) )
+      {
+         nparsy_scan_number(&sc, q, q, false, default_fmt, tok);
+         found = true;
+      }
+      else if ( (nparsy_custom_prefix(&sc, ch) != NParsy_NumOfFmts) && !nparsy_is_alnum(before)
+                && nparsy_is_fmt_digit(nparsy_peek(&sc, q + 1), nparsy_custom_prefix(&sc, ch)) )
+      {
+         nparsy_scan_number(&sc, q, q, false, default_fmt, tok);
+         found = true;
+      }
+
+      if ( sc.touched_end && !at_eof )
+      {
+         tok->begin = q;
+         return Scan_NeedMore;
+      }
+      if ( found )
+         return Scan_Found;
+   }
+
+   tok->begin = end;
+   tok->end = end;
+   return Scan_None;
+}
+
+/**
+ * @brief nparsy_next_token_opts with the plain number syntax.
+ */
+static inline enum ScanStatus nparsy_next_token(
+      const char * p,
+      const char * end,
+      char prev,
+      bool at_eof,
+      enum NParsyNumFormat default_fmt,
+      struct Token * tok )
+{
+   return nparsy_next_token_opts(p, end, prev, at_eof, default_fmt, &nparsy_no_options, tok);
+}
+
+/**
+ * @brief Copy tok's digits into buf without their separators and leading
+ *        zeros, and point tok at the copy.
+ * @note Every separator (digit or thousands) is something other than a hex
+ *       digit, so separator-free stretches are found by SWAR classification
+ *       and copied 8 chars at a time rather than char by char.
+ * @return false if more than cap significant digits are left, which is more
+ *         than any conversion can take anyway
+ */
+static inline bool nparsy_token_compact(struct Token * tok, char * buf, size_t cap)
+{
+   const char * d = tok->digits;
+   const char * end = d + tok->ndigits;
+   size_t n = 0;
+
+   while ( ((end - d) > 1) && ((*d == '0') || !nparsy_is_hex_digit(*d)) )
+      ++d;
+
+   while ( d < end )
+   {
+      // Length of the separator-free stretch at d
+      size_t k = 0;
+      if ( (end - d) >= 8 )
+      {
+         uint64_t non_hex = nparsy_swar_non_hex_digits( nparsy_load8(d) );
+         k = (non_hex == 0u) ? 8u : ((unsigned)__builtin_ctzll(non_hex) / 8u);
+      }
+      else
+      {
+         while ( ((d + k) < end) && nparsy_is_hex_digit(d[k]) )
+            ++k;
+      }
+
+      if ( k > (cap - n) )
+         return false;
+      memcpy(buf + n, d, k);
+      n += k;
+      d += k;
+      while ( (d < end) && !nparsy_is_hex_digit(*d) )
+         ++d;
+   }
+
+   tok->digits = buf;
+   tok->ndigits = n;
+   return true;
+}
+
+/**
+ * @brief Match a magnitude suffix (k, M, G, T, P, E, optionally followed by
+ *        'i' for the IEC power of 1024) at q, ending at a non-alnum char.
+ * @param[out] unit : the unit found, or NParsy_NoUnit
+ * @return one past the suffix, or q if there is none
+ */
+static inline const char * nparsy_scan_unit(const char * q, const char * end, enum NParsyUnit * unit)
+{
+   *unit = NParsy_NoUnit;
+   if ( q >= end )
+      return q;
+
+   const struct UnitSlot * slot = &nparsy_unit_slots[(((unsigned)(unsigned char)*q * 15u) >> 5) & 7u];
+   if ( (slot->letter != *q) || (slot->si == NParsy_NoUnit) )
+      return q;
+
+   const char * u = q + 1;
+   enum NParsyUnit found = slot->si;
+   if ( (u < end) && (*u == 'i') )
+   {
+      found = (enum NParsyUnit)(found + (NParsy_Kibi - NParsy_Kilo));
+      ++u;
+   }
+
+   if ( (u < end) && nparsy_is_alnum(*u) )
+      return q;
+
+   *unit = found;
+   return u;
+}
+
+/**
+ * @brief Scale val by unit's multiplier.
+ * @return false if the result doesn't fit in 64 bits (val is then left alone)
+ */
+static inline bool nparsy_apply_unit(enum NParsyUnit unit, uint64_t * val)
+{
+   uint64_t mult = 1u;
+   if ( (unit >= NParsy_Kilo) && (unit <= NParsy_Exa) )
+      mult = nparsy_pow10[3u * (unsigned)(unit - NParsy_NoUnit)];
+   else if ( (unit >= NParsy_Kibi) && (unit <= NParsy_Exbi) )
+      mult = (uint64_t)1u << (10u * (unsigned)(unit - NParsy_Exa));
+
+   uint64_t scaled = 0;
+   if ( ckd_mul(&scaled, *val, mult) )
+      return false;
+
+   *val = scaled;
+   return true;
+}
+
+/**
+ * @brief Drop leading zeros, keeping at least one digit.
+ */
+static inline size_t nparsy_strip_leading_zeros(const char ** digits, size_t ndigits)
+{
+   while ( (ndigits > 1u) && (**digits == '0') )
+   {
+      ++*digits;
+      --ndigits;
+   }
+   return ndigits;
+}
+
+/**
+ * @brief Convert a hex, binary, or octal digit run to a uint64_t.
+ * @note The caller guarantees the value fits.
+ */
+static inline uint64_t nparsy_pow2_run_to_u64(const char * d, const char * end, enum NParsyNumFormat fmt)
+{
+   uint64_t acc = 0;
+
+   if ( fmt == NParsy_Hex )
+   {
+      for ( ; (end - d) >= 8; d += 8 )
+         acc = (acc << 32) | nparsy_swar_hex8( nparsy_load8(d) );
+   }
+   else if ( fmt == NParsy_Bin )
+   {
+      for ( ; (end - d) >= 8; d += 8 )
+         acc = (acc << 8) | nparsy_swar_bin8( nparsy_load8(d) );
+   }
+
+   unsigned bits = nparsy_fmt_bits(fmt);
+   for ( ; d < end; ++d )
+      acc = (acc << bits) | nparsy_digit_val(*d);
+
+   return acc;
+}
+
+/**
+ * @brief Convert a token's digits to a uint64_t.
+ * @return false if the value doesn't fit
+ */
+static inline bool nparsy_token_to_u64(const struct Token * tok, uint64_t * val)
+{
+   const char * d = tok->digits;
+   size_t n = nparsy_strip_leading_zeros(&d, tok->ndigits);
+   const char * end = d + n;
+   uint64_t acc = 0;
+
+   switch ( tok->fmt )
+   {
+      case NParsy_Dec:
+      {
+         size_t ndigits = 0;
+         bool overflow = false;
+         if ( n > 20u )
+            return false;
+         (void)nparsy_dec_run(d, end, n, &acc, &ndigits, &overflow);
+         if ( overflow )
+            return false;
+         break;
+      }
+
+      case NParsy_Hex:
+         if ( n > 16u )
+            return false;
+         acc = nparsy_pow2_run_to_u64(d, end, NParsy_Hex);
+         break;
+
+      case NParsy_Bin:
+         if ( n > 64u )
+            return false;
+         acc = nparsy_pow2_run_to_u64(d, end, NParsy_Bin);
+         break;
+
+      case NParsy_Oct:
+         // 22 octal digits = 66 bits, so the leading digit may only carry 1 bit
+         if ( (n > 22u) || ((n == 22u) && (*d > '1')) )
+            return false;
+         acc = nparsy_pow2_run_to_u64(d, end, NParsy_Oct);
+         break;
+
+      case NParsy_NumOfFmts:
+      default:
+         return false;
+   }
+
+   *val = acc;
+   return true;
+}
+
+/**
+ * @brief Rewrite [-|+]digits[.digits][e[-|+]digits] (the exponent only if
+ *        allow_exp) as "[-]digitse[-]ddddd": the significant digits without
+ *        a '.', scaled by a power of ten.
+ * @note The result holds only digits, a '-' and an 'e', so strtod/strtof
+ *       read it the same under every locale - the radix character is the one
+ *       part of their input that LC_NUMERIC changes.
+ * @param[out] canon : NPARSY_DEC_CANON_LEN chars, null-terminated on success
+ * @return false if [begin, end) isn't entirely such a number
+ */
+static inline bool nparsy_dec_canon(
+      const char * begin,
+      const char * end,
+      bool allow_exp,
+      char * canon )
+{
+   constexpr int64_t MAX_EXP = 99'999; // far past where any double gives out
+
+   const char * p = begin;
+   size_t n = 0;
+   if ( (p < end) && ((*p == '-') || (*p == '+')) )
+   {
+      if ( *p == '-' )
+         canon[n++] = '-';
+      ++p;
+   }
+
+   // The value is canon's digits * 10^scale
+   int64_t scale = 0;
+   size_t nsig = 0;
+   size_t ndigits = 0;
+   bool sticky = false;
+   bool in_frac = false;
+   for ( ; p < end; ++p )
+   {
+      if ( (*p == '.') && !in_frac )
+      {
+         in_frac = true;
+         continue;
+      }
+      else if ( !nparsy_is_dec_digit(*p) )
+      {
+         break;
+      }
+
+      ++ndigits;
+      if ( (nsig == 0u) && (*p == '0') )
+      {
+         scale -= in_frac ? 1 : 0; // Leading zero
+      }
+      else if ( nsig < NPARSY_MAX_DEC_SIG_DIGITS )
+      {
+         canon[n++] = *p;
+         ++nsig;
+         scale -= in_frac ? 1 : 0;
+      }
+      else
+      {
+         scale += in_frac ? 0 : 1;
+         sticky = sticky || (*p != '0');
+      }
+   }
+   if ( ndigits == 0u )
+      return false;
+
+   if ( nsig == 0u )
+   {
+      canon[n++] = '0';
+      scale = 0;
+   }
+   else if ( sticky )
+   {
+      canon[n++] = '1';
+      --scale;
+   }
+
+   if ( allow_exp && (p < end) && ((*p | 0x20) == 'e') )
+   {
+      ++p;
+      bool exp_negative = (p < end) && (*p == '-');
+      if ( (p < end) && ((*p == '-') || (*p == '+')) )
+         ++p;
+      if ( (p == end) || !nparsy_is_dec_digit(*p) )
+         return false;
+
+      int64_t exp = 0;
+      for ( ; (p < end) && nparsy_is_dec_digit(*p); ++p )
+      {
+         if ( exp <= MAX_EXP )
+            exp = (exp * 10) + (*p - '0');
+      }
+      scale += exp_negative ? -exp : exp;
+   }
+   if ( p != end )
+      return false;
+
+   if ( scale > MAX_EXP )
+      scale = MAX_EXP;
+   else if ( scale < -MAX_EXP )
+      scale = -MAX_EXP;
+
+   canon[n++] = 'e';
+   if ( scale < 0 )
+   {
+      canon[n++] = '-';
+      scale = -scale;
+   }
+   char exp_digits[8];
+   size_t nexp = 0;
+   do
+   {
+      exp_digits[nexp++] = (char)('0' + (scale % 10));
+      scale /= 10;
+   } while ( scale > 0 );
+   while ( nexp > 0u )
+      canon[n++] = exp_digits[--nexp];
+   canon[n] = '\0';
+
+   return true;
+}
+
+/**
+ * @brief Convert a decimal float, [-|+]digits[.digits][e[-|+]digits], whose
+ *        extent the caller has already found, to a double.
+ * @note Short plain decimals are converted directly. Anything else (an
+ *       exponent, or more than NPARSY_MAX_FAST_DBL_DIGITS digits) is
+ *       rewritten by nparsy_dec_canon and goes through strtod, so neither
+ *       the locale nor the length of the text matters.
+ * @param[in] begin, end : the whole number, sign and exponent included
+ * @return false if the value is beyond DBL_MAX
+ */
+static inline bool nparsy_dec_to_double(const char * begin, const char * end, double * val)
+{
+   const char * p = begin;
+   bool negative = false;
+   if ( (p < end) && ((*p == '-') || (*p == '+')) )
+   {
+      negative = (*p == '-');
+      ++p;
+   }
+
+   const char * int_end = nparsy_skip_dec_run(p, end);
+   const char * frac_digits = int_end;
+   const char * frac_end = int_end;
+   if ( (int_end < end) && (*int_end == '.') )
+   {
+      frac_digits = int_end + 1;
+      frac_end = nparsy_skip_dec_run(frac_digits, end);
+   }
+   size_t nint = (size_t)(int_end - p);
+   size_t nfrac = (size_t)(frac_end - frac_digits);
+
+   if ( (frac_end == end) && ((nint + nfrac) <= NPARSY_MAX_FAST_DBL_DIGITS) )
+   {
+      uint64_t ipart = 0;
+      uint64_t fpart = 0;
+      size_t ndigits = 0;
+      bool overflow = false;
+      (void)nparsy_dec_run(p, int_end, nint, &ipart, &ndigits, &overflow);
+      (void)nparsy_dec_run(frac_digits, frac_end, nfrac, &fpart, &ndigits, &overflow);
+
+      double v = (double)((ipart * nparsy_pow10[nfrac]) + fpart) / nparsy_pow10_dbl[nfrac];
+      *val = negative ? -v : v;
+      return true;
+   }
+
+   char canon[NPARSY_DEC_CANON_LEN];
+   char * canon_end = nullptr;
+   if ( !nparsy_dec_canon(begin, end, true, canon) )
+      return false;
+
+   double v = strtod(canon, &canon_end);
+   if ( (*canon_end != '\0') || isinf(v) )
+      return false;
+
+   *val = v;
+   return true;
+}
+
+/**
+ * @brief Advance *p past the next unsigned integer in [*p, end) that fits in
+ *        64 bits, skipping negatives, floats, malformed, and out-of-range ones.
+ * @param[in] begin : start of the whole buffer (for the char before *p)
+ * @return false once nothing is left (*p is then end)
+ */
+static inline bool nparsy_next_u64(
+      const char * begin,
+      const char ** p,
+      const char * end,
+      enum NParsyNumFormat default_fmt,
+      uint64_t * val )
+{
+   struct Token tok;
+
+   while ( nparsy_next_token(*p, end, (*p > begin) ? (*p)[-1] : '\0', true, default_fmt, &tok) == Scan_Found )
+   {
+      *p = tok.end;
+      if ( (tok.kind == Token_UInt) && nparsy_token_to_u64(&tok, val) )
+         return true;
+   }
+
+   *p = end;
+   return false;
+}
+
+#endif // NPARSY_KERNELS_H_
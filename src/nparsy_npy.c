@@ -0,0 +1,265 @@
+/*!
+ * @file    nparsy_npy.c
+ * @brief   Implementation of NParsy's .npy array writer.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* Feature Test Macros */
+// O_CLOEXEC, ftruncate, and mremap/MREMAP_MAYMOVE are hidden under a strict -std
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "nparsy_npy.h"
+
+/* Local Macro Definitions */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define NPARSY_NPY_BYTE_ORDER  ">"
+#else
+#define NPARSY_NPY_BYTE_ORDER  "<"
+#endif
+
+/* Datatypes */
+// Fixed-size header so the data never has to move once the final shape is
+// known. 128 bytes keeps the data 64-byte aligned, as the format asks.
+constexpr size_t NPARSY_NPY_HEADER_LEN = 128u;
+constexpr size_t NPARSY_NPY_PREAMBLE_LEN = 10u; // magic, version, header length
+constexpr size_t NPARSY_NPY_ELEM_LEN = 8u;      // all dtypes are 64-bit
+constexpr size_t NPARSY_NPY_INITIAL_CAP = 64u * 1024u; // elements
+
+struct NParsyNpyWriter
+{
+   int fd;
+   enum NParsyNpyDtype dtype;
+   char * map;     // header + cap elements
+   size_t cap;
+   size_t n;
+   bool failed;
+};
+
+/* Local Data */
+static const char * const NpyDescrs[NParsy_NumOfNpyDtypes] =
+{
+   [NParsy_NpyU64] = NPARSY_NPY_BYTE_ORDER "u8",
+   [NParsy_NpyI64] = NPARSY_NPY_BYTE_ORDER "i8",
+   [NParsy_NpyF64] = NPARSY_NPY_BYTE_ORDER "f8",
+};
+
+/*** Private Function Prototypes ***/
+static enum NParsyResult nparsy_npy_append(
+      struct NParsyNpyWriter * w,
+      enum NParsyNpyDtype dtype,
+      const void * vals,
+      size_t n );
+static bool nparsy_npy_grow(struct NParsyNpyWriter * w, size_t min_cap);
+static void nparsy_npy_write_header(struct NParsyNpyWriter * w);
+
+/* Public Function Implementations */
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyNpyOpen(
+      struct NParsyNpyWriter ** writer,
+      const char * path,
+      enum NParsyNpyDtype dtype )
+{
+   // Initial input validation
+   if ( (writer == nullptr) || (path == nullptr) )
+      return NParsy_NullPtr;
+   else if ( (int)dtype < 0 || (int)dtype >= (int)NParsy_NumOfNpyDtypes )
+      return NParsy_InvalidDtype;
+
+   struct NParsyNpyWriter * w = malloc(sizeof *w);
+   if ( w == nullptr )
+      return NParsy_OutOfMemory;
+
+   w->dtype = dtype;
+   w->map = nullptr;
+   w->cap = 0;
+   w->n = 0;
+   w->failed = false;
+   w->fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+   if ( (w->fd < 0) || !nparsy_npy_grow(w, NPARSY_NPY_INITIAL_CAP) )
+   {
+      if ( w->fd >= 0 )
+         (void)close(w->fd);
+      free(w);
+      return NParsy_FileAccessFailed;
+   }
+
+   *writer = w;
+
+   return NParsy_GoodResult;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyNpyAppendU64(struct NParsyNpyWriter * writer, const uint64_t * vals, size_t n)
+{
+   return nparsy_npy_append(writer, NParsy_NpyU64, vals, n);
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyNpyAppendI64(struct NParsyNpyWriter * writer, const int64_t * vals, size_t n)
+{
+   return nparsy_npy_append(writer, NParsy_NpyI64, vals, n);
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyNpyAppendF64(struct NParsyNpyWriter * writer, const double * vals, size_t n)
+{
+   return nparsy_npy_append(writer, NParsy_NpyF64, vals, n);
+}
+
+/******************************************************************************/
+bool NParsyNpyUIntSink(const uint64_t * vals, size_t n, void * ctx)
+{
+   return nparsy_npy_append(ctx, NParsy_NpyU64, vals, n) == NParsy_GoodResult;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyNpyClose(
+      struct NParsyNpyWriter * writer,
+      size_t * num_written )
+{
+   if ( writer == nullptr )
+      return NParsy_NullPtr;
+
+   nparsy_npy_write_header(writer);
+
+   size_t map_len = NPARSY_NPY_HEADER_LEN + (writer->cap * NPARSY_NPY_ELEM_LEN);
+   size_t file_len = NPARSY_NPY_HEADER_LEN + (writer->n * NPARSY_NPY_ELEM_LEN);
+   bool ok = !writer->failed;
+   ok = (munmap(writer->map, map_len) == 0) && ok;
+   ok = (ftruncate(writer->fd, (off_t)file_len) == 0) && ok;
+   ok = (close(writer->fd) == 0) && ok;
+
+   if ( num_written != nullptr )
+      *num_written = writer->n;
+
+   free(writer);
+
+   return ok ? NParsy_GoodResult : NParsy_FileAccessFailed;
+}
+
+/*** Private Function Implementations ***/
+
+static enum NParsyResult nparsy_npy_append(
+      struct NParsyNpyWriter * w,
+      enum NParsyNpyDtype dtype,
+      const void * vals,
+      size_t n )
+{
+   // Initial input validation
+   if ( (w == nullptr) || ((vals == nullptr) && (n > 0u)) )
+      return NParsy_NullPtr;
+   else if ( dtype != w->dtype )
+      return NParsy_InvalidDtype;
+   else if ( w->failed )
+      return NParsy_FileAccessFailed;
+
+   if ( (n > (w->cap - w->n)) && !nparsy_npy_grow(w, w->n + n) )
+   {
+      w->failed = true;
+      return NParsy_FileAccessFailed;
+   }
+
+   // Host byte order on both sides, so the values go in as-is
+   if ( n > 0u )
+      memcpy(w->map + NPARSY_NPY_HEADER_LEN + (w->n * NPARSY_NPY_ELEM_LEN), vals, n * NPARSY_NPY_ELEM_LEN);
+   w->n += n;
+
+   return NParsy_GoodResult;
+}
+
+/**
+ * @brief Grow the file and its mapping to hold at least min_cap elements.
+ * @note Capacity at least doubles so appends stay amortized O(1). The file
+ *       is trimmed back to the exact size on close.
+ */
+static bool nparsy_npy_grow(struct NParsyNpyWriter * w, size_t min_cap)
+{
+   size_t new_cap = (w->cap > (SIZE_MAX / 2u)) ? SIZE_MAX : (2u * w->cap);
+   if ( new_cap < min_cap )
+      new_cap = min_cap;
+   if ( new_cap > ((SIZE_MAX - NPARSY_NPY_HEADER_LEN) / NPARSY_NPY_ELEM_LEN) )
+      return false;
+
+   size_t old_len = NPARSY_NPY_HEADER_LEN + (w->cap * NPARSY_NPY_ELEM_LEN);
+   size_t new_len = NPARSY_NPY_HEADER_LEN + (new_cap * NPARSY_NPY_ELEM_LEN);
+   if ( (new_len > (size_t)INT64_MAX) || (ftruncate(w->fd, (off_t)new_len) != 0) )
+      return false;
+
+   void * map;
+#ifdef MREMAP_MAYMOVE
+   if ( w->map != nullptr )
+      map = mremap(w->map, old_len, new_len, MREMAP_MAYMOVE);
+   else
+#endif
+   {
+      if ( w->map != nullptr )
+         (void)munmap(w->map, old_len);
+      w->map = nullptr;
+      map = mmap(nullptr, new_len, PROT_READ | PROT_WRITE, MAP_SHARED, w->fd, 0);
+   }
+
+   if ( map == MAP_FAILED )
+   {
+      if ( (w->map != nullptr) || (w->cap == 0u) )
+         return false; // mremap failed (the old mapping is still good), or nothing was mapped yet
+
+      // The old mapping is gone; remap what we had so close can still finish up
+      w->map = mmap(nullptr, old_len, PROT_READ | PROT_WRITE, MAP_SHARED, w->fd, 0);
+      if ( w->map == MAP_FAILED )
+      {
+         w->map = nullptr;
+         w->cap = 0;
+         w->n = 0;
+      }
+      return false;
+   }
+
+   w->map = map;
+   w->cap = new_cap;
+   return true;
+}
+
+/**
+ * @brief Format version 1.0 header with the current shape, space-padded to
+ *        NPARSY_NPY_HEADER_LEN and ending in '\n'.
+ */
+static void nparsy_npy_write_header(struct NParsyNpyWriter * w)
+{
+   if ( w->map == nullptr )
+      return;
+
+   char * h = w->map;
+   memcpy(h, "\x93NUMPY\x01\x00", 8u);
+   h[8] = (char)(uint8_t)(NPARSY_NPY_HEADER_LEN - NPARSY_NPY_PREAMBLE_LEN);
+   h[9] = '\0';
+
+   char dict[NPARSY_NPY_HEADER_LEN - NPARSY_NPY_PREAMBLE_LEN + 1u];
+   int len = snprintf(dict, sizeof dict, "{'descr': '%s', 'fortran_order': False, 'shape': (%zu,), }",
+                      NpyDescrs[w->dtype], w->n);
+   size_t dict_len = (len > 0) ? (size_t)len : 0u;
+
+   memset(h + NPARSY_NPY_PREAMBLE_LEN, ' ', NPARSY_NPY_HEADER_LEN - NPARSY_NPY_PREAMBLE_LEN);
+   memcpy(h + NPARSY_NPY_PREAMBLE_LEN, dict, dict_len);
+   h[NPARSY_NPY_HEADER_LEN - 1u] = '\n';
+}
@@ -0,0 +1,410 @@
+/*!
+ * @file    nparsy_scan.c
+ * @brief   Implementation of NParsy's compiled scanf-style formats.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "nparsy_scan.h"
+#include "nparsy_kernels.h"
+
+/* Local Macro Definitions */
+
+/* Datatypes */
+enum ScanStepKind
+{
+   Step_Literal,  // chars that must match exactly
+   Step_Space,    // any run of whitespace, including none
+   Step_UInt,
+   Step_Int,
+   Step_Float,
+   Step_Str,
+};
+
+struct ScanStep
+{
+   enum ScanStepKind kind;
+   enum NParsyNumFormat fmt; // Step_UInt
+   bool assign;
+   size_t width;             // max chars in the field (SIZE_MAX if unlimited)
+   size_t lit_off;           // Step_Literal: slice of the plan's literal pool
+   size_t lit_len;
+};
+
+struct NParsyScanPlan
+{
+   size_t nsteps;
+   const char * lits;        // literal pool, stored right after steps
+   struct ScanStep steps[];
+};
+
+/* Local Data */
+
+/*** Private Function Prototypes ***/
+static enum NParsyResult nparsy_scan_uint(
+      const char ** p,
+      const char * fend,
+      enum NParsyNumFormat fmt,
+      uint64_t * val );
+static enum NParsyResult nparsy_scan_int(const char ** p, const char * fend, int64_t * val);
+static enum NParsyResult nparsy_scan_float(const char ** p, const char * fend, double * val);
+static inline bool nparsy_is_space(char ch);
+
+/* Public Function Implementations */
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyCompileFormat(
+      const char * fmt,
+      struct NParsyScanPlan ** plan )
+{
+   size_t flen = 0;
+
+   // Initial input validation
+   if ( (fmt == nullptr) || !nparsy_bounded_strlen(fmt, &flen) )
+      return NParsy_InvalidString;
+   else if ( plan == nullptr )
+      return NParsy_NullPtr;
+
+   // Every step takes up at least one char of fmt, and so does every literal char
+   size_t max_steps = flen + 1u;
+   struct NParsyScanPlan * pl = malloc(sizeof *pl + (max_steps * sizeof pl->steps[0]) + flen + 1u);
+   if ( pl == nullptr )
+      return NParsy_OutOfMemory;
+
+   char * lits = (char *)&pl->steps[max_steps];
+   size_t nlits = 0;
+   size_t n = 0;
+
+   for ( size_t i = 0; i < flen; )
+   {
+      char ch = fmt[i];
+
+      if ( nparsy_is_space(ch) )
+      {
+         while ( (i < flen) && nparsy_is_space(fmt[i]) )
+            ++i;
+         pl->steps[n++] = (struct ScanStep){ .kind = Step_Space };
+         continue;
+      }
+
+      if ( (ch != '%') || (fmt[i + 1u] == '%') )
+      {
+         // Consecutive literal chars are matched together
+         if ( (n == 0u) || (pl->steps[n - 1u].kind != Step_Literal) )
+            pl->steps[n++] = (struct ScanStep){ .kind = Step_Literal, .lit_off = nlits };
+         lits[nlits++] = ch;
+         pl->steps[n - 1u].lit_len++;
+         i += (ch == '%') ? 2u : 1u;
+         continue;
+      }
+
+      struct ScanStep step = { .assign = true, .width = SIZE_MAX };
+      ++i;
+      if ( fmt[i] == '*' )
+      {
+         step.assign = false;
+         ++i;
+      }
+
+      if ( nparsy_is_dec_digit(fmt[i]) )
+      {
+         size_t w = 0;
+         while ( nparsy_is_dec_digit(fmt[i]) && (w <= NPARSY_MAX_PARSABLE_STRING_LEN) )
+            w = (w * 10u) + (size_t)(fmt[i++] - '0');
+         if ( (w == 0u) || (w > NPARSY_MAX_PARSABLE_STRING_LEN) )
+         {
+            free(pl);
+            return NParsy_InvalidFormat;
+         }
+         step.width = w;
+      }
+
+      switch ( fmt[i] )
+      {
+         case 'u': step.kind = Step_UInt; step.fmt = NParsy_Dec; break;
+         case 'x': step.kind = Step_UInt; step.fmt = NParsy_Hex; break;
+         case 'o': step.kind = Step_UInt; step.fmt = NParsy_Oct; break;
+         case 'b': step.kind = Step_UInt; step.fmt = NParsy_Bin; break;
+         case 'd': step.kind = Step_Int;   break;
+         case 'f': step.kind = Step_Float; break;
+         case 's': step.kind = Step_Str;   break;
+         default:
+            free(pl);
+            return NParsy_InvalidFormat;
+      }
+
+      // An unbounded %s could overrun any buffer it's handed
+      if ( (step.kind == Step_Str) && (step.width == SIZE_MAX) )
+      {
+         free(pl);
+         return NParsy_InvalidFormat;
+      }
+
+      pl->steps[n++] = step;
+      ++i;
+   }
+
+   pl->nsteps = n;
+   pl->lits = lits;
+   *plan = pl;
+
+   return NParsy_GoodResult;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyScan(
+      const struct NParsyScanPlan * plan,
+      const char * str,
+      size_t * num_assigned,
+      ... )
+{
+   va_list args;
+   va_start(args, num_assigned);
+   enum NParsyResult result = NParsyVScan(plan, str, num_assigned, args);
+   va_end(args);
+
+   return result;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyVScan(
+      const struct NParsyScanPlan * plan,
+      const char * str,
+      size_t * num_assigned,
+      va_list args )
+{
+   size_t slen = 0;
+
+   // Initial input validation
+   if ( (str == nullptr) || !nparsy_bounded_strlen(str, &slen) )
+      return NParsy_InvalidString;
+   else if ( plan == nullptr )
+      return NParsy_NullPtr;
+
+   const char * p = str;
+   const char * end = str + slen;
+   size_t assigned = 0;
+   enum NParsyResult result = NParsy_GoodResult;
+
+   for ( size_t i = 0; (i < plan->nsteps) && (result == NParsy_GoodResult); i++ )
+   {
+      const struct ScanStep * step = &plan->steps[i];
+
+      if ( step->kind == Step_Literal )
+      {
+         if ( ((size_t)(end - p) < step->lit_len) || (memcmp(p, plan->lits + step->lit_off, step->lit_len) != 0) )
+            result = NParsy_FormatMismatch;
+         else
+            p += step->lit_len;
+         continue;
+      }
+
+      while ( (p < end) && nparsy_is_space(*p) )
+         ++p;
+      if ( step->kind == Step_Space )
+         continue;
+
+      const char * fend = ((size_t)(end - p) > step->width) ? (p + step->width) : end;
+
+      switch ( step->kind )
+      {
+         case Step_UInt:
+         {
+            uint64_t val = 0;
+            result = nparsy_scan_uint(&p, fend, step->fmt, &val);
+            if ( (result == NParsy_GoodResult) && step->assign )
+               *va_arg(args, uint64_t *) = val;
+            break;
+         }
+
+         case Step_Int:
+         {
+            int64_t val = 0;
+            result = nparsy_scan_int(&p, fend, &val);
+            if ( (result == NParsy_GoodResult) && step->assign )
+               *va_arg(args, int64_t *) = val;
+            break;
+         }
+
+         case Step_Float:
+         {
+            double val = 0.0;
+            result = nparsy_scan_float(&p, fend, &val);
+            if ( (result == NParsy_GoodResult) && step->assign )
+               *va_arg(args, double *) = val;
+            break;
+         }
+
+         case Step_Str:
+         {
+            const char * q = p;
+            while ( (q < fend) && !nparsy_is_space(*q) )
+               ++q;
+            if ( q == p )
+            {
+               result = NParsy_FormatMismatch;
+               break;
+            }
+            if ( step->assign )
+            {
+               char * out = va_arg(args, char *);
+               memcpy(out, p, (size_t)(q - p));
+               out[q - p] = '\0';
+            }
+            p = q;
+            break;
+         }
+
+         case Step_Literal:
+         case Step_Space:
+         default:
+            break;
+      }
+
+      if ( (result == NParsy_GoodResult) && step->assign )
+         assigned++;
+   }
+
+   if ( num_assigned != nullptr )
+      *num_assigned = assigned;
+
+   return result;
+}
+
+/******************************************************************************/
+void NParsyFreeFormat(struct NParsyScanPlan * plan)
+{
+   free(plan);
+}
+
+/*** Private Function Implementations ***/
+
+/**
+ * @brief Convert the run of fmt digits at *p (after an optional 0x/0b/0o
+ *        prefix for the power-of-two formats) and move *p past it.
+ */
+static enum NParsyResult nparsy_scan_uint(
+      const char ** p,
+      const char * fend,
+      enum NParsyNumFormat fmt,
+      uint64_t * val )
+{
+   const char * q = *p;
+
+   if ( fmt == NParsy_Dec )
+   {
+      size_t ndigits = 0;
+      bool overflow = false;
+      q = nparsy_dec_run(q, fend, (size_t)(fend - q), val, &ndigits, &overflow);
+      if ( ndigits == 0u )
+         return NParsy_FormatMismatch;
+      *p = q;
+      return overflow ? NParsy_NumberOutOfRange : NParsy_GoodResult;
+   }
+
+   // The prefix only counts as one if a digit follows it within the field
+   char prefix = (fmt == NParsy_Hex) ? 'x' : ((fmt == NParsy_Bin) ? 'b' : 'o');
+   if ( ((fend - q) > 2) && (q[0] == '0') && ((q[1] | 0x20) == prefix) && nparsy_is_fmt_digit(q[2], fmt) )
+      q += 2;
+
+   const char * d = q;
+   while ( (q < fend) && nparsy_is_fmt_digit(*q, fmt) )
+      ++q;
+   if ( q == d )
+      return NParsy_FormatMismatch;
+   *p = q;
+
+   size_t n = nparsy_strip_leading_zeros(&d, (size_t)(q - d));
+   if ( ((fmt == NParsy_Hex) && (n > 16u))
+        || ((fmt == NParsy_Bin) && (n > 64u))
+        || ((fmt == NParsy_Oct) && ((n > 22u) || ((n == 22u) && (*d > '1')))) )
+      return NParsy_NumberOutOfRange;
+
+   *val = nparsy_pow2_run_to_u64(d, d + n, fmt);
+   return NParsy_GoodResult;
+}
+
+static enum NParsyResult nparsy_scan_int(const char ** p, const char * fend, int64_t * val)
+{
+   const char * q = *p;
+   bool negative = false;
+
+   if ( (q < fend) && ((*q == '-') || (*q == '+')) )
+   {
+      negative = (*q == '-');
+      ++q;
+   }
+
+   uint64_t mag = 0;
+   size_t ndigits = 0;
+   bool overflow = false;
+   q = nparsy_dec_run(q, fend, (size_t)(fend - q), &mag, &ndigits, &overflow);
+   if ( ndigits == 0u )
+      return NParsy_FormatMismatch;
+   *p = q;
+
+   if ( overflow || (mag > (negative ? ((uint64_t)INT64_MAX + 1u) : (uint64_t)INT64_MAX)) )
+      return NParsy_NumberOutOfRange;
+
+   *val = negative ? (int64_t)(0u - mag) : (int64_t)mag;
+   return NParsy_GoodResult;
+}
+
+/**
+ * @brief Convert [+-]digits[.digits][e[+-]digits] at *p and move *p past it.
+ * @note See nparsy_dec_to_double for how the digits are converted.
+ */
+static enum NParsyResult nparsy_scan_float(const char ** p, const char * fend, double * val)
+{
+   const char * start = *p;
+   const char * q = start;
+
+   if ( (q < fend) && ((*q == '-') || (*q == '+')) )
+      ++q;
+
+   const char * int_digits = q;
+   const char * int_end = nparsy_skip_dec_run(q, fend);
+   const char * e = int_end;
+   const char * frac_digits = int_end;
+   size_t nfrac = 0;
+   if ( (e < fend) && (*e == '.') )
+   {
+      frac_digits = e + 1;
+      e = nparsy_skip_dec_run(frac_digits, fend);
+      nfrac = (size_t)(e - frac_digits);
+   }
+   size_t nint = (size_t)(int_end - int_digits);
+   if ( (nint + nfrac) == 0u )
+      return NParsy_FormatMismatch;
+
+   if ( (e < fend) && ((*e | 0x20) == 'e') )
+   {
+      const char * t = e + 1;
+      if ( (t < fend) && ((*t == '-') || (*t == '+')) )
+         ++t;
+      if ( (t < fend) && nparsy_is_dec_digit(*t) )
+         e = nparsy_skip_dec_run(t, fend);
+   }
+   *p = e;
+
+   if ( !nparsy_dec_to_double(start, e, val) )
+      return NParsy_NumberOutOfRange;
+
+   return NParsy_GoodResult;
+}
+
+static inline bool nparsy_is_space(char ch)
+{
+   return (ch == ' ') || ((ch >= '\t') && (ch <= '\r'));
+}
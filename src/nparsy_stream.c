@@ -0,0 +1,647 @@
+/*!
+ * @file    nparsy_stream.c
+ * @brief   Implementation of NParsy's streaming unsigned integer parsing.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* Feature Test Macros */
+// pread is hidden under a strict -std
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "nparsy_stream.h"
+#include "nparsy_kernels.h"
+
+/* Local Macro Definitions */
+
+/* Datatypes */
+constexpr size_t NPARSY_STREAM_BATCH_LEN = 64u;
+
+// Parses a stream fed in arbitrary pieces, carrying any number cut off at
+// the end of one piece over to the next
+struct NParsyUIntStream
+{
+   enum NParsyNumFormat default_fmt;
+   NParsyUIntSink sink;
+   void * ctx;
+
+   char carry[NPARSY_STREAM_CARRY_LEN];
+   size_t carry_len;
+   char carry_prev;  // char just before carry[0]
+   char prev;        // last char fed so far
+   bool skipping;    // in the middle of a number too long to carry
+
+   uint64_t batch[NPARSY_STREAM_BATCH_LEN];
+   size_t batch_len;
+   size_t delivered;
+   bool stopped;     // sink asked to stop
+};
+
+// Follows a growing file, reading only what was appended since last time
+struct NParsyUIntTail
+{
+   int fd;
+   off_t offset;  // next byte to read
+   struct NParsyUIntStream s;
+   char buf[NPARSY_STREAM_DEFAULT_CHUNK_LEN];
+};
+
+// Two buffers handed back and forth between the reader thread and the parser
+struct DoubleBuffer
+{
+   pthread_mutex_t mtx;
+   pthread_cond_t cv;
+   int fd;
+   size_t cap;
+   char * buf[2];
+   size_t len[2];
+   bool full[2];
+   bool eof;
+   bool stop;
+   int err;
+};
+
+/* Local Data */
+
+/*** Private Function Prototypes ***/
+static void nparsy_stitcher_init(
+      struct NParsyUIntStream * s,
+      NParsyUIntSink sink,
+      void * ctx,
+      enum NParsyNumFormat default_fmt );
+static void nparsy_stitcher_feed(struct NParsyUIntStream * s, const char * data, size_t n);
+static void nparsy_stitcher_finish(struct NParsyUIntStream * s);
+static const char * nparsy_stitcher_resume(struct NParsyUIntStream * s, const char * data, size_t n);
+static void nparsy_stitcher_carry(struct NParsyUIntStream * s, const char * begin, const char * end, char before);
+static void nparsy_stitcher_emit(struct NParsyUIntStream * s, const struct Token * tok);
+static void nparsy_stitcher_flush(struct NParsyUIntStream * s);
+static const char * nparsy_skip_token_tail(const char * p, const char * end);
+static void * nparsy_reader_thread(void * arg);
+
+/* Public Function Implementations */
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntStreamFd(
+      int fd,
+      size_t chunk_len,
+      NParsyUIntSink sink,
+      void * ctx,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt )
+{
+   // Initial input validation
+   if ( sink == nullptr )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+   else if ( fd < 0 )
+      return NParsy_FileAccessFailed;
+
+   if ( chunk_len == 0u )
+      chunk_len = NPARSY_STREAM_DEFAULT_CHUNK_LEN;
+
+   struct DoubleBuffer db = { .fd = fd, .cap = chunk_len };
+   db.buf[0] = malloc(chunk_len);
+   db.buf[1] = malloc(chunk_len);
+   if ( (db.buf[0] == nullptr) || (db.buf[1] == nullptr) )
+   {
+      free(db.buf[0]);
+      free(db.buf[1]);
+      return NParsy_OutOfMemory;
+   }
+
+   struct NParsyUIntStream * s = malloc(sizeof *s);
+   pthread_t reader;
+   bool started = false;
+   if ( s != nullptr )
+   {
+      (void)pthread_mutex_init(&db.mtx, nullptr);
+      (void)pthread_cond_init(&db.cv, nullptr);
+      started = (pthread_create(&reader, nullptr, nparsy_reader_thread, &db) == 0);
+      if ( !started )
+      {
+         (void)pthread_cond_destroy(&db.cv);
+         (void)pthread_mutex_destroy(&db.mtx);
+      }
+   }
+   if ( !started )
+   {
+      free(s);
+      free(db.buf[0]);
+      free(db.buf[1]);
+      return NParsy_OutOfMemory;
+   }
+
+   nparsy_stitcher_init(s, sink, ctx, default_fmt);
+
+   // Parse buffer i while the reader fills buffer i ^ 1
+   for ( unsigned i = 0; ; i ^= 1u )
+   {
+      (void)pthread_mutex_lock(&db.mtx);
+      while ( !db.full[i] && !db.eof )
+         (void)pthread_cond_wait(&db.cv, &db.mtx);
+      bool have_chunk = db.full[i];
+      (void)pthread_mutex_unlock(&db.mtx);
+
+      // The reader fills buffers in order, so once an unfilled one is
+      // reached after EOF, everything has been parsed
+      if ( !have_chunk )
+         break;
+
+      nparsy_stitcher_feed(s, db.buf[i], db.len[i]);
+
+      (void)pthread_mutex_lock(&db.mtx);
+      db.full[i] = false;
+      if ( s->stopped )
+         db.stop = true;
+      (void)pthread_cond_signal(&db.cv);
+      (void)pthread_mutex_unlock(&db.mtx);
+
+      if ( s->stopped )
+      {
+         // The reader may be blocked in read() on a quiet pipe
+         (void)pthread_cancel(reader);
+         break;
+      }
+   }
+
+   (void)pthread_join(reader, nullptr);
+
+   if ( !s->stopped )
+      nparsy_stitcher_finish(s);
+
+   enum NParsyResult result = (db.err != 0) ? NParsy_FileAccessFailed : NParsy_GoodResult;
+   if ( num_parsed != nullptr )
+      *num_parsed = s->delivered;
+
+   (void)pthread_cond_destroy(&db.cv);
+   (void)pthread_mutex_destroy(&db.mtx);
+   free(s);
+   free(db.buf[0]);
+   free(db.buf[1]);
+
+   return result;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntStreamBegin(
+      struct NParsyUIntStream ** stream,
+      NParsyUIntSink sink,
+      void * ctx,
+      enum NParsyNumFormat default_fmt )
+{
+   // Initial input validation
+   if ( (stream == nullptr) || (sink == nullptr) )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+
+   struct NParsyUIntStream * s = malloc(sizeof *s);
+   if ( s == nullptr )
+      return NParsy_OutOfMemory;
+
+   nparsy_stitcher_init(s, sink, ctx, default_fmt);
+   *stream = s;
+
+   return NParsy_GoodResult;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntStreamFeed(
+      struct NParsyUIntStream * stream,
+      const char * chunk,
+      size_t len )
+{
+   // Initial input validation
+   if ( stream == nullptr )
+      return NParsy_NullPtr;
+   else if ( (chunk == nullptr) && (len > 0u) )
+      return NParsy_InvalidString;
+
+   nparsy_stitcher_feed(stream, chunk, len);
+
+   return NParsy_GoodResult;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntStreamFeedStr(
+      struct NParsyUIntStream * stream,
+      const char * str )
+{
+   size_t slen;
+
+   // Initial input validation
+   if ( stream == nullptr )
+      return NParsy_NullPtr;
+   else if ( (str == nullptr) || !nparsy_bounded_strlen(str, &slen) )
+      return NParsy_InvalidString;
+
+   nparsy_stitcher_feed(stream, str, slen);
+
+   return NParsy_GoodResult;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntStreamEnd(
+      struct NParsyUIntStream * stream,
+      size_t * num_parsed )
+{
+   if ( stream == nullptr )
+      return NParsy_NullPtr;
+
+   if ( !stream->stopped )
+      nparsy_stitcher_finish(stream);
+
+   if ( num_parsed != nullptr )
+      *num_parsed = stream->delivered;
+
+   free(stream);
+
+   return NParsy_GoodResult;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntTailBegin(
+      struct NParsyUIntTail ** tail,
+      int fd,
+      off_t start,
+      NParsyUIntSink sink,
+      void * ctx,
+      enum NParsyNumFormat default_fmt )
+{
+   // Initial input validation
+   if ( (tail == nullptr) || (sink == nullptr) )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+   else if ( (fd < 0) || (start < 0) )
+      return NParsy_FileAccessFailed;
+
+   struct NParsyUIntTail * t = malloc(sizeof *t);
+   if ( t == nullptr )
+      return NParsy_OutOfMemory;
+
+   t->fd = fd;
+   t->offset = start;
+   nparsy_stitcher_init(&t->s, sink, ctx, default_fmt);
+
+   // Resuming mid-file: the char before start decides e.g. whether a
+   // number starting right at start is part of a word
+   if ( (start > 0) && (pread(fd, &t->s.prev, 1u, start - 1) != 1) )
+   {
+      free(t);
+      return NParsy_FileAccessFailed;
+   }
+
+   *tail = t;
+
+   return NParsy_GoodResult;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntTailPoll(
+      struct NParsyUIntTail * tail,
+      size_t * num_new,
+      off_t * resume_offset )
+{
+   if ( tail == nullptr )
+      return NParsy_NullPtr;
+
+   enum NParsyResult result = NParsy_GoodResult;
+   size_t delivered_before = tail->s.delivered;
+   struct stat st;
+
+   if ( fstat(tail->fd, &st) != 0 )
+   {
+      result = NParsy_FileAccessFailed;
+   }
+   else
+   {
+      if ( st.st_size < tail->offset )
+      {
+         // Truncated under us - whatever was carried belongs to the old contents
+         size_t delivered = tail->s.delivered;
+         nparsy_stitcher_init(&tail->s, tail->s.sink, tail->s.ctx, tail->s.default_fmt);
+         tail->s.delivered = delivered;
+         tail->offset = 0;
+      }
+
+      while ( (tail->offset < st.st_size) && !tail->s.stopped )
+      {
+         off_t left = st.st_size - tail->offset;
+         size_t want = (left < (off_t)sizeof tail->buf) ? (size_t)left : sizeof tail->buf;
+         ssize_t nread;
+         do
+            nread = pread(tail->fd, tail->buf, want, tail->offset);
+         while ( (nread < 0) && (errno == EINTR) );
+
+         if ( nread < 0 )
+            result = NParsy_FileAccessFailed;
+         if ( nread <= 0 )
+            break; // Error, or the file shrank since fstat - the next poll sorts it out
+
+         nparsy_stitcher_feed(&tail->s, tail->buf, (size_t)nread);
+         tail->offset += nread;
+      }
+   }
+
+   if ( num_new != nullptr )
+      *num_new = tail->s.delivered - delivered_before;
+   if ( resume_offset != nullptr )
+      *resume_offset = tail->offset - (off_t)tail->s.carry_len;
+
+   return result;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntTailEnd(
+      struct NParsyUIntTail * tail,
+      size_t * num_parsed )
+{
+   if ( tail == nullptr )
+      return NParsy_NullPtr;
+
+   if ( !tail->s.stopped )
+      nparsy_stitcher_finish(&tail->s);
+
+   if ( num_parsed != nullptr )
+      *num_parsed = tail->s.delivered;
+
+   free(tail);
+
+   return NParsy_GoodResult;
+}
+
+/*** Private Function Implementations ***/
+
+static void nparsy_stitcher_init(
+      struct NParsyUIntStream * s,
+      NParsyUIntSink sink,
+      void * ctx,
+      enum NParsyNumFormat default_fmt )
+{
+   s->default_fmt = default_fmt;
+   s->sink = sink;
+   s->ctx = ctx;
+   s->carry_len = 0;
+   s->carry_prev = '\0';
+   s->prev = '\0';
+   s->skipping = false;
+   s->batch_len = 0;
+   s->delivered = 0;
+   s->stopped = false;
+}
+
+/**
+ * @brief Parse the next piece of the stream.
+ */
+static void nparsy_stitcher_feed(struct NParsyUIntStream * s, const char * data, size_t n)
+{
+   const char * p = data;
+   const char * end = data + n;
+
+   if ( (n == 0u) || s->stopped )
+      return;
+
+   if ( s->skipping )
+   {
+      p = nparsy_skip_token_tail(p, end);
+      s->skipping = (p == end);
+   }
+   else if ( s->carry_len > 0u )
+   {
+      p = nparsy_stitcher_resume(s, data, n);
+      if ( s->skipping && (p < end) )
+      {
+         p = nparsy_skip_token_tail(p, end);
+         s->skipping = (p == end);
+      }
+   }
+
+   struct Token tok;
+   while ( (p < end) && !s->stopped )
+   {
+      char before = (p > data) ? p[-1] : s->prev;
+      enum ScanStatus st = nparsy_next_token(p, end, before, false, s->default_fmt, &tok);
+
+      if ( st == Scan_Found )
+      {
+         nparsy_stitcher_emit(s, &tok);
+         p = tok.end;
+      }
+      else
+      {
+         if ( st == Scan_NeedMore )
+            nparsy_stitcher_carry(s, tok.begin, end, (tok.begin > data) ? tok.begin[-1] : s->prev);
+         break;
+      }
+   }
+
+   s->prev = end[-1];
+   nparsy_stitcher_flush(s); // Don't sit on values while the next read blocks
+}
+
+/**
+ * @brief End of stream: whatever was carried over is complete now.
+ */
+static void nparsy_stitcher_finish(struct NParsyUIntStream * s)
+{
+   const char * p = s->carry;
+   const char * end = s->carry + s->carry_len;
+   struct Token tok;
+
+   if ( !s->skipping )
+   {
+      while ( !s->stopped
+              && (nparsy_next_token(p, end, (p > s->carry) ? p[-1] : s->carry_prev, true, s->default_fmt, &tok) == Scan_Found) )
+      {
+         nparsy_stitcher_emit(s, &tok);
+         p = tok.end;
+      }
+   }
+
+   s->carry_len = 0;
+   s->skipping = false;
+   nparsy_stitcher_flush(s);
+}
+
+/**
+ * @brief Finish off the carried-over number using the start of the new piece.
+ * @note The carry and up to NPARSY_STREAM_CARRY_LEN chars of data are scanned
+ *       together until the scan moves past the carried chars.
+ * @return where in data to carry on scanning from
+ */
+static const char * nparsy_stitcher_resume(struct NParsyUIntStream * s, const char * data, size_t n)
+{
+   char sb[2u * NPARSY_STREAM_CARRY_LEN];
+   size_t c = s->carry_len;
+   size_t take = (n < NPARSY_STREAM_CARRY_LEN) ? n : NPARSY_STREAM_CARRY_LEN;
+
+   memcpy(sb, s->carry, c);
+   memcpy(sb + c, data, take);
+   s->carry_len = 0;
+
+   const char * q = sb;
+   const char * data_start = sb + c;
+   const char * end = data_start + take;
+   struct Token tok;
+
+   while ( (q < data_start) && !s->stopped )
+   {
+      char before = (q > sb) ? q[-1] : s->carry_prev;
+      enum ScanStatus st = nparsy_next_token(q, end, before, false, s->default_fmt, &tok);
+
+      if ( st == Scan_None )
+         return data + take;
+      else if ( tok.begin >= data_start )
+         return data + (tok.begin - data_start); // Starts in data proper - scan it there
+      else if ( st == Scan_Found )
+      {
+         nparsy_stitcher_emit(s, &tok);
+         q = tok.end;
+      }
+      else if ( take == n )
+      {
+         // Still cut off, and all of data went into sb: carry it all
+         nparsy_stitcher_carry(s, tok.begin, end, (tok.begin > sb) ? tok.begin[-1] : s->carry_prev);
+         return data + n;
+      }
+      else
+      {
+         // Longer than any carry could hold
+         s->skipping = true;
+         return data + take;
+      }
+   }
+
+   return data + (q - data_start);
+}
+
+/**
+ * @brief Hold on to [begin, end), a number cut off at the end of a piece.
+ */
+static void nparsy_stitcher_carry(struct NParsyUIntStream * s, const char * begin, const char * end, char before)
+{
+   size_t len = (size_t)(end - begin);
+
+   if ( len > NPARSY_STREAM_CARRY_LEN )
+   {
+      s->skipping = true;
+      s->carry_len = 0;
+      return;
+   }
+
+   // begin may point into s->carry itself
+   memmove(s->carry, begin, len);
+   s->carry_len = len;
+   s->carry_prev = before;
+}
+
+static void nparsy_stitcher_emit(struct NParsyUIntStream * s, const struct Token * tok)
+{
+   uint64_t val = 0;
+
+   // Negatives, floats, malformed, and out-of-range numbers are skipped
+   if ( (tok->kind != Token_UInt) || !nparsy_token_to_u64(tok, &val) )
+      return;
+
+   s->batch[s->batch_len++] = val;
+   if ( s->batch_len == NPARSY_STREAM_BATCH_LEN )
+      nparsy_stitcher_flush(s);
+}
+
+static void nparsy_stitcher_flush(struct NParsyUIntStream * s)
+{
+   if ( (s->batch_len == 0u) || s->stopped )
+      return;
+
+   s->delivered += s->batch_len;
+   s->stopped = !s->sink(s->batch, s->batch_len, s->ctx);
+   s->batch_len = 0;
+}
+
+/**
+ * @brief Skip whatever is left of an overly long number.
+ */
+static const char * nparsy_skip_token_tail(const char * p, const char * end)
+{
+   while ( (p < end) && (nparsy_is_alnum(*p) || (*p == '.')) )
+      ++p;
+   return p;
+}
+
+/**
+ * @brief Fill the two buffers in turn until EOF, a read error, or a stop.
+ * @note Cancellation is only allowed while blocked in read(), never while
+ *       holding the mutex.
+ */
+static void * nparsy_reader_thread(void * arg)
+{
+   struct DoubleBuffer * db = arg;
+   (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, nullptr);
+
+   for ( unsigned i = 0; ; i ^= 1u )
+   {
+      (void)pthread_mutex_lock(&db->mtx);
+      while ( db->full[i] && !db->stop )
+         (void)pthread_cond_wait(&db->cv, &db->mtx);
+      bool stop = db->stop;
+      (void)pthread_mutex_unlock(&db->mtx);
+
+      if ( stop )
+         break;
+
+      ssize_t nread;
+      int err = 0;
+      do
+      {
+         (void)pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, nullptr);
+         nread = read(db->fd, db->buf[i], db->cap);
+         (void)pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, nullptr);
+      }
+      while ( (nread < 0) && (errno == EINTR) );
+      if ( nread < 0 )
+         err = errno;
+
+      (void)pthread_mutex_lock(&db->mtx);
+      if ( nread > 0 )
+      {
+         db->len[i] = (size_t)nread;
+         db->full[i] = true;
+      }
+      else
+      {
+         db->err = err;
+         db->eof = true;
+      }
+      (void)pthread_cond_signal(&db->cv);
+      (void)pthread_mutex_unlock(&db->mtx);
+
+      if ( nread <= 0 )
+         break;
+   }
+
+   return nullptr;
+}
@@ -0,0 +1,225 @@
+/*!
+ * @file    nparsy_u128.c
+ * @brief   Implementation of NParsy's 128-bit unsigned integer parsing.
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdckdint.h>
+
+#include "nparsy_u128.h"
+#include "nparsy_kernels.h"
+
+#ifdef __SIZEOF_INT128__
+
+/* Local Macro Definitions */
+
+/* Datatypes */
+
+/* Local Data */
+constexpr size_t NPARSY_U128_HALF_DEC_DIGITS = 19u; // 10^19 < 2^64
+
+/*** Private Function Prototypes ***/
+static bool nparsy_token_to_u128(const struct Token * tok, nparsy_u128_t * val);
+static uint64_t nparsy_dec19_to_u64(const char * d, size_t n);
+
+/* Public Function Implementations */
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyU128(
+      const char * str,
+      nparsy_u128_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt )
+{
+   size_t slen = 0;
+
+   // Initial input validation
+   if ( str == nullptr || !nparsy_bounded_strlen(str, &slen) )
+      return NParsy_InvalidString;
+   else if ( parsed_val == nullptr )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+
+   const char * p = str;
+   const char * end = str + slen;
+   enum NParsyResult result = NParsy_NoNumberFound;
+   struct Token tok;
+
+   while ( nparsy_next_token(p, end, (p > str) ? p[-1] : '\0', true, default_fmt, &tok) == Scan_Found )
+   {
+      p = tok.end;
+      if ( tok.kind != Token_UInt )
+         continue;
+
+      nparsy_u128_t val = 0;
+      if ( nparsy_token_to_u128(&tok, &val) )
+      {
+         *parsed_val = val;
+         result = NParsy_GoodResult;
+      }
+      else
+      {
+         result = NParsy_NumberOutOfRange;
+      }
+      break;
+   }
+
+   if ( result == NParsy_NoNumberFound )
+      p = end;
+
+   if ( accumulated_strlen != nullptr )
+      *accumulated_strlen = (size_t)(p - str);
+
+   return result;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyU128List(
+      const char * str,
+      nparsy_u128_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt )
+{
+   size_t slen = 0;
+
+   // Initial input validation
+   if ( str == nullptr || !nparsy_bounded_strlen(str, &slen) )
+      return NParsy_InvalidString;
+   else if ( buf == nullptr )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+
+   const char * p = str;
+   const char * end = str + slen;
+   size_t nparsed = 0;
+   struct Token tok;
+
+   while ( (nparsed < len)
+           && (nparsy_next_token(p, end, (p > str) ? p[-1] : '\0', true, default_fmt, &tok) == Scan_Found) )
+   {
+      p = tok.end;
+      if ( tok.kind != Token_UInt )
+         continue;
+
+      nparsy_u128_t val = 0;
+      if ( nparsy_token_to_u128(&tok, &val) )
+         buf[nparsed++] = val;
+      // Out-of-range numbers are skipped, just like NParsyUIntList
+   }
+
+   if ( num_parsed != nullptr )
+      *num_parsed = nparsed;
+
+   return NParsy_GoodResult;
+}
+
+/*** Private Function Implementations ***/
+
+/**
+ * @brief Convert a token's digits straight into 128 bits.
+ * @note Decimal splits into two 19-digit halves, each run through the SWAR
+ *       decimal kernel, joined by a single 128-bit multiply-add. Hex and
+ *       binary fill the high and low 64-bit halves directly.
+ * @return false if the value doesn't fit
+ */
+static bool nparsy_token_to_u128(const struct Token * tok, nparsy_u128_t * val)
+{
+   const char * d = tok->digits;
+   size_t n = nparsy_strip_leading_zeros(&d, tok->ndigits);
+   const char * end = d + n;
+
+   switch ( tok->fmt )
+   {
+      case NParsy_Dec:
+      {
+         // 2^128 - 1 has 39 digits
+         if ( n > 39u )
+            return false;
+         if ( n <= NPARSY_U128_HALF_DEC_DIGITS )
+         {
+            *val = nparsy_dec19_to_u64(d, n);
+            return true;
+         }
+
+         size_t nhi = n - NPARSY_U128_HALF_DEC_DIGITS;
+         nparsy_u128_t hi;
+         if ( nhi > NPARSY_U128_HALF_DEC_DIGITS )
+         {
+            // 39 digits: the 20-digit high half may itself exceed 64 bits
+            hi = ((nparsy_u128_t)(uint64_t)(*d - '0') * nparsy_pow10[NPARSY_U128_HALF_DEC_DIGITS])
+                 + nparsy_dec19_to_u64(d + 1, NPARSY_U128_HALF_DEC_DIGITS);
+         }
+         else
+         {
+            hi = nparsy_dec19_to_u64(d, nhi);
+         }
+         uint64_t lo = nparsy_dec19_to_u64(d + nhi, NPARSY_U128_HALF_DEC_DIGITS);
+
+         nparsy_u128_t acc;
+         if ( ckd_mul(&acc, hi, (nparsy_u128_t)nparsy_pow10[NPARSY_U128_HALF_DEC_DIGITS])
+              || ckd_add(&acc, acc, (nparsy_u128_t)lo) )
+            return false;
+         *val = acc;
+         return true;
+      }
+
+      case NParsy_Hex:
+      case NParsy_Bin:
+      {
+         size_t half = 64u / nparsy_fmt_bits(tok->fmt);
+         if ( n > (2u * half) )
+            return false;
+
+         const char * split = (n > half) ? (end - half) : d;
+         uint64_t hi = nparsy_pow2_run_to_u64(d, split, tok->fmt);
+         uint64_t lo = nparsy_pow2_run_to_u64(split, end, tok->fmt);
+         *val = ((nparsy_u128_t)hi << 64) | lo;
+         return true;
+      }
+
+      case NParsy_Oct:
+      {
+         // 43 octal digits = 129 bits, so the leading digit may only carry 2 bits
+         if ( (n > 43u) || ((n == 43u) && (*d > '3')) )
+            return false;
+
+         // Octal digits don't divide a 64-bit half evenly; 21 digits fill 63 bits
+         const char * split = (n > 21u) ? (end - 21) : d;
+         nparsy_u128_t hi = 0;
+         for ( ; d < split; ++d )
+            hi = (hi << 3) | nparsy_digit_val(*d);
+         *val = (hi << 63) | nparsy_pow2_run_to_u64(split, end, NParsy_Oct);
+         return true;
+      }
+
+      case NParsy_NumOfFmts:
+      default:
+         return false;
+   }
+}
+
+/**
+ * @brief Up to 19 decimal digits, which always fit in a uint64_t.
+ */
+static uint64_t nparsy_dec19_to_u64(const char * d, size_t n)
+{
+   uint64_t acc = 0;
+   size_t ndigits = 0;
+   bool overflow = false;
+   (void)nparsy_dec_run(d, d + n, n, &acc, &ndigits, &overflow);
+   return acc;
+}
+
+#endif // __SIZEOF_INT128__
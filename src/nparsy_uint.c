@@ -14,15 +14,140 @@
 #include <string.h>
 
 #include "nparsy_uint.h"
+#include "nparsy_kernels.h"
 
 /* Local Macro Definitions */
 
+// Stamp out the single and list parsers for one result width and strictness
+// (opts). Each gets its own copy of the scan loop with the width's limits and
+// the strictness folded in as constants.
+#define NPARSY_DEFINE_UINT_PARSERS(name, list_name, type, limits, opts)    \
+   [[nodiscard]]                                                          \
+   enum NParsyResult name(                                                \
+         const char * str,                                                \
+         type * parsed_val,                                               \
+         size_t * accumulated_strlen,                                     \
+         enum NParsyNumFormat default_fmt )                               \
+   {                                                                      \
+      uint64_t val = 0;                                                   \
+      enum NParsyResult result = nparsy_uint_first( str, parsed_val != nullptr, \
+                                    &(limits), &val,                      \
+                                    accumulated_strlen, default_fmt,      \
+                                    &(opts), nullptr );                   \
+      if ( result == NParsy_GoodResult )                                  \
+         *parsed_val = (type)val;                                         \
+      return result;                                                      \
+   }                                                                      \
+                                                                          \
+   [[nodiscard]]                                                          \
+   enum NParsyResult list_name(                                           \
+         const char * str,                                                \
+         type * buf,                                                      \
+         size_t len,                                                      \
+         size_t * num_parsed,                                             \
+         enum NParsyNumFormat default_fmt )                               \
+   {                                                                      \
+      size_t slen = 0;                                                    \
+      enum NParsyResult result = nparsy_uint_validate( str, buf != nullptr, \
+                                                       default_fmt, &slen ); \
+      if ( result != NParsy_GoodResult )                                  \
+         return result;                                                   \
+                                                                          \
+      const char * p = str;                                               \
+      const char * end = str + slen;                                      \
+      size_t nparsed = 0;                                                 \
+      uint64_t val = 0;                                                   \
+      while ( (nparsed < len)                                             \
+              && nparsy_uint_next(str, &p, end, &(limits), &val,          \
+                                  default_fmt, &(opts), nullptr) )        \
+         buf[nparsed++] = (type)val;                                      \
+                                                                          \
+      if ( num_parsed != nullptr )                                        \
+         *num_parsed = nparsed;                                           \
+      return NParsy_GoodResult;                                           \
+   }
+
 /* Datatypes */
+// What fits in a given result width
+struct UIntLimits
+{
+   uint64_t max;
+   uint8_t max_digits[NParsy_NumOfFmts]; // significant digits, indexed by format
+};
+
+// The number shapes NParsyU64ListAdaptive has specialized kernels for
+enum UIntShape
+{
+   Shape_BareDec,      // 1234, under the dec default
+   Shape_PrefixedHex,  // 0x1F / 0X1F
+   Shape_BareHex,      // 1f, under the hex default
+   Shape_Other,
+   Shape_NumOfShapes
+};
 
 /* Local Data */
+//                                                           Dec  Hex  Bin  Oct
+static const struct UIntLimits U8Limits  = { UINT8_MAX,  {   3u,  2u,  8u,  3u } };
+static const struct UIntLimits U16Limits = { UINT16_MAX, {   5u,  4u, 16u,  6u } };
+static const struct UIntLimits U32Limits = { UINT32_MAX, {  10u,  8u, 32u, 11u } };
+static const struct UIntLimits U64Limits = { UINT64_MAX, {  20u, 16u, 64u, 22u } };
 
 /*** Private Function Prototypes ***/
-static bool nparsy_atoi(char digit, uint8_t * converted_digit);
+static bool nparsy_add_affixes(uint8_t * table, const struct NParsyAffix * affixes, size_t n);
+static inline enum NParsyResult nparsy_uint_validate(
+      const char * str,
+      bool have_out,
+      enum NParsyNumFormat default_fmt,
+      size_t * slen );
+static inline enum NParsyResult nparsy_uint_first(
+      const char * str,
+      bool have_out,
+      const struct UIntLimits * limits,
+      uint64_t * val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt,
+      const struct ScanOptions * opts,
+      enum NParsyUnit * unit );
+static inline bool nparsy_uint_next(
+      const char * str,
+      const char ** p,
+      const char * end,
+      const struct UIntLimits * limits,
+      uint64_t * val,
+      enum NParsyNumFormat default_fmt,
+      const struct ScanOptions * opts,
+      enum NParsyUnit * unit );
+static inline bool nparsy_token_to_uint(const struct Token * tok, const struct UIntLimits * limits, uint64_t * val);
+static inline bool nparsy_token_to_uint_sep(
+      struct Token * tok,
+      const struct UIntLimits * limits,
+      const struct ScanOptions * opts,
+      uint64_t * val );
+static inline void nparsy_token_unit(struct Token * tok, const char * end, enum NParsyUnit * unit);
+static inline bool nparsy_scale_by_unit(const enum NParsyUnit * unit, const struct UIntLimits * limits, uint64_t * val);
+static bool nparsy_index_lines(
+      struct NParsyLineIndex * index,
+      const char * str,
+      const char * from,
+      const char * to,
+      const char * end );
+static enum UIntShape nparsy_token_shape(const struct Token * tok);
+static inline bool nparsy_may_start_token(char ch, enum NParsyNumFormat default_fmt);
+static inline bool nparsy_fast_token(
+      const char * str,
+      const char * q,
+      const char * end,
+      enum UIntShape shape,
+      struct Token * tok );
+static inline size_t nparsy_adaptive_run(
+      const char * str,
+      const char * p,
+      const char * end,
+      enum UIntShape shape,
+      enum NParsyNumFormat default_fmt,
+      uint64_t * buf,
+      size_t nparsed,
+      size_t len );
 
 /* Public Function Implementations */
 
@@ -31,577 +156,783 @@ static bool nparsy_atoi(char digit, uint8_t * converted_digit);
 // Hex:     0xZZ, ZZ, ZZh, ZZH, ZZx, ZZX, xZZ, XZZ
 // Decimal: ZZd, ZZD ZZ
 // Binary:  0bZZ ZZ
+// Octal:   0oZZ ZZ
+NPARSY_DEFINE_UINT_PARSERS( NParsyUInt, NParsyU64List, uint64_t, U64Limits, nparsy_no_options )
+NPARSY_DEFINE_UINT_PARSERS( NParsyU32,  NParsyU32List, uint32_t, U32Limits, nparsy_no_options )
+NPARSY_DEFINE_UINT_PARSERS( NParsyU16,  NParsyU16List, uint16_t, U16Limits, nparsy_no_options )
+NPARSY_DEFINE_UINT_PARSERS( NParsyU8,   NParsyU8List,  uint8_t,  U8Limits,  nparsy_no_options )
+
+/******************************************************************************/
+// Same formats, without the prefix/suffix consistency checks
+NPARSY_DEFINE_UINT_PARSERS( NParsyUIntLenient, NParsyU64ListLenient, uint64_t, U64Limits, nparsy_lenient_options )
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntList(
+      const char * str,
+      uint64_t * buf,
+      size_t len )
+{
+   return NParsyU64List(str, buf, len, nullptr, NParsy_Dec);
+}
+
+/******************************************************************************/
 [[nodiscard]]
-enum NParsyResult NParsyUInt(
-         const char * str,
-         uint64_t * parsed_val,
-         size_t * accumulated_strlen,
-         enum NParsyNumFormat default_fmt )
+enum NParsyResult NParsyU64ListLines(
+      const char * str,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt,
+      struct NParsyLineIndex * index )
 {
-   // Initial input validation
-   if ( str == nullptr )
-      return NParsy_InvalidString;
-   else if ( parsed_val == nullptr )
+   size_t slen = 0;
+   enum NParsyResult result = nparsy_uint_validate(str, buf != nullptr, default_fmt, &slen);
+   if ( result != NParsy_GoodResult )
+      return result;
+   else if ( (index == nullptr)
+             || ((index->cap > 0u) && ((index->line_starts == nullptr) || (index->line_counts == nullptr))) )
       return NParsy_NullPtr;
-   else if ( (int)default_fmt < 0 || (int)default_fmt > (int)NParsy_NumOfFmts )
-      return NParsy_InvalidDefaultFormat;
 
-   // TODO
-   // Parsing State Machine Time!
-   enum ParserState
-   {
-      Parser_Init,
-      Parser_NonDigitChars,
-      Parser_AmbiguousDigit,
-      Parser_HexPrefix,
-      Parser_BinPrefix,
-      Parser_HexNum,
-      Parser_BinNum,
-      Parser_DecSuffix,
-      Parser_HexSuffix,
-      Parser_UIntObtained
-   } parser_state = Parser_Init;
-
-   size_t nchars_parsed = 1;
-   ptrdiff_t str_idx = 0;
-   uint64_t valbuf = 0;
-   enum NParsyResult result = NParsy_GoodResult;
-   do
+   const char * p = str;
+   const char * end = str + slen;
+   size_t nparsed = 0;
+   uint64_t val = 0;
+
+   index->num_lines = 0;
+   if ( index->cap > 0u )
    {
-      // TODO
+      index->line_starts[0] = 0;
+      index->line_counts[0] = 0;
+      index->num_lines = 1;
 
-      ++nchars_parsed;
-      ++str_idx;
-   }
-   while ( parser_state != Parser_UIntObtained
-           && nchars_parsed < NPARSY_MAX_PARSABLE_STRING_LEN );
+      for ( ;; )
+      {
+         const char * before = p;
+         bool found = (nparsed < len) && nparsy_uint_next(str, &p, end, &U64Limits, &val, default_fmt, &nparsy_no_options, nullptr);
+         if ( !found && (nparsed == len) )
+            break; // Stop right after the last value that fit
+
+         // Numbers never span a newline, so every one passed over comes
+         // before this value
+         if ( !nparsy_index_lines(index, str, before, p, end) || !found )
+            break;
 
-   if ( parser_state == Parser_UIntObtained )
-      *parsed_val = valbuf;
+         buf[nparsed++] = val;
+         index->line_counts[index->num_lines - 1u]++;
+      }
+   }
 
-   if ( accumulated_strlen != nullptr )
-      *accumulated_strlen = nchars_parsed;
+   if ( num_parsed != nullptr )
+      *num_parsed = nparsed;
 
-   return result;
+   return NParsy_GoodResult;
 }
 
 /******************************************************************************/
 [[nodiscard]]
-enum NParsyResult NParsyUIntList(
+enum NParsyResult NParsyU64ListLineRange(
       const char * str,
+      const struct NParsyLineIndex * index,
+      size_t first_line,
+      size_t num_lines,
       uint64_t * buf,
-      size_t len )
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt )
 {
-   // TODO
+   size_t slen = 0;
+   enum NParsyResult result = nparsy_uint_validate(str, buf != nullptr, default_fmt, &slen);
+   if ( result != NParsy_GoodResult )
+      return result;
+   else if ( (index == nullptr) || ((index->num_lines > 0u) && (index->line_starts == nullptr)) )
+      return NParsy_NullPtr;
+   else if ( (first_line > index->num_lines) || (num_lines > (index->num_lines - first_line)) )
+      return NParsy_InvalidLineRange;
+
+   size_t nparsed = 0;
+   if ( num_lines > 0u )
+   {
+      size_t last = first_line + num_lines;
+      size_t from = index->line_starts[first_line];
+      size_t to = (last < index->num_lines) ? index->line_starts[last] : slen;
+      if ( (from > to) || (to > slen) )
+         return NParsy_InvalidLineRange; // Index isn't from this string
+
+      const char * p = str + from;
+      const char * end = str + to;
+      uint64_t val = 0;
+      while ( (nparsed < len) && nparsy_uint_next(str, &p, end, &U64Limits, &val, default_fmt, &nparsy_no_options, nullptr) )
+         buf[nparsed++] = val;
+   }
+
+   if ( num_parsed != nullptr )
+      *num_parsed = nparsed;
 
    return NParsy_GoodResult;
 }
 
-STATIC enum LIN_PID_Result_E GetID( const char * str,
-                                    uint8_t * id,
-                                    bool * ishex,
-                                    bool * isdec )
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyU64ListAdaptive(
+      const char * str,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt )
 {
-   assert( (str != NULL) &&
-           (id  != NULL) &&
-           (!(*ishex) || !(*isdec)) );
-
-   enum LIN_PID_Result_E result = GoodResult;
-   size_t idx = 0;
-   size_t loop_limit_counter = 0;
-
-   // Skip over any leading whitespace
-   // TODO: Do I need to check for this? Can I trust that the terminal will not
-   //       pass in white-space leading characters?
-   while (
-      /* x2 as max allowance of leading whitespace */
-      (loop_limit_counter <= (MAX_NUM_LEN * 2)) &&
-      (str[idx] != '\0') &&
-      (isblank( (int)str[idx] ))
-   )
+   size_t slen = 0;
+   enum NParsyResult result = nparsy_uint_validate(str, buf != nullptr, default_fmt, &slen);
+   if ( result != NParsy_GoodResult )
+      return result;
+
+   const char * p = str;
+   const char * end = str + slen;
+   size_t nparsed = 0;
+   size_t tally[Shape_NumOfShapes] = { 0 };
+   size_t sample_len = (len < NPARSY_ADAPTIVE_SAMPLE_LEN) ? len : NPARSY_ADAPTIVE_SAMPLE_LEN;
+   struct Token tok;
+
+   // Sample: the general path, noting the shape of every value found
+   while ( (nparsed < sample_len)
+           && (nparsy_next_token(p, end, (p > str) ? p[-1] : '\0', true, default_fmt, &tok) == Scan_Found) )
    {
-      idx++;
-      loop_limit_counter++;
+      p = tok.end;
+      if ( (tok.kind == Token_UInt) && nparsy_token_to_u64(&tok, &buf[nparsed]) )
+      {
+         tally[nparsy_token_shape(&tok)]++;
+         nparsed++;
+      }
    }
-   if ( str[idx] == '\0' )
+
+   enum UIntShape shape = Shape_Other;
+   for ( size_t i = 0; i < (size_t)Shape_Other; i++ )
    {
-      return WhiteSpaceOnlyIDArg;
+      if ( (nparsed == NPARSY_ADAPTIVE_SAMPLE_LEN) && ((tally[i] * 4u) >= (nparsed * 3u)) )
+         shape = (enum UIntShape)i;
    }
 
-   // Parser State Machine Time!
-   enum ParserState_E
-   {
-      ParserInit,
-      ParserOneZeroIn,
-      ParserHexPrefix,
-      ParserIndeterminateOneDigitIn,
-      ParserIndeterminateTwoDigitsIn,
-      ParserOneDecDigit,
-      ParserTwoDecDigits,
-      ParserHexDigits,
-      ParserTwoHexDigits,
-      ParserTwoZerosIn,
-      ParserTwoDigitsAlreadyRead,
-      ParserPreemptivelyHex,
-      ParserPreemptivelyDec,
-      ParserPreemptivelyDecOneZeroIn,
-      ParserPreemptivelyDecTwoZerosIn
-   } parser_state;
-   loop_limit_counter = 0;
-   bool exit_loop = false;
-   char first_digit = '\0';
-   char second_digit = '\0';
-   bool assume_hex = *ishex;
-   bool assume_dec = *isdec;
-   bool hex_prefix_already_encountered = false;
-
-   if ( *ishex )
+   // The shape is a constant in each call, so each gets its own copy of the
+   // loop with the other shapes' checks folded away
+   switch ( shape )
    {
-      parser_state = ParserPreemptivelyHex;
+      case Shape_BareDec:
+         nparsed = nparsy_adaptive_run(str, p, end, Shape_BareDec, default_fmt, buf, nparsed, len);
+         break;
+      case Shape_PrefixedHex:
+         nparsed = nparsy_adaptive_run(str, p, end, Shape_PrefixedHex, default_fmt, buf, nparsed, len);
+         break;
+      case Shape_BareHex:
+         nparsed = nparsy_adaptive_run(str, p, end, Shape_BareHex, default_fmt, buf, nparsed, len);
+         break;
+      case Shape_Other:
+      case Shape_NumOfShapes:
+      default:
+      {
+         uint64_t val = 0;
+         while ( (nparsed < len) && nparsy_uint_next(str, &p, end, &U64Limits, &val, default_fmt, &nparsy_no_options, nullptr) )
+            buf[nparsed++] = val;
+         break;
+      }
    }
-   else if ( *isdec )
+
+   if ( num_parsed != nullptr )
+      *num_parsed = nparsed;
+
+   return NParsy_GoodResult;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntSep(
+      const char * str,
+      uint64_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt,
+      unsigned seps )
+{
+   const struct ScanOptions opts = { .seps = seps, .group = NParsy_NoGrouping };
+   return nparsy_uint_first( str, parsed_val != nullptr, &U64Limits, parsed_val,
+                             accumulated_strlen, default_fmt, &opts, nullptr );
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyU64ListSep(
+      const char * str,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt,
+      unsigned seps )
+{
+   size_t slen = 0;
+   enum NParsyResult result = nparsy_uint_validate(str, buf != nullptr, default_fmt, &slen);
+   if ( result != NParsy_GoodResult )
+      return result;
+   else if ( (seps & ~(unsigned)NParsy_AllSeps) != 0u )
+      return NParsy_InvalidDigitSeparators;
+
+   const struct ScanOptions opts = { .seps = seps, .group = NParsy_NoGrouping };
+   const char * p = str;
+   const char * end = str + slen;
+   size_t nparsed = 0;
+   uint64_t val = 0;
+   while ( (nparsed < len) && nparsy_uint_next(str, &p, end, &U64Limits, &val, default_fmt, &opts, nullptr) )
+      buf[nparsed++] = val;
+
+   if ( num_parsed != nullptr )
+      *num_parsed = nparsed;
+
+   return NParsy_GoodResult;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntUnit(
+      const char * str,
+      uint64_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt,
+      enum NParsyUnit * unit )
+{
+   uint64_t val = 0;
+   enum NParsyUnit found = NParsy_NoUnit;
+   enum NParsyResult result = nparsy_uint_first( str, (parsed_val != nullptr) && (unit != nullptr),
+                                                 &U64Limits, &val, accumulated_strlen,
+                                                 default_fmt, &nparsy_no_options, &found );
+   if ( result == NParsy_GoodResult )
    {
-      parser_state = ParserPreemptivelyDec;
+      *parsed_val = val;
+      *unit = found;
    }
-   else
+
+   return result;
+}
+
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyU64ListUnit(
+      const char * str,
+      uint64_t * buf,
+      enum NParsyUnit * units,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt )
+{
+   size_t slen = 0;
+   enum NParsyResult result = nparsy_uint_validate(str, buf != nullptr, default_fmt, &slen);
+   if ( result != NParsy_GoodResult )
+      return result;
+
+   const char * p = str;
+   const char * end = str + slen;
+   size_t nparsed = 0;
+   uint64_t val = 0;
+   enum NParsyUnit unit = NParsy_NoUnit;
+   while ( (nparsed < len) && nparsy_uint_next(str, &p, end, &U64Limits, &val, default_fmt, &nparsy_no_options, &unit) )
    {
-      parser_state = ParserInit;
+      if ( units != nullptr )
+         units[nparsed] = unit;
+      buf[nparsed++] = val;
    }
 
-   char ch = '\0';
-   while (
-      (loop_limit_counter <= MAX_NUM_LEN) &&
-      (str[idx] != '\0') && /* Continue until terminating null character */
-      !exit_loop /* Redundant here but I like extra guard rails */
-   )
-   {
-      ch = str[idx];
-      switch (parser_state)
-      {
-         case ParserInit:
-            if ( '0' == ch )
-            {
-               first_digit = ch;
-               parser_state = ParserOneZeroIn;
-            }
-            else if ( isxdigit(ch) )
-            {
-               if ( isdigit(ch) )
-               {
-                  // Determined to be within hex range but also within dec range
-                  // so, still indeterminate...
-                  parser_state = ParserIndeterminateOneDigitIn;
-               }
-               else
-               {
-                  // Must be a uniquely hex digit
-                  assume_hex = true;
-                  parser_state = ParserHexDigits;
-               }
-               first_digit = ch;
-            }
-            else if ( ('x' == ch) || ('X' == ch) )
-            {
-               assume_hex = true;
-               hex_prefix_already_encountered = true;
-               parser_state = ParserHexPrefix;
-            }
-            else
-            {
-               result = InvalidCharacterEncountered_FirstChar;
-               exit_loop = true;
-            }
-            break;
+   if ( num_parsed != nullptr )
+      *num_parsed = nparsed;
 
-         case ParserOneZeroIn:
-            if ( '0' == ch )
-            {
-               second_digit = ch;
-               parser_state = ParserTwoZerosIn;
-            }
-            else if ( ('x' == ch) || ('X' == ch) )
-            {
-               assume_hex = true;
-               hex_prefix_already_encountered = true;
-               parser_state = ParserHexPrefix;
-            }
-            else if ( isxdigit(ch) )
-            {
-               if ( !isdigit(ch) )
-               {
-                  // Must be a uniquely hex digit
-                  // NOTE: The 'd' suffix would also lead to this line,
-                  //       and the user may have intended a decimal number.
-                  //       I have chosen that the hex variant will take hold unless
-                  //       --dec | -d was specified.
-                  assume_hex = true;
-                  parser_state = ParserTwoHexDigits;
-               }
-               else
-               {
-                  parser_state = ParserIndeterminateTwoDigitsIn;
-               }
-               first_digit = ch;
-            }
-            else if ( ('h' == ch) || ('H' == ch) )
-            {
-               assume_hex = true;
-               parser_state = ParserTwoDigitsAlreadyRead;
-            }
-            else
-            {
-               result = InvalidDigitEncountered_SecondDigit;
-               exit_loop = true;
-            }
-            break;
+   return NParsy_GoodResult;
+}
 
-         case ParserHexPrefix:
-            if ( isxdigit(ch) )
-            {
-               first_digit = ch;
-               parser_state = ParserHexDigits;
-            }
-            else
-            {
-               result = InvalidDigitEncountered_FirstDigit;
-               exit_loop = true;
-            }
-            break;
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntGrouped(
+      const char * str,
+      uint64_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyGroupSep group )
+{
+   const struct ScanOptions opts = { .seps = NParsy_NoSep, .group = group };
+   return nparsy_uint_first( str, parsed_val != nullptr, &U64Limits, parsed_val,
+                             accumulated_strlen, NParsy_Dec, &opts, nullptr );
+}
 
-         case ParserIndeterminateOneDigitIn:
-            if ( isxdigit(ch) )
-            {
-               if ( isdigit(ch) )
-               {
-                  parser_state = ParserIndeterminateTwoDigitsIn;
-               }
-               else
-               {
-                  assume_hex = true;
-                  parser_state = ParserTwoHexDigits;
-               }
-               second_digit = ch;
-            }
-            else if ( ('x' == ch) || ('X' == ch) ||
-                      ('h' == ch) || ('H' == ch) )
-            {
-               assume_hex = true;
-               parser_state = ParserTwoDigitsAlreadyRead;
-            }
-            else
-            {
-               result = InvalidDigitEncountered_SecondDigit;
-               exit_loop = true;
-            }
-            break;
-         
-         case ParserIndeterminateTwoDigitsIn:
-            if ( ('x' == ch) || ('X' == ch) || ('h' == ch) || ('H' == ch) )
-            {
-               assume_hex = true;
-               parser_state = ParserTwoDigitsAlreadyRead;
-            }
-            else if ( ('d' == ch) || ('D' == ch) )
-            {
-               assume_dec = true;
-               parser_state = ParserTwoDigitsAlreadyRead;
-            }
-            else
-            {
-               result = TooManyDigitsEntered;
-               exit_loop = true;
-            }
-            break;
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyU64ListGrouped(
+      const char * str,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyGroupSep group )
+{
+   size_t slen = 0;
+   enum NParsyResult result = nparsy_uint_validate(str, buf != nullptr, NParsy_Dec, &slen);
+   if ( result != NParsy_GoodResult )
+      return result;
+   else if ( (int)group < 0 || (int)group >= (int)NParsy_NumOfGroupSeps )
+      return NParsy_InvalidGroupSeparator;
+
+   const struct ScanOptions opts = { .seps = NParsy_NoSep, .group = group };
+   const char * p = str;
+   const char * end = str + slen;
+   size_t nparsed = 0;
+   uint64_t val = 0;
+   while ( (nparsed < len) && nparsy_uint_next(str, &p, end, &U64Limits, &val, NParsy_Dec, &opts, nullptr) )
+      buf[nparsed++] = val;
+
+   if ( num_parsed != nullptr )
+      *num_parsed = nparsed;
 
-         case ParserOneDecDigit:
-            if ( isdigit(ch) )
-            {
-               second_digit = ch;
-               parser_state = ParserTwoDecDigits;
-            }
-            else
-            {
-               result = InvalidDigitEncountered_SecondDigit;
-               exit_loop = true;
-            }
-            break;
+   return NParsy_GoodResult;
+}
 
-         case ParserTwoDecDigits:
-            // Two decimal digits will have already been read in...
-            if ( ('d' == ch) || ('D' == ch) )
-            {
-               parser_state = ParserTwoDigitsAlreadyRead;
-            }
-            else
-            {
-               result = InvalidDecimalSuffixEncountered;
-               exit_loop = true;
-            }
-            break;
-         
-         case ParserHexDigits:
-            if ( isxdigit(ch) )
-            {
-               second_digit = ch;
-               parser_state = ParserTwoHexDigits;
-            }
-            else if ( ('x' == ch) || ('X' == ch) ||
-                      ('h' == ch) || ('H' == ch) )
-            {
-               if ( hex_prefix_already_encountered )
-               {
-                  result = HexPrefixAndSuffixEncountered;
-                  exit_loop = true;
-               }
-               else
-               {
-                  assume_hex = true;
-                  parser_state = ParserTwoDigitsAlreadyRead;
-               }
-            }
-            else
-            {
-               result = InvalidDigitEncountered_SecondDigit;
-               exit_loop = true;
-            }
-            break;
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyCompileSyntax(
+      const struct NParsyAffix * prefixes,
+      size_t nprefixes,
+      const struct NParsyAffix * suffixes,
+      size_t nsuffixes,
+      struct NParsySyntax ** syntax )
+{
+   // Initial input validation
+   if ( ((prefixes == nullptr) && (nprefixes > 0u))
+        || ((suffixes == nullptr) && (nsuffixes > 0u))
+        || (syntax == nullptr) )
+      return NParsy_NullPtr;
 
-         case ParserTwoHexDigits:
-            // Two hex digits will have already been read in...
-            if ( ('x' == ch) || ('X' == ch) ||
-                 ('h' == ch) || ('H' == ch) )
-            {
-               parser_state = ParserTwoDigitsAlreadyRead;
-            }
-            else
-            {
-               result = InvalidDecimalSuffixEncountered;
-               exit_loop = true;
-            }
-            break;
+   struct NParsySyntax * syn = malloc(sizeof *syn);
+   if ( syn == nullptr )
+      return NParsy_OutOfMemory;
 
-         case ParserTwoZerosIn:
-            if ( !assume_dec &&
-                     ( ('x' == ch) || ('X' == ch) || ('h' == ch) || ('H' == ch) ) )
-            {
-               assume_hex = true;
-               parser_state = ParserTwoDigitsAlreadyRead;
-            }
-            else if ( !assume_hex &&
-                     ( ('d' == ch) || ('D' == ch) ) )
-            {
-               assume_dec = true;
-               parser_state = ParserTwoDigitsAlreadyRead;
-            }
-            else
-            {
-               result = TooManyDigitsEntered;
-               exit_loop = true;
-            }
-            break;
+   memset(syn->prefix_fmt, NParsy_NumOfFmts, sizeof syn->prefix_fmt);
+   memset(syn->suffix_fmt, NParsy_NumOfFmts, sizeof syn->suffix_fmt);
 
-         case ParserTwoDigitsAlreadyRead:
-            result = TooManyDigitsEntered;
-            exit_loop = true;
-            break;
+   if ( !nparsy_add_affixes(syn->prefix_fmt, prefixes, nprefixes)
+        || !nparsy_add_affixes(syn->suffix_fmt, suffixes, nsuffixes) )
+   {
+      free(syn);
+      return NParsy_InvalidSyntax;
+   }
 
-         case ParserPreemptivelyHex:
-            if ( ('x' == ch) || ('X' == ch) )
-            {
-               hex_prefix_already_encountered = true;
-               parser_state = ParserHexPrefix;
-            }
-            else if ( '0' == ch )
-            {
-               parser_state = ParserOneZeroIn;
-            }
-            else if ( isxdigit(ch) )
-            {
-               first_digit = ch;
-               parser_state = ParserHexDigits;
-            }
-            else
-            {
-               result = InvalidCharacterEncountered_FirstChar;
-               exit_loop = true;
-            }
-            break;
+   *syntax = syn;
+   return NParsy_GoodResult;
+}
 
-         case ParserPreemptivelyDec:
-            if ( ('x' == ch) || ('X' == ch) || (isxdigit(ch) && !isdigit(ch)) )
-            {
-               result = HexDigitEncounteredUnderDecSetting_FirstDigit;
-               exit_loop = true;
-            }
-            else if ( '0' == ch )
-            {
-               first_digit = ch;
-               parser_state = ParserPreemptivelyDecOneZeroIn;
-            }
-            else if ( isdigit(ch) )
-            {
-               first_digit = ch;
-               parser_state = ParserOneDecDigit;
-            }
-            else
-            {
-               result = InvalidCharacterEncountered_FirstChar;
-               exit_loop = true;
-            }
-            break;
+/******************************************************************************/
+void NParsyFreeSyntax(struct NParsySyntax * syntax)
+{
+   free(syntax);
+}
 
-         case ParserPreemptivelyDecOneZeroIn:
-            if ( ('x' == ch) || ('X' == ch) || (isxdigit(ch) && !isdigit(ch)) )
-            {
-               result = HexDigitEncounteredUnderDecSetting_SecondDigit;
-               exit_loop = true;
-            }
-            else if ( '0' == ch )
-            {
-               parser_state = ParserPreemptivelyDecTwoZerosIn;
-            }
-            else if ( isdigit(ch) )
-            {
-               first_digit = ch;
-               parser_state = ParserTwoDecDigits;
-            }
-            else
-            {
-               result = InvalidCharacterEncountered_SecondChar;
-               exit_loop = true;
-            }
-            break;
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyUIntSyntax(
+      const struct NParsySyntax * syntax,
+      const char * str,
+      uint64_t * parsed_val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt )
+{
+   const struct ScanOptions opts = { .seps = NParsy_NoSep, .group = NParsy_NoGrouping, .syntax = syntax };
+   return nparsy_uint_first( str, (parsed_val != nullptr) && (syntax != nullptr), &U64Limits, parsed_val,
+                             accumulated_strlen, default_fmt, &opts, nullptr );
+}
 
-         case ParserPreemptivelyDecTwoZerosIn:
-            if ( ('d' == ch) || ('D' == ch) )
-            {
-               parser_state = ParserTwoDigitsAlreadyRead;
-            }
-            else
-            {
-               result = InvalidDecimalSuffixEncountered;
-               exit_loop = true;
-            }
-            break;
+/******************************************************************************/
+[[nodiscard]]
+enum NParsyResult NParsyU64ListSyntax(
+      const struct NParsySyntax * syntax,
+      const char * str,
+      uint64_t * buf,
+      size_t len,
+      size_t * num_parsed,
+      enum NParsyNumFormat default_fmt )
+{
+   size_t slen = 0;
+   enum NParsyResult result = nparsy_uint_validate(str, (buf != nullptr) && (syntax != nullptr), default_fmt, &slen);
+   if ( result != NParsy_GoodResult )
+      return result;
+
+   const struct ScanOptions opts = { .seps = NParsy_NoSep, .group = NParsy_NoGrouping, .syntax = syntax };
+   const char * p = str;
+   const char * end = str + slen;
+   size_t nparsed = 0;
+   uint64_t val = 0;
+   while ( (nparsed < len) && nparsy_uint_next(str, &p, end, &U64Limits, &val, default_fmt, &opts, nullptr) )
+      buf[nparsed++] = val;
+
+   if ( num_parsed != nullptr )
+      *num_parsed = nparsed;
 
-         default:
-            assert(false); // Something went wrong /w the parser_state or we
-                           // forgot to account for a state!
-            break;
-      }
-      
-      // Do we need to exit the loop pre-emptively due to an erroneous situation?
-      if ( exit_loop )
-      {
-         break;
-      }
+   return NParsy_GoodResult;
+}
 
-      idx++;
-      loop_limit_counter++;
-   }
-   
-   // Logic should not determine that input was both hex and dec at the same time
-   assert( !(assume_hex && assume_dec) );
-   
-   // Post state machine processing
-   if ( loop_limit_counter >= MAX_NUM_LEN )
+/*** Private Function Implementations ***/
+
+/**
+ * @brief Enter each affix's format into table, the char class of a custom
+ *        prefix or suffix.
+ * @return false if an affix could be mistaken for part of a number (a digit,
+ *         a hex letter, a sign, or a decimal point), is a built-in one (x, h),
+ *         has no valid format, or was already entered
+ */
+static bool nparsy_add_affixes(uint8_t * table, const struct NParsyAffix * affixes, size_t n)
+{
+   for ( size_t i = 0; i < n; i++ )
    {
-      result = TooManyDigitsEntered;
+      char ch = affixes[i].ch;
+      enum NParsyNumFormat fmt = affixes[i].fmt;
+
+      if ( (ch == '\0') || nparsy_is_hex_digit(ch) || (ch == '-') || (ch == '.')
+           || (ch == 'x') || (ch == 'X') || (ch == 'h') || (ch == 'H')
+           || ((int)fmt < 0) || ((int)fmt >= (int)NParsy_NumOfFmts)
+           || (table[(unsigned char)ch] != NParsy_NumOfFmts) )
+         return false;
+
+      table[(unsigned char)ch] = (uint8_t)fmt;
    }
-   else if ( exit_loop )
+
+   return true;
+}
+
+/**
+ * @brief Input validation shared by all widths.
+ */
+static inline enum NParsyResult nparsy_uint_validate(
+      const char * str,
+      bool have_out,
+      enum NParsyNumFormat default_fmt,
+      size_t * slen )
+{
+   if ( str == nullptr || !nparsy_bounded_strlen(str, slen) )
+      return NParsy_InvalidString;
+   else if ( !have_out )
+      return NParsy_NullPtr;
+   else if ( (int)default_fmt < 0 || (int)default_fmt >= (int)NParsy_NumOfFmts )
+      return NParsy_InvalidDefaultFormat;
+
+   return NParsy_GoodResult;
+}
+
+/**
+ * @brief Find and convert the first unsigned integer in str.
+ */
+static inline enum NParsyResult nparsy_uint_first(
+      const char * str,
+      bool have_out,
+      const struct UIntLimits * limits,
+      uint64_t * val,
+      size_t * accumulated_strlen,
+      enum NParsyNumFormat default_fmt,
+      const struct ScanOptions * opts,
+      enum NParsyUnit * unit )
+{
+   size_t slen = 0;
+   enum NParsyResult result = nparsy_uint_validate(str, have_out, default_fmt, &slen);
+   if ( result != NParsy_GoodResult )
+      return result;
+   else if ( (opts->seps & ~(unsigned)NParsy_AllSeps) != 0u )
+      return NParsy_InvalidDigitSeparators;
+   else if ( (int)opts->group < 0 || (int)opts->group >= (int)NParsy_NumOfGroupSeps )
+      return NParsy_InvalidGroupSeparator;
+
+   const char * p = str;
+   const char * end = str + slen;
+   struct Token tok;
+
+   result = NParsy_NoNumberFound;
+   while ( nparsy_next_token_opts(p, end, (p > str) ? p[-1] : '\0', true, default_fmt, opts, &tok) == Scan_Found )
    {
-      // Something erroneous was detected. Don't update ID!
+      nparsy_token_unit(&tok, end, unit);
+      p = tok.end;
+      if ( tok.kind != Token_UInt )
+         continue;
+
+      result = ( nparsy_token_to_uint_sep(&tok, limits, opts, val)
+                 && nparsy_scale_by_unit(unit, limits, val) ) ? NParsy_GoodResult : NParsy_NumberOutOfRange;
+      break;
    }
-   else if ( (assume_hex || assume_dec) && ('\0' == first_digit) && ('\0' == second_digit) )
+
+   if ( result == NParsy_NoNumberFound )
+      p = end;
+
+   if ( accumulated_strlen != nullptr )
+      *accumulated_strlen = (size_t)(p - str);
+
+   return result;
+}
+
+/**
+ * @brief Advance *p past the next unsigned integer that fits.
+ * @return false once nothing is left
+ */
+static inline bool nparsy_uint_next(
+      const char * str,
+      const char ** p,
+      const char * end,
+      const struct UIntLimits * limits,
+      uint64_t * val,
+      enum NParsyNumFormat default_fmt,
+      const struct ScanOptions * opts,
+      enum NParsyUnit * unit )
+{
+   struct Token tok;
+
+   while ( nparsy_next_token_opts(*p, end, (*p > str) ? (*p)[-1] : '\0', true, default_fmt, opts, &tok) == Scan_Found )
    {
-      result = NoNumericalDigitsEnteredWithFormat;
+      nparsy_token_unit(&tok, end, unit);
+      *p = tok.end;
+      // Negatives, floats, malformed, and out-of-range numbers are skipped
+      if ( (tok.kind == Token_UInt) && nparsy_token_to_uint_sep(&tok, limits, opts, val)
+           && nparsy_scale_by_unit(unit, limits, val) )
+         return true;
    }
 
-   else
-   {
-      // We got valid digits! Let's get that ID.
-      uint8_t most_significant_digit = 0xFF;
-      uint8_t least_significant_digit = 0xFF;
+   *p = end;
+   return false;
+}
 
-      // By this point, I assume we have at least one digit placed in first_digit.
-      assert( (first_digit != '\0') );
+/**
+ * @brief Convert a token, rejecting it on digit count alone where possible.
+ * @note The cutoff acts once the scanner has found the whole token, not a few
+ *       digits in: the token's end is where the next search resumes, and an
+ *       'h' or 'd' suffix after the digits decides which max_digits entry
+ *       applies. What it skips is the conversion.
+ * @return false if the value doesn't fit
+ */
+static inline bool nparsy_token_to_uint(const struct Token * tok, const struct UIntLimits * limits, uint64_t * val)
+{
+   const char * d = tok->digits;
+   size_t n = nparsy_strip_leading_zeros(&d, tok->ndigits);
 
-      // Only one digit entered
-      if ( second_digit == '\0' )
-      {
-         most_significant_digit = 0x00u;
-#ifndef NDEBUG
-         bool conv = nparsy_atoi( first_digit, &least_significant_digit );
-#else
-         (void)nparsy_atoi( first_digit, &least_significant_digit );
-#endif
-         assert( conv );
-         assert( (most_significant_digit == 0x00) && (least_significant_digit <= 0x0F) );
-      }
+   // Early cutoff: too many significant digits can't possibly fit
+   if ( n > limits->max_digits[tok->fmt] )
+      return false;
 
-      // Two digits entered
-      else
-      {
-#ifndef NDEBUG
-         bool conv1 = nparsy_atoi( first_digit, &most_significant_digit );
-         bool conv2 = nparsy_atoi( second_digit, &least_significant_digit );
-#else
-         (void)nparsy_atoi( first_digit, &most_significant_digit );
-         (void)nparsy_atoi( second_digit, &least_significant_digit );
-#endif
-         assert( conv1 && conv2 );
-         assert( (most_significant_digit <= 0x0F) && (least_significant_digit <= 0x0F) );
-      }
+   uint64_t acc = 0;
+   if ( !nparsy_token_to_u64(tok, &acc) || (acc > limits->max) )
+      return false;
 
-      // Digits obtained should be <= 0xF
-      assert( (most_significant_digit <= 0x0F) && (least_significant_digit <= 0x0F) );
+   *val = acc;
+   return true;
+}
 
-      // Final step!
-      if ( (0 == most_significant_digit) && (0 == least_significant_digit) )
-      {
-         *id = 0x00u;
-      }
-      else if ( assume_hex || !assume_dec )
-      {
-         *id = (uint8_t)( (most_significant_digit * 0x10) + least_significant_digit );
-      }
-      else  // Must be decimal
-      {
-         *id = (uint8_t)( (most_significant_digit * 10) + least_significant_digit );
-      }
+/**
+ * @brief nparsy_token_to_uint for a token whose digits may have separators.
+ */
+static inline bool nparsy_token_to_uint_sep(
+      struct Token * tok,
+      const struct UIntLimits * limits,
+      const struct ScanOptions * opts,
+      uint64_t * val )
+{
+   // Binary has the most significant digits of any format
+   char digits[64];
+
+   if ( ((opts->seps != 0u) || (opts->group != NParsy_NoGrouping))
+        && !nparsy_token_compact(tok, digits, sizeof digits) )
+      return false;
+
+   return nparsy_token_to_uint(tok, limits, val);
+}
+
+/**
+ * @brief If units are wanted (unit != nullptr), take a magnitude suffix right
+ *        after the digits of a bare decimal token into it. This also rescues
+ *        "7E", which the scanner calls malformed since 'E' is a hex digit.
+ */
+static inline void nparsy_token_unit(struct Token * tok, const char * end, enum NParsyUnit * unit)
+{
+   if ( unit == nullptr )
+      return;
+
+   *unit = NParsy_NoUnit;
+   if ( (tok->fmt != NParsy_Dec) || (tok->prefix != '\0') || (tok->suffix != '\0')
+        || ((tok->kind != Token_UInt) && (tok->kind != Token_Malformed)) )
+      return;
+
+   const char * unit_end = nparsy_scan_unit(tok->digits + tok->ndigits, end, unit);
+   if ( *unit != NParsy_NoUnit )
+   {
+      tok->kind = Token_UInt;
+      tok->end = unit_end;
    }
+}
 
-   *ishex = assume_hex;
-   *isdec = assume_dec;
-   
-   return result;
+/**
+ * @brief Scale val by the unit nparsy_token_unit found, if units are wanted.
+ * @return false if the scaled value doesn't fit
+ */
+static inline bool nparsy_scale_by_unit(const enum NParsyUnit * unit, const struct UIntLimits * limits, uint64_t * val)
+{
+   return (unit == nullptr) || (nparsy_apply_unit(*unit, val) && (*val <= limits->max));
 }
 
-/*** Private Function Implementations ***/
+/**
+ * @brief Which specialized kernel, if any, would have handled tok.
+ */
+static enum UIntShape nparsy_token_shape(const struct Token * tok)
+{
+   if ( tok->suffix != '\0' )
+      return Shape_Other;
+   else if ( (tok->prefix == 'x') || (tok->prefix == 'X') )
+      return (tok->begin[0] == '0') ? Shape_PrefixedHex : Shape_Other;
+   else if ( tok->prefix != '\0' )
+      return Shape_Other;
+   else if ( tok->fmt == NParsy_Dec )
+      return Shape_BareDec;
+   else if ( tok->fmt == NParsy_Hex )
+      return Shape_BareHex;
+
+   return Shape_Other;
+}
 
 /**
- * @brief Like the C std lib atoi, but safer and more expressive.
+ * @brief Whether the general scanner could start a token at ch. Errs towards
+ *        yes: anything else is skipped without a second look.
  */
-static bool nparsy_atoi(char digit, uint8_t * converted_digit)
+static inline bool nparsy_may_start_token(char ch, enum NParsyNumFormat default_fmt)
 {
-   assert( converted_digit != NULL );
+   return nparsy_is_dec_digit(ch)
+          || (ch == '-') || (ch == '.') || (ch == 'x') || (ch == 'X')
+          || ((default_fmt == NParsy_Hex) && nparsy_is_hex_digit(ch));
+}
 
-   // Check input validity
-   if (   ( digit >= '0' && digit <= '9' )
-       || ( digit >= 'A' && digit <= 'F' )
-       || ( digit >= 'a' && digit <= 'f' ) )
+/**
+ * @brief Try to read the token at q as the given shape, without the general
+ *        scanner's checks for every other format.
+ * @note Only says yes when nparsy_next_token() would have produced exactly
+ *       this token from q.
+ * @return false if q doesn't start a plain token of that shape
+ */
+static inline bool nparsy_fast_token(
+      const char * str,
+      const char * q,
+      const char * end,
+      enum UIntShape shape,
+      struct Token * tok )
+{
+   const char * digits = q;
+   const char * run_end;
+   char next;
+
+   switch ( shape )
    {
-      if ( (digit >= '0') && (digit <= '9') )
-         *converted_digit = (uint8_t)(digit - '0');
+      case Shape_BareDec:
+         // Anything alnum right after the digits could be a prefix, suffix,
+         // or exponent, and a '.' a fraction
+         if ( !nparsy_is_dec_digit(*q) )
+            return false;
+         run_end = nparsy_skip_dec_run(q, end);
+         next = (run_end < end) ? *run_end : '\0';
+         if ( nparsy_is_alnum(next) || (next == '.') )
+            return false;
+         tok->fmt = NParsy_Dec;
+         break;
 
-      else if ( (digit >= 'A') && (digit <= 'F') )
-         *converted_digit = (uint8_t)(10 + (digit - 'A'));
+      case Shape_PrefixedHex:
+         if ( ((end - q) < 3) || (q[0] != '0') || ((q[1] != 'x') && (q[1] != 'X'))
+              || !nparsy_is_hex_digit(q[2]) )
+            return false;
+         digits = q + 2;
+         run_end = nparsy_skip_hex_run(digits + 1, end);
+         next = (run_end < end) ? *run_end : '\0';
+         if ( (next == 'h') || (next == 'H') ) // 0x1Fh is malformed
+            return false;
+         tok->fmt = NParsy_Hex;
+         break;
 
-      else
-         *converted_digit = (uint8_t)(10 + (digit - 'a'));
+      case Shape_BareHex:
+         // A letter only starts a bare hex number at the start of a word
+         if ( !nparsy_is_hex_digit(*q)
+              || (!nparsy_is_dec_digit(*q) && (q > str) && nparsy_is_alnum(q[-1])) )
+            return false;
+         if ( (*q == '0') && ((end - q) > 1)
+              && ((q[1] == 'x') || (q[1] == 'X') || (q[1] == 'b') || (q[1] == 'B')
+                  || (q[1] == 'o') || (q[1] == 'O')) )
+            return false;
+         run_end = nparsy_skip_hex_run(q + 1, end);
+         next = (run_end < end) ? *run_end : '\0';
+         if ( (next == 'h') || (next == 'H') || (next == 'x') || (next == 'X') )
+            return false;
+         tok->fmt = NParsy_Hex;
+         break;
 
-      return true;
+      case Shape_Other:
+      case Shape_NumOfShapes:
+      default:
+         return false;
    }
 
-   return false;
+   tok->begin = q;
+   tok->end = run_end;
+   tok->digits = digits;
+   tok->ndigits = (size_t)(run_end - digits);
+   tok->kind = Token_UInt;
+   return true;
+}
+
+/**
+ * @brief Parse the rest of [p, end) into buf with the kernel for shape,
+ *        handing each number it can't take to the general scanner.
+ * @return the new number of values in buf
+ */
+static inline size_t nparsy_adaptive_run(
+      const char * str,
+      const char * p,
+      const char * end,
+      enum UIntShape shape,
+      enum NParsyNumFormat default_fmt,
+      uint64_t * buf,
+      size_t nparsed,
+      size_t len )
+{
+   struct Token tok;
+
+   while ( nparsed < len )
+   {
+      while ( (p < end) && !nparsy_may_start_token(*p, default_fmt) )
+         ++p;
+      if ( p == end )
+         break;
+
+      if ( !nparsy_fast_token(str, p, end, shape, &tok)
+           && (nparsy_next_token(p, end, (p > str) ? p[-1] : '\0', true, default_fmt, &tok) != Scan_Found) )
+         break;
+
+      p = tok.end;
+      if ( (tok.kind == Token_UInt) && nparsy_token_to_u64(&tok, &buf[nparsed]) )
+         nparsed++;
+   }
+
+   return nparsed;
+}
+
+/**
+ * @brief Start a new line in the index for every '\n' in [from, to).
+ * @return false if the index ran out of room
+ */
+static bool nparsy_index_lines(
+      struct NParsyLineIndex * index,
+      const char * str,
+      const char * from,
+      const char * to,
+      const char * end )
+{
+   // memchr is vectorized in any decent libc, and the gaps between numbers
+   // are where all the newlines are
+   for ( const char * nl = memchr(from, '\n', (size_t)(to - from));
+         (nl != nullptr) && ((nl + 1) < end);
+         nl = memchr(nl + 1, '\n', (size_t)(to - (nl + 1))) )
+   {
+      if ( index->num_lines == index->cap )
+         return false;
+
+      index->line_starts[index->num_lines] = (size_t)((nl + 1) - str);
+      index->line_counts[index->num_lines] = 0;
+      index->num_lines++;
+   }
+
+   return true;
 }
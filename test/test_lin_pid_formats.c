@@ -0,0 +1,219 @@
+/*!
+ * @file    test_lin_pid_formats.c
+ * @brief   Test file for single-pass LIN ID format classification
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "unity.h"
+#include "lin_pid_formats.h"
+
+/* Local Macro Definitions */
+#define MAX_ENTRY_LEN  8
+
+/* Local Datatypes */
+
+/* Local Variables */
+
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd ) \
+   isd,
+
+static const bool IsDecFormat[NUM_OF_NUMERIC_FORMATS] =
+{
+   #include "lin_pid_supported_formats.h"
+};
+
+#undef LIN_PID_NUMERIC_FORMAT
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+void test_LinPID_ParseFormattedID_Prefixes(void);
+void test_LinPID_ParseFormattedID_Suffixes(void);
+void test_LinPID_ParseFormattedID_BareDigits(void);
+void test_LinPID_ParseFormattedID_Invalid(void);
+void test_LinPID_ParseFormattedID_EchoesEveryFormat(void);
+void test_LinPID_PrintFormat(void);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_LinPID_ParseFormattedID_Prefixes);
+   RUN_TEST(test_LinPID_ParseFormattedID_Suffixes);
+   RUN_TEST(test_LinPID_ParseFormattedID_BareDigits);
+   RUN_TEST(test_LinPID_ParseFormattedID_Invalid);
+   RUN_TEST(test_LinPID_ParseFormattedID_EchoesEveryFormat);
+   RUN_TEST(test_LinPID_PrintFormat);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   // Nothing to do
+}
+
+void tearDown(void)
+{
+   // Nothing to do
+}
+
+/* Tests */
+
+void test_LinPID_ParseFormattedID_Prefixes(void)
+{
+   uint16_t val = 0;
+
+   TEST_ASSERT_EQUAL_INT( ClassicHexPrefix_NoLeadingZeros_Uppercase,
+                          LinPID_ParseFormattedID("0x3F", false, false, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 0x3F, val );
+
+   TEST_ASSERT_EQUAL_INT( ClassicHexPrefix_LeadingZeros_Lowercase,
+                          LinPID_ParseFormattedID("0x0a", false, false, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 0x0A, val );
+
+   TEST_ASSERT_EQUAL_INT( LowercasexPrefix_NoLeadingZeros_Lowercase,
+                          LinPID_ParseFormattedID("x1f", true, false, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 0x1F, val );
+
+   TEST_ASSERT_EQUAL_INT( UppercaseXPrefix_LeadingZeros_Uppercase,
+                          LinPID_ParseFormattedID("X07", false, false, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 0x07, val );
+}
+
+void test_LinPID_ParseFormattedID_Suffixes(void)
+{
+   uint16_t val = 0;
+
+   TEST_ASSERT_EQUAL_INT( LowercasehSuffix_NoLeadingZeros_Uppercase,
+                          LinPID_ParseFormattedID("3Ch", false, false, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 0x3C, val );
+
+   TEST_ASSERT_EQUAL_INT( UppercaseHSuffix_LeadingZeros_Lowercase,
+                          LinPID_ParseFormattedID("0cH", false, false, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 0x0C, val );
+
+   TEST_ASSERT_EQUAL_INT( UppercaseXSuffix_NoLeadingZeros_Uppercase,
+                          LinPID_ParseFormattedID("1AX", false, false, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 0x1A, val );
+
+   // 'd' is a hex digit, but not a dec one
+   TEST_ASSERT_EQUAL_INT( LowercasedSuffix_NoLeadingZeros,
+                          LinPID_ParseFormattedID("59d", false, false, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 59, val );
+
+   TEST_ASSERT_EQUAL_INT( UppercaseDSuffix_LeadingZeros,
+                          LinPID_ParseFormattedID("063D", false, false, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 63, val );
+
+   // ...and without the suffix, "1d" is bare hex
+   TEST_ASSERT_EQUAL_INT( HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase,
+                          LinPID_ParseFormattedID("1d", false, false, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 0x1D, val );
+}
+
+void test_LinPID_ParseFormattedID_BareDigits(void)
+{
+   uint16_t val = 0;
+
+   // Hex by default...
+   TEST_ASSERT_EQUAL_INT( HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase,
+                          LinPID_ParseFormattedID("12", false, false, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 0x12, val );
+
+   TEST_ASSERT_EQUAL_INT( HexNoPrefixOrSuffix_LeadingZeros_Uppercase,
+                          LinPID_ParseFormattedID("09", true, false, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 0x09, val );
+
+   // ...dec when asked for
+   TEST_ASSERT_EQUAL_INT( DecNoPrefixOrSuffix_NoLeadingZeros,
+                          LinPID_ParseFormattedID("12", false, true, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 12, val );
+
+   TEST_ASSERT_EQUAL_INT( DecNoPrefixOrSuffix_LeadingZeros,
+                          LinPID_ParseFormattedID("05", false, true, &val) );
+   TEST_ASSERT_EQUAL_UINT16( 5, val );
+
+   // No value wanted
+   TEST_ASSERT_EQUAL_INT( HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase,
+                          LinPID_ParseFormattedID("7", false, false, nullptr) );
+}
+
+void test_LinPID_ParseFormattedID_Invalid(void)
+{
+   uint16_t val = 0xBEEF;
+
+   TEST_ASSERT_EQUAL_INT( INVALID_NUMERIC_FORMAT, LinPID_ParseFormattedID("", false, false, &val) );
+   TEST_ASSERT_EQUAL_INT( INVALID_NUMERIC_FORMAT, LinPID_ParseFormattedID("0x1Fh", false, false, &val) );
+   TEST_ASSERT_EQUAL_INT( INVALID_NUMERIC_FORMAT, LinPID_ParseFormattedID("aF", false, false, &val) );
+   TEST_ASSERT_EQUAL_INT( INVALID_NUMERIC_FORMAT, LinPID_ParseFormattedID("123", false, false, &val) );
+   TEST_ASSERT_EQUAL_INT( INVALID_NUMERIC_FORMAT, LinPID_ParseFormattedID(" 12", false, false, &val) );
+   TEST_ASSERT_EQUAL_INT( INVALID_NUMERIC_FORMAT, LinPID_ParseFormattedID("0xFFFFFFFFFF", false, false, &val) );
+
+   // Right shape, wrong base
+   TEST_ASSERT_EQUAL_INT( INVALID_NUMERIC_FORMAT, LinPID_ParseFormattedID("0x12", false, true, &val) );
+   TEST_ASSERT_EQUAL_INT( INVALID_NUMERIC_FORMAT, LinPID_ParseFormattedID("12d", true, false, &val) );
+
+   TEST_ASSERT_EQUAL_UINT16( 0xBEEF, val );
+}
+
+void test_LinPID_ParseFormattedID_EchoesEveryFormat(void)
+{
+   // Print every value in every format, then parse it back: the value must
+   // come back, and printing it in the format found must give the same entry.
+   char entry[MAX_ENTRY_LEN];
+   char echo[MAX_ENTRY_LEN];
+   char msg[64];
+
+   for ( int f = 0; f < NUM_OF_NUMERIC_FORMATS; f++ )
+   {
+      const unsigned max_val = IsDecFormat[f] ? 99u : 0xFFu;
+      for ( unsigned v = 0; v <= max_val; v++ )
+      {
+         (void)snprintf(entry, sizeof entry, LinPID_PrintFormat((enum NumericFormat_E)f), v);
+
+         uint16_t val = 0;
+         enum NumericFormat_E found = LinPID_ParseFormattedID(entry, !IsDecFormat[f], IsDecFormat[f], &val);
+         (void)snprintf(msg, sizeof msg, "\"%s\" (format %d)", entry, f);
+
+         // A lone "0" in a no-leading-zeros format can only be read back as
+         // the leading-zeros one, which echoes it as "00"
+         if ( v == 0u )
+         {
+            TEST_ASSERT_TRUE_MESSAGE( found != INVALID_NUMERIC_FORMAT, msg );
+            TEST_ASSERT_EQUAL_INT_MESSAGE( 0, val, msg );
+            continue;
+         }
+
+         TEST_ASSERT_TRUE_MESSAGE( found != INVALID_NUMERIC_FORMAT, msg );
+         TEST_ASSERT_EQUAL_INT_MESSAGE( (int)v, val, msg );
+
+         (void)snprintf(echo, sizeof echo, LinPID_PrintFormat(found), v);
+         TEST_ASSERT_EQUAL_STRING_MESSAGE( entry, echo, msg );
+      }
+   }
+}
+
+void test_LinPID_PrintFormat(void)
+{
+   TEST_ASSERT_EQUAL_STRING( "0x%02X", LinPID_PrintFormat(ClassicHexPrefix_LeadingZeros_Uppercase) );
+   TEST_ASSERT_EQUAL_STRING( "%dD", LinPID_PrintFormat(UppercaseDSuffix_NoLeadingZeros) );
+   TEST_ASSERT_NULL( LinPID_PrintFormat(INVALID_NUMERIC_FORMAT) );
+   TEST_ASSERT_NULL( LinPID_PrintFormat(NUM_OF_NUMERIC_FORMATS) );
+}
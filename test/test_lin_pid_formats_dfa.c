@@ -0,0 +1,208 @@
+/*!
+ * @file    test_lin_pid_formats_dfa.c
+ * @brief   Test file for the generated LIN PID numeric format DFA
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "unity.h"
+#include "lin_pid_formats.h"
+#include "lin_pid_formats_dfa.h"
+
+/* Local Macro Definitions */
+#define MAX_ENUM_LEN  5
+
+/* Local Datatypes */
+
+/* Local Variables */
+
+#define LIN_PID_NUMERIC_FORMAT( enum, regexp, prnt_fmt, ish, isd ) \
+   regexp,
+
+static const char * const Regexes[NUM_OF_NUMERIC_FORMATS] =
+{
+   #include "lin_pid_supported_formats.h"
+};
+
+#undef LIN_PID_NUMERIC_FORMAT
+
+// Every char the format regexes care about, plus a few they don't
+static const char Alphabet[] = "0159afgAFGxXhHdD -";
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+void test_LinPIDDfa_TableShape(void);
+void test_LinPIDDfa_KnownIDs(void);
+void test_LinPIDDfa_NoMatch(void);
+void test_LinPIDDfa_MatchesEveryRegexExhaustively(void);
+
+static bool RegexMatches( const char * rx, const char * str );
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_LinPIDDfa_TableShape);
+   RUN_TEST(test_LinPIDDfa_KnownIDs);
+   RUN_TEST(test_LinPIDDfa_NoMatch);
+   RUN_TEST(test_LinPIDDfa_MatchesEveryRegexExhaustively);
+
+   return UNITY_END();
+}
+
+/* Test Setup */
+
+void setUp(void)
+{
+   // Nothing to do
+}
+
+void tearDown(void)
+{
+   // Nothing to do
+}
+
+/* Tests */
+
+void test_LinPIDDfa_TableShape(void)
+{
+   TEST_ASSERT_EQUAL_INT( NUM_OF_NUMERIC_FORMATS, LIN_PID_DFA_NUM_FORMATS );
+   TEST_ASSERT_EQUAL_UINT64( 0u, LIN_PID_DFA_ACCEPTS[LIN_PID_DFA_DEAD_STATE] );
+   for ( size_t c = 0; c < LIN_PID_DFA_NUM_CLASSES; c++ )
+   {
+      // Nothing gets out of the dead state
+      TEST_ASSERT_EQUAL_UINT8( LIN_PID_DFA_DEAD_STATE, LIN_PID_DFA_NEXT[LIN_PID_DFA_DEAD_STATE][c] );
+   }
+}
+
+void test_LinPIDDfa_KnownIDs(void)
+{
+   uint64_t m = LinPID_FormatsMatching("0x3F");
+   TEST_ASSERT_EQUAL_UINT64( (1ull << ClassicHexPrefix_NoLeadingZeros_Uppercase) |
+                             (1ull << ClassicHexPrefix_LeadingZeros_Uppercase), m );
+
+   m = LinPID_FormatsMatching("0ah");
+   TEST_ASSERT_EQUAL_UINT64( (1ull << LowercasehSuffix_LeadingZeros_Lowercase), m );
+
+   m = LinPID_FormatsMatching("059d");
+   TEST_ASSERT_EQUAL_UINT64( (1ull << LowercasedSuffix_LeadingZeros), m );
+
+   // Bare digits are ambiguous between dec and hex
+   m = LinPID_FormatsMatching("12");
+   TEST_ASSERT_TRUE( m & (1ull << DecNoPrefixOrSuffix_NoLeadingZeros) );
+   TEST_ASSERT_TRUE( m & (1ull << HexNoPrefixOrSuffix_NoLeadingZeros_Uppercase) );
+   TEST_ASSERT_TRUE( m & (1ull << HexNoPrefixOrSuffix_NoLeadingZeros_Lowercase) );
+
+   m = LinPID_FormatsMatching("Xa");
+   TEST_ASSERT_EQUAL_UINT64( (1ull << UppercaseXPrefix_NoLeadingZeros_Lowercase) |
+                             (1ull << UppercaseXPrefix_LeadingZeros_Lowercase), m );
+}
+
+void test_LinPIDDfa_NoMatch(void)
+{
+   TEST_ASSERT_EQUAL_UINT64( 0u, LinPID_FormatsMatching("") );
+   TEST_ASSERT_EQUAL_UINT64( 0u, LinPID_FormatsMatching("x") );
+   TEST_ASSERT_EQUAL_UINT64( 0u, LinPID_FormatsMatching("0x1Fh") );
+   TEST_ASSERT_EQUAL_UINT64( 0u, LinPID_FormatsMatching("123") );
+   TEST_ASSERT_EQUAL_UINT64( 0u, LinPID_FormatsMatching("aF") );
+   TEST_ASSERT_EQUAL_UINT64( 0u, LinPID_FormatsMatching(" 12") );
+   TEST_ASSERT_EQUAL_UINT64( 0u, LinPID_FormatsMatching("12\xff") );
+}
+
+void test_LinPIDDfa_MatchesEveryRegexExhaustively(void)
+{
+   const size_t nalpha = sizeof(Alphabet) - 1;
+   char str[MAX_ENUM_LEN + 1];
+   size_t idx[MAX_ENUM_LEN];
+
+   for ( size_t len = 0; len <= MAX_ENUM_LEN; len++ )
+   {
+      memset(idx, 0, sizeof idx);
+      bool done = false;
+      while ( !done )
+      {
+         for ( size_t i = 0; i < len; i++ )
+            str[i] = Alphabet[idx[i]];
+         str[len] = '\0';
+
+         uint64_t expected = 0;
+         for ( size_t f = 0; f < NUM_OF_NUMERIC_FORMATS; f++ )
+         {
+            if ( RegexMatches(Regexes[f], str) )
+               expected |= (1ull << f);
+         }
+         if ( expected != LinPID_FormatsMatching(str) )
+         {
+            char msg[64];
+            (void)snprintf(msg, sizeof msg, "\"%s\"", str);
+            TEST_FAIL_MESSAGE(msg);
+         }
+
+         // Next string of this length, odometer-style
+         size_t i = 0;
+         while ( (i < len) && (++idx[i] == nalpha) )
+            idx[i++] = 0;
+         done = (i == len);
+      }
+   }
+}
+
+/* Local Helper Functions */
+
+// Backtracking reference matcher for the regex subset the format list uses:
+// ^, $, literal chars, [...] classes with ranges, and ?.
+static bool ItemMatches( const char * item, const char * item_end, char c )
+{
+   if ( *item != '[' )
+      return *item == c;
+
+   for ( const char * p = item + 1; p < (item_end - 1); p++ )
+   {
+      if ( (p[1] == '-') && ((p + 2) < (item_end - 1)) )
+      {
+         if ( (c >= p[0]) && (c <= p[2]) )
+            return true;
+         p += 2;
+      }
+      else if ( *p == c )
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+static bool MatchHere( const char * rx, const char * str )
+{
+   if ( (rx[0] == '$') && (rx[1] == '\0') )
+      return *str == '\0';
+
+   const char * item_end = (*rx == '[') ? (strchr(rx, ']') + 1) : (rx + 1);
+   bool optional = (*item_end == '?');
+   const char * next = item_end + (optional ? 1 : 0);
+
+   if ( (*str != '\0') && ItemMatches(rx, item_end, *str) && MatchHere(next, str + 1) )
+      return true;
+
+   return optional && MatchHere(next, str);
+}
+
+static bool RegexMatches( const char * rx, const char * str )
+{
+   TEST_ASSERT_TRUE( rx[0] == '^' );
+   return MatchHere(rx + 1, str);
+}
@@ -0,0 +1,293 @@
+/*!
+ * @file    test_nparsy_any.c
+ * @brief   Test file for the mixed-type (tagged value) nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "unity.h"
+#include "nparsy.h"
+#include "nparsy_uint.h"
+
+/* Local Macro Definitions */
+#define MAX_VALS      64
+
+/* Local Datatypes */
+
+/* Local Variables */
+static struct NParsyValue Actual[MAX_VALS];
+static uint64_t Expected[MAX_VALS];
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyAny_InvalidInputs(void);
+void test_NParsyAnyList_InvalidInputs(void);
+
+// - Basic Usage -
+void test_NParsyAny_EachType(void);
+void test_NParsyAny_OutOfRange(void);
+void test_NParsyAny_LongFloat(void);
+void test_NParsyAnyList_MixedLine(void);
+void test_NParsyAnyList_Floats(void);
+void test_NParsyAnyList_NonDecDefaults(void);
+void test_NParsyAnyList_SkipsMalformedAndOutOfRange(void);
+void test_NParsyAnyList_UIntsMatchU64List(void);
+
+static void CheckValue(const struct NParsyValue * val, enum NParsyValueType type, double expected);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyAny_InvalidInputs);
+   RUN_TEST(test_NParsyAnyList_InvalidInputs);
+
+   RUN_TEST(test_NParsyAny_EachType);
+   RUN_TEST(test_NParsyAny_OutOfRange);
+   RUN_TEST(test_NParsyAny_LongFloat);
+   RUN_TEST(test_NParsyAnyList_MixedLine);
+   RUN_TEST(test_NParsyAnyList_Floats);
+   RUN_TEST(test_NParsyAnyList_NonDecDefaults);
+   RUN_TEST(test_NParsyAnyList_SkipsMalformedAndOutOfRange);
+   RUN_TEST(test_NParsyAnyList_UIntsMatchU64List);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset(Actual, 0xA5, sizeof Actual);
+   memset(Expected, 0xA5, sizeof Expected);
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/******************************************************************************/
+/* Test Cases */
+
+void test_NParsyAny_InvalidInputs(void)
+{
+   struct NParsyValue val;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyAny(nullptr, &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyAny("1", nullptr, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDefaultFormat, NParsyAny("1", &val, nullptr, NParsy_NumOfFmts) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NoNumberFound, NParsyAny("no numbers", &val, nullptr, NParsy_Dec) );
+}
+
+void test_NParsyAnyList_InvalidInputs(void)
+{
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyAnyList(nullptr, Actual, 1, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyAnyList("1 2", nullptr, 1, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDefaultFormat, NParsyAnyList("1 2", Actual, 1, &n, NParsy_NumOfFmts) );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAnyList("", Actual, MAX_VALS, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( 0, n );
+}
+
+void test_NParsyAny_EachType(void)
+{
+   struct NParsyValue val;
+   size_t consumed = 0;
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAny("id=42;", &val, &consumed, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_U64, val.type );
+   TEST_ASSERT_EQUAL_UINT64( 42u, val.u64 );
+   TEST_ASSERT_EQUAL_size_t( 5, consumed );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAny("t = -17 C", &val, &consumed, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_I64, val.type );
+   TEST_ASSERT_EQUAL_INT64( -17, val.i64 );
+   TEST_ASSERT_EQUAL_size_t( 7, consumed );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAny("v: 3.25V", &val, &consumed, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_F64, val.type );
+   TEST_ASSERT_EQUAL_DOUBLE( 3.25, val.f64 );
+   TEST_ASSERT_EQUAL_size_t( 7, consumed );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAny("-0x80", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_I64, val.type );
+   TEST_ASSERT_EQUAL_INT64( -128, val.i64 );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAny("-9223372036854775808", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_I64, val.type );
+   TEST_ASSERT_EQUAL_INT64( INT64_MIN, val.i64 );
+
+   // Malformed numbers in front are passed over
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAny("12ab 0x1Fh 7", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_U64, val.type );
+   TEST_ASSERT_EQUAL_UINT64( 7u, val.u64 );
+}
+
+void test_NParsyAny_OutOfRange(void)
+{
+   struct NParsyValue val = { .type = NParsy_U64, .u64 = 99u };
+
+   TEST_ASSERT_EQUAL_INT( NParsy_NumberOutOfRange, NParsyAny("18446744073709551616", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NumberOutOfRange, NParsyAny("-9223372036854775809", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NumberOutOfRange, NParsyAny("1e400", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NumberOutOfRange, NParsyAny("-1e400", &val, nullptr, NParsy_Dec) );
+
+   // val is left alone
+   TEST_ASSERT_EQUAL_INT( NParsy_U64, val.type );
+   TEST_ASSERT_EQUAL_UINT64( 99u, val.u64 );
+}
+
+void test_NParsyAny_LongFloat(void)
+{
+   // Far more digits than a double holds, which is still in range
+   static const char pi[] = "3.1415926535897932384626433827950288419716939937510582097494459230781640";
+   struct NParsyValue val;
+   size_t consumed = 0;
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAny(pi, &val, &consumed, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_F64, val.type );
+   TEST_ASSERT_TRUE( val.f64 == strtod(pi, nullptr) ); // Bit-exact
+   TEST_ASSERT_EQUAL_size_t( sizeof pi - 1u, consumed );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAny("x=-0.000000000000000000000000000000000000000000000000000000000000000125e64",
+                                                       &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_F64, val.type );
+   TEST_ASSERT_EQUAL_DOUBLE( -1.25, val.f64 );
+}
+
+void test_NParsyAnyList_MixedLine(void)
+{
+   // A '-' straight after a digit is a dash, not a sign
+   static const char line[] = "2026-10-18 12:00:07 sensor=3 temp=-4.5 rssi=-71 gain=0x1F err=1.5e-3 n=0";
+   static const enum NParsyValueType types[] =
+   {
+      NParsy_U64, NParsy_U64, NParsy_U64, NParsy_U64, NParsy_U64, NParsy_U64,
+      NParsy_U64, NParsy_F64, NParsy_I64, NParsy_U64, NParsy_F64, NParsy_U64,
+   };
+   static const double vals[] =
+   {
+      2026, 10, 18, 12, 0, 7,
+      3, -4.5, -71, 0x1F, 1.5e-3, 0,
+   };
+   size_t n = 0;
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAnyList(line, Actual, MAX_VALS, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( sizeof types / sizeof types[0], n );
+   for ( size_t i = 0; i < n; i++ )
+      CheckValue(&Actual[i], types[i], vals[i]);
+
+   // Stops at len
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAnyList(line, Actual, 3, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( 3, n );
+}
+
+void test_NParsyAnyList_Floats(void)
+{
+   static const char str[] = "0.1 .5 -.25 6.02214076e23 1E-5 -2e+2 123456789.123456789 0.000000000000000000001";
+   static const double expected[] =
+   {
+      0.1, 0.5, -0.25, 6.02214076e23, 1e-5, -2e2, 123456789.123456789, 1e-21
+   };
+   size_t n = 0;
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAnyList(str, Actual, MAX_VALS, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( sizeof expected / sizeof expected[0], n );
+   for ( size_t i = 0; i < n; i++ )
+   {
+      TEST_ASSERT_EQUAL_INT( NParsy_F64, Actual[i].type );
+      TEST_ASSERT_EQUAL_DOUBLE( expected[i], Actual[i].f64 );
+   }
+}
+
+void test_NParsyAnyList_NonDecDefaults(void)
+{
+   size_t n = 0;
+
+   // "1e5" is hex, and "2.5" is two numbers
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAnyList("1e5 -1f 2.5", Actual, MAX_VALS, &n, NParsy_Hex) );
+   TEST_ASSERT_EQUAL_size_t( 4, n );
+   CheckValue(&Actual[0], NParsy_U64, 0x1E5);
+   CheckValue(&Actual[1], NParsy_I64, -0x1F);
+   CheckValue(&Actual[2], NParsy_U64, 2);
+   CheckValue(&Actual[3], NParsy_U64, 5);
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAnyList("101 -11 0x10", Actual, MAX_VALS, &n, NParsy_Bin) );
+   TEST_ASSERT_EQUAL_size_t( 3, n );
+   CheckValue(&Actual[0], NParsy_U64, 5);
+   CheckValue(&Actual[1], NParsy_I64, -3);
+   CheckValue(&Actual[2], NParsy_U64, 16);
+}
+
+void test_NParsyAnyList_SkipsMalformedAndOutOfRange(void)
+{
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult,
+                          NParsyAnyList("12ab 1 99999999999999999999 -2 -99999999999999999999 1e999 3.5 0x1Fh",
+                                        Actual, MAX_VALS, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( 3, n );
+   CheckValue(&Actual[0], NParsy_U64, 1);
+   CheckValue(&Actual[1], NParsy_I64, -2);
+   CheckValue(&Actual[2], NParsy_F64, 3.5);
+}
+
+void test_NParsyAnyList_UIntsMatchU64List(void)
+{
+   static const char str[] = "id=12, 0x1F,0b1010 -3 007 2.5 ffh 12ab 99999999999999999999 17d 0o17 x2A";
+
+   for ( int fmt = 0; fmt < (int)NParsy_NumOfFmts; fmt++ )
+   {
+      size_t nexp = 0;
+      size_t nact = 0;
+      size_t nu64 = 0;
+      TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64List(str, Expected, MAX_VALS, &nexp, (enum NParsyNumFormat)fmt) );
+      TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyAnyList(str, Actual, MAX_VALS, &nact, (enum NParsyNumFormat)fmt) );
+
+      for ( size_t i = 0; i < nact; i++ )
+      {
+         if ( Actual[i].type != NParsy_U64 )
+            continue;
+         TEST_ASSERT_LESS_THAN_size_t( nexp, nu64 );
+         TEST_ASSERT_EQUAL_UINT64( Expected[nu64], Actual[i].u64 );
+         nu64++;
+      }
+      TEST_ASSERT_EQUAL_size_t( nexp, nu64 );
+   }
+}
+
+/******************************************************************************/
+/* Helpers */
+
+static void CheckValue(const struct NParsyValue * val, enum NParsyValueType type, double expected)
+{
+   TEST_ASSERT_EQUAL_INT( type, val->type );
+   switch ( type )
+   {
+      case NParsy_U64:
+         TEST_ASSERT_EQUAL_UINT64( (uint64_t)expected, val->u64 );
+         break;
+      case NParsy_I64:
+         TEST_ASSERT_EQUAL_INT64( (int64_t)expected, val->i64 );
+         break;
+      case NParsy_F64:
+         TEST_ASSERT_EQUAL_DOUBLE( expected, val->f64 );
+         break;
+      case NParsy_NumOfValueTypes:
+      default:
+         TEST_FAIL();
+         break;
+   }
+}
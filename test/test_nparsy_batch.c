@@ -0,0 +1,286 @@
+/*!
+ * @file    test_nparsy_batch.c
+ * @brief   Test file for the batched multi-file nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "unity.h"
+#include "nparsy_batch.h"
+
+/* Local Macro Definitions */
+#define MAX_FILES 300
+
+/* Local Datatypes */
+// What the sink saw for one file
+struct FileSeen
+{
+   unsigned calls;
+   size_t n;
+   uint64_t sum;
+   uint64_t first;
+   uint64_t last;
+   enum NParsyResult result;
+};
+
+struct Seen
+{
+   pthread_mutex_t mtx;
+   struct FileSeen files[MAX_FILES];
+};
+
+/* Local Variables */
+static char TmpPaths[MAX_FILES][64];
+static const char * Paths[MAX_FILES];
+static size_t NumTmpFiles;
+static struct Seen Seen;
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// Helpers
+static const char * MakeTmpFile(const char * contents, size_t len);
+static void Sink(size_t file_idx, const uint64_t * vals, size_t n, enum NParsyResult result, void * ctx);
+static void RunBothPaths(size_t npaths, const struct NParsyBatchOptions * opts, void (*check)(void));
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyUIntFiles_NullArgs(void);
+void test_NParsyUIntFiles_InvalidDefaultFmt(void);
+
+// - Basic Usage -
+void test_NParsyUIntFiles_NoFiles(void);
+void test_NParsyUIntFiles_FewFiles(void);
+void test_NParsyUIntFiles_MissingAndEmptyFiles(void);
+void test_NParsyUIntFiles_ManyFilesSmallQueue(void);
+void test_NParsyUIntFiles_BigFile(void);
+void test_NParsyUIntFiles_HexDefault(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyUIntFiles_NullArgs);
+   RUN_TEST(test_NParsyUIntFiles_InvalidDefaultFmt);
+
+   RUN_TEST(test_NParsyUIntFiles_NoFiles);
+   RUN_TEST(test_NParsyUIntFiles_FewFiles);
+   RUN_TEST(test_NParsyUIntFiles_MissingAndEmptyFiles);
+   RUN_TEST(test_NParsyUIntFiles_ManyFilesSmallQueue);
+   RUN_TEST(test_NParsyUIntFiles_BigFile);
+   RUN_TEST(test_NParsyUIntFiles_HexDefault);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   NumTmpFiles = 0;
+   (void)pthread_mutex_init(&Seen.mtx, nullptr);
+   memset(Seen.files, 0, sizeof Seen.files);
+}
+void tearDown(void)
+{
+   for ( size_t i = 0; i < NumTmpFiles; i++ )
+      (void)unlink(TmpPaths[i]);
+   (void)pthread_mutex_destroy(&Seen.mtx);
+}
+
+/* Helpers */
+static const char * MakeTmpFile(const char * contents, size_t len)
+{
+   TEST_ASSERT_TRUE(NumTmpFiles < MAX_FILES);
+   char * path = TmpPaths[NumTmpFiles++];
+   strcpy(path, "/tmp/nparsy_batch_test_XXXXXX");
+   int fd = mkstemp(path);
+   TEST_ASSERT_TRUE(fd >= 0);
+   TEST_ASSERT_EQUAL_INT64((int64_t)len, (int64_t)write(fd, contents, len));
+   (void)close(fd);
+   return path;
+}
+
+static void Sink(size_t file_idx, const uint64_t * vals, size_t n, enum NParsyResult result, void * ctx)
+{
+   struct Seen * seen = ctx;
+   TEST_ASSERT_TRUE(file_idx < MAX_FILES);
+
+   uint64_t sum = 0;
+   for ( size_t i = 0; i < n; i++ )
+      sum += vals[i];
+
+   (void)pthread_mutex_lock(&seen->mtx);
+   struct FileSeen * f = &seen->files[file_idx];
+   f->calls++;
+   f->n = n;
+   f->sum = sum;
+   f->first = (n > 0) ? vals[0] : 0;
+   f->last = (n > 0) ? vals[n - 1] : 0;
+   f->result = result;
+   (void)pthread_mutex_unlock(&seen->mtx);
+}
+
+// Same files through io_uring (where available) and through pread()
+static void RunBothPaths(size_t npaths, const struct NParsyBatchOptions * opts, void (*check)(void))
+{
+   struct NParsyBatchOptions o = (opts != nullptr) ? *opts : (struct NParsyBatchOptions){ 0 };
+
+   for ( int no_uring = 0; no_uring < 2; no_uring++ )
+   {
+      memset(Seen.files, 0, sizeof Seen.files);
+      o.no_io_uring = (no_uring != 0);
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntFiles(Paths, npaths, Sink, &Seen, &o, NParsy_Dec));
+      check();
+   }
+}
+
+/* Test Cases */
+void test_NParsyUIntFiles_NullArgs(void)
+{
+   const char * paths[] = { "/tmp" };
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntFiles(nullptr, 1, Sink, &Seen, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntFiles(paths, 1, nullptr, &Seen, nullptr, NParsy_Dec));
+}
+
+void test_NParsyUIntFiles_InvalidDefaultFmt(void)
+{
+   const char * paths[] = { "/tmp" };
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyUIntFiles(paths, 1, Sink, &Seen, nullptr, NParsy_NumOfFmts));
+   TEST_ASSERT_EQUAL_UINT(0, Seen.files[0].calls);
+}
+
+void test_NParsyUIntFiles_NoFiles(void)
+{
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntFiles(Paths, 0, Sink, &Seen, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT(0, Seen.files[0].calls);
+}
+
+static void CheckFewFiles(void)
+{
+   TEST_ASSERT_EQUAL_UINT(1, Seen.files[0].calls);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, Seen.files[0].result);
+   TEST_ASSERT_EQUAL_size_t(3, Seen.files[0].n);
+   TEST_ASSERT_EQUAL_UINT64(1 + 22 + 333, Seen.files[0].sum);
+
+   TEST_ASSERT_EQUAL_UINT(1, Seen.files[1].calls);
+   TEST_ASSERT_EQUAL_size_t(2, Seen.files[1].n);
+   TEST_ASSERT_EQUAL_UINT64(0xFF, Seen.files[1].first);
+   TEST_ASSERT_EQUAL_UINT64(5, Seen.files[1].last);
+
+   // The out-of-range number is skipped
+   TEST_ASSERT_EQUAL_UINT(1, Seen.files[2].calls);
+   TEST_ASSERT_EQUAL_size_t(2, Seen.files[2].n);
+   TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, Seen.files[2].first);
+   TEST_ASSERT_EQUAL_UINT64(7, Seen.files[2].last);
+}
+
+void test_NParsyUIntFiles_FewFiles(void)
+{
+   const char f0[] = "a=1, b=22, c=333";
+   const char f1[] = "0xFF then 5\n";
+   const char f2[] = "18446744073709551615 18446744073709551616 7";
+   Paths[0] = MakeTmpFile(f0, sizeof f0 - 1);
+   Paths[1] = MakeTmpFile(f1, sizeof f1 - 1);
+   Paths[2] = MakeTmpFile(f2, sizeof f2 - 1);
+
+   RunBothPaths(3, nullptr, CheckFewFiles);
+}
+
+static void CheckMissingAndEmpty(void)
+{
+   for ( size_t i = 0; i < 4; i++ )
+      TEST_ASSERT_EQUAL_UINT(1, Seen.files[i].calls);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_FileAccessFailed, Seen.files[0].result);
+   TEST_ASSERT_EQUAL_size_t(0, Seen.files[0].n);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, Seen.files[1].result);
+   TEST_ASSERT_EQUAL_size_t(0, Seen.files[1].n);
+   TEST_ASSERT_EQUAL_INT(NParsy_FileAccessFailed, Seen.files[2].result); // directory
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, Seen.files[3].result);
+   TEST_ASSERT_EQUAL_UINT64(42, Seen.files[3].first);
+}
+
+void test_NParsyUIntFiles_MissingAndEmptyFiles(void)
+{
+   Paths[0] = "/nonexistent/nparsy/file";
+   Paths[1] = MakeTmpFile("", 0);
+   Paths[2] = "/tmp";
+   Paths[3] = MakeTmpFile("42", 2);
+
+   RunBothPaths(4, nullptr, CheckMissingAndEmpty);
+}
+
+static void CheckManyFiles(void)
+{
+   for ( size_t i = 0; i < MAX_FILES; i++ )
+   {
+      TEST_ASSERT_EQUAL_UINT(1, Seen.files[i].calls);
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, Seen.files[i].result);
+      TEST_ASSERT_EQUAL_size_t(i + 1, Seen.files[i].n);
+      TEST_ASSERT_EQUAL_UINT64((uint64_t)i * (i + 1) / 2, Seen.files[i].sum);
+   }
+}
+
+void test_NParsyUIntFiles_ManyFilesSmallQueue(void)
+{
+   // File i holds 0..i, so more files than the queue can hold at once
+   static char contents[8 * MAX_FILES];
+   for ( size_t i = 0; i < MAX_FILES; i++ )
+   {
+      size_t len = 0;
+      for ( size_t v = 0; v <= i; v++ )
+         len += (size_t)snprintf(contents + len, sizeof contents - len, "%zu ", v);
+      Paths[i] = MakeTmpFile(contents, len);
+   }
+
+   struct NParsyBatchOptions o = { .workers = 3, .queue_depth = 4 };
+   RunBothPaths(MAX_FILES, &o, CheckManyFiles);
+}
+
+static void CheckBigFile(void)
+{
+   TEST_ASSERT_EQUAL_UINT(1, Seen.files[0].calls);
+   TEST_ASSERT_EQUAL_size_t(200'000, Seen.files[0].n);
+   TEST_ASSERT_EQUAL_UINT64(199'999ull * 200'000ull / 2ull, Seen.files[0].sum);
+   TEST_ASSERT_EQUAL_UINT64(199'999, Seen.files[0].last);
+}
+
+void test_NParsyUIntFiles_BigFile(void)
+{
+   size_t cap = 200'000 * 8;
+   char * contents = malloc(cap);
+   TEST_ASSERT_NOT_NULL(contents);
+   size_t len = 0;
+   for ( unsigned v = 0; v < 200'000; v++ )
+      len += (size_t)snprintf(contents + len, cap - len, "%u,", v);
+   Paths[0] = MakeTmpFile(contents, len);
+   free(contents);
+
+   RunBothPaths(1, nullptr, CheckBigFile);
+}
+
+void test_NParsyUIntFiles_HexDefault(void)
+{
+   const char f0[] = "ff 10 abc";
+   Paths[0] = MakeTmpFile(f0, sizeof f0 - 1);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntFiles(Paths, 1, Sink, &Seen, nullptr, NParsy_Hex));
+   TEST_ASSERT_EQUAL_size_t(3, Seen.files[0].n);
+   TEST_ASSERT_EQUAL_UINT64(0xFF, Seen.files[0].first);
+   TEST_ASSERT_EQUAL_UINT64(0xFF + 0x10 + 0xABC, Seen.files[0].sum);
+}
@@ -0,0 +1,351 @@
+/*!
+ * @file    test_nparsy_bigint.c
+ * @brief   Test file for the arbitrary-width unsigned integer nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "unity.h"
+#include "nparsy_bigint.h"
+
+/* Local Macro Definitions */
+#define MAX_TEST_LIMBS  1200
+
+/* Local Datatypes */
+
+/* Local Variables */
+static uint64_t Limbs[MAX_TEST_LIMBS];
+static uint64_t Expected[MAX_TEST_LIMBS];
+static char BigStr[25'000];
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// Helpers
+static size_t ReferenceDecToLimbs(const char * digits, size_t ndigits, uint64_t * limbs);
+static void FillRandomDigits(char * str, size_t ndigits, const char * alphabet, unsigned seed);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyBigUInt_NullStr(void);
+void test_NParsyBigUInt_NullBuf(void);
+void test_NParsyBigUInt_InvalidDefaultFmt(void);
+void test_NParsyBigUInt_NoNumber(void);
+
+// - Small Numbers -
+void test_NParsyBigUInt_Zero(void);
+void test_NParsyBigUInt_Dec_64bit(void);
+void test_NParsyBigUInt_Dec_2Pow64(void);
+
+// - Larger Integer Cases -
+void test_NParsyBigUInt_NumStr_Dec_ExtremelyLargeNumber(void);
+void test_NParsyBigUInt_NumStr_Hex_ExtremelyLargeNumber(void);
+void test_NParsyBigUInt_NumStr_Bin_ExtremelyLargeNumber(void);
+void test_NParsyBigUInt_NumStr_Oct_ExtremelyLargeNumber(void);
+void test_NParsyBigUInt_SentenceStr_Hex_256bitHash(void);
+void test_NParsyBigUInt_Dec_RangeOfLengths(void);
+void test_NParsyBigUInt_Dec_10kDigits(void);
+
+// - Limits -
+void test_NParsyBigUInt_TooFewLimbs(void);
+void test_NParsyBigUInt_LeadingZerosDontCount(void);
+void test_NParsyBigUInt_AccumulatedStrlen(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyBigUInt_NullStr);
+   RUN_TEST(test_NParsyBigUInt_NullBuf);
+   RUN_TEST(test_NParsyBigUInt_InvalidDefaultFmt);
+   RUN_TEST(test_NParsyBigUInt_NoNumber);
+
+   RUN_TEST(test_NParsyBigUInt_Zero);
+   RUN_TEST(test_NParsyBigUInt_Dec_64bit);
+   RUN_TEST(test_NParsyBigUInt_Dec_2Pow64);
+
+   RUN_TEST(test_NParsyBigUInt_NumStr_Dec_ExtremelyLargeNumber);
+   RUN_TEST(test_NParsyBigUInt_NumStr_Hex_ExtremelyLargeNumber);
+   RUN_TEST(test_NParsyBigUInt_NumStr_Bin_ExtremelyLargeNumber);
+   RUN_TEST(test_NParsyBigUInt_NumStr_Oct_ExtremelyLargeNumber);
+   RUN_TEST(test_NParsyBigUInt_SentenceStr_Hex_256bitHash);
+   RUN_TEST(test_NParsyBigUInt_Dec_RangeOfLengths);
+   RUN_TEST(test_NParsyBigUInt_Dec_10kDigits);
+
+   RUN_TEST(test_NParsyBigUInt_TooFewLimbs);
+   RUN_TEST(test_NParsyBigUInt_LeadingZerosDontCount);
+   RUN_TEST(test_NParsyBigUInt_AccumulatedStrlen);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset(Limbs, 0xA5, sizeof Limbs);
+   memset(Expected, 0, sizeof Expected);
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/* Helpers */
+
+// Plain quadratic multiply-by-10-and-add, one digit at a time
+static size_t ReferenceDecToLimbs(const char * digits, size_t ndigits, uint64_t * limbs)
+{
+   size_t used = 1;
+   limbs[0] = 0;
+   for ( size_t i = 0; i < ndigits; i++ )
+   {
+      uint64_t carry = (uint64_t)(digits[i] - '0');
+      for ( size_t j = 0; j < used; j++ )
+      {
+         unsigned __int128 t = ((unsigned __int128)limbs[j] * 10u) + carry;
+         limbs[j] = (uint64_t)t;
+         carry = (uint64_t)(t >> 64);
+      }
+      if ( carry != 0u )
+         limbs[used++] = carry;
+   }
+   return used;
+}
+
+static void FillRandomDigits(char * str, size_t ndigits, const char * alphabet, unsigned seed)
+{
+   size_t nsymbols = strlen(alphabet);
+   srand(seed);
+   for ( size_t i = 0; i < ndigits; i++ )
+      str[i] = alphabet[(size_t)rand() % nsymbols];
+   if ( str[0] == '0' )
+      str[0] = alphabet[1];
+   str[ndigits] = '\0';
+}
+
+/* Test Cases */
+void test_NParsyBigUInt_NullStr(void)
+{
+   size_t used = 0;
+   enum NParsyResult res = NParsyBigUInt(nullptr, Limbs, 4, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, res);
+}
+
+void test_NParsyBigUInt_NullBuf(void)
+{
+   size_t used = 0;
+   enum NParsyResult res = NParsyBigUInt("25", nullptr, 4, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, res);
+   res = NParsyBigUInt("25", Limbs, 4, nullptr, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, res);
+}
+
+void test_NParsyBigUInt_InvalidDefaultFmt(void)
+{
+   size_t used = 0;
+   enum NParsyResult res = NParsyBigUInt("25", Limbs, 4, &used, nullptr, NParsy_NumOfFmts);
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, res);
+}
+
+void test_NParsyBigUInt_NoNumber(void)
+{
+   size_t used = 0;
+   enum NParsyResult res = NParsyBigUInt("Hi, there are no numbers here. -5 and 2.5 don't count", Limbs, 4, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_NoNumberFound, res);
+}
+
+void test_NParsyBigUInt_Zero(void)
+{
+   const char * strs[] = { "0", "000000000000000000000000000000", "0x0", "0b0000", "0o0" };
+   for ( size_t i = 0; i < (sizeof strs / sizeof strs[0]); i++ )
+   {
+      size_t used = 0;
+      enum NParsyResult res = NParsyBigUInt(strs[i], Limbs, 4, &used, nullptr, NParsy_Dec);
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+      TEST_ASSERT_EQUAL_size_t(1, used);
+      TEST_ASSERT_EQUAL_UINT64(0, Limbs[0]);
+   }
+}
+
+void test_NParsyBigUInt_Dec_64bit(void)
+{
+   size_t used = 0;
+   enum NParsyResult res = NParsyBigUInt("18446744073709551615", Limbs, 1, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(1, used);
+   TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, Limbs[0]);
+}
+
+void test_NParsyBigUInt_Dec_2Pow64(void)
+{
+   size_t used = 0;
+   enum NParsyResult res = NParsyBigUInt("18446744073709551616", Limbs, 2, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(2, used);
+   TEST_ASSERT_EQUAL_UINT64(0, Limbs[0]);
+   TEST_ASSERT_EQUAL_UINT64(1, Limbs[1]);
+}
+
+void test_NParsyBigUInt_NumStr_Dec_ExtremelyLargeNumber(void)
+{
+   // 2^256 - 1
+   size_t used = 0;
+   enum NParsyResult res = NParsyBigUInt(
+         "115792089237316195423570985008687907853269984665640564039457584007913129639935",
+         Limbs, 4, &used, nullptr, NParsy_Dec );
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(4, used);
+   for ( size_t i = 0; i < 4; i++ )
+      TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, Limbs[i]);
+}
+
+void test_NParsyBigUInt_NumStr_Hex_ExtremelyLargeNumber(void)
+{
+   size_t used = 0;
+   enum NParsyResult res = NParsyBigUInt("0x123456789abcdef0FEDCBA9876543210aBcDeF", Limbs, 4, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(3, used);
+   TEST_ASSERT_EQUAL_UINT64(0x9876543210ABCDEFu, Limbs[0]);
+   TEST_ASSERT_EQUAL_UINT64(0x789ABCDEF0FEDCBAu, Limbs[1]);
+   TEST_ASSERT_EQUAL_UINT64(0x123456u, Limbs[2]);
+}
+
+void test_NParsyBigUInt_NumStr_Bin_ExtremelyLargeNumber(void)
+{
+   // 1 followed by 64 zeros, then 0101
+   char str[2 + 1 + 64 + 4 + 1] = "0b1";
+   memset(str + 3, '0', 64);
+   memcpy(str + 3 + 64, "0101", 5);
+
+   size_t used = 0;
+   enum NParsyResult res = NParsyBigUInt(str, Limbs, 4, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(2, used);
+   TEST_ASSERT_EQUAL_UINT64(0x5u, Limbs[0]);
+   TEST_ASSERT_EQUAL_UINT64(0x10u, Limbs[1]);
+}
+
+void test_NParsyBigUInt_NumStr_Oct_ExtremelyLargeNumber(void)
+{
+   // 0o7 followed by 22 more 7s = 2^69 - 1
+   size_t used = 0;
+   enum NParsyResult res = NParsyBigUInt("0o77777777777777777777777", Limbs, 4, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(2, used);
+   TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, Limbs[0]);
+   TEST_ASSERT_EQUAL_UINT64(0x1Fu, Limbs[1]);
+
+   // Same thing as a bare number under the octal default
+   res = NParsyBigUInt("77777777777777777777777", Limbs, 4, &used, nullptr, NParsy_Oct);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, Limbs[0]);
+   TEST_ASSERT_EQUAL_UINT64(0x1Fu, Limbs[1]);
+}
+
+void test_NParsyBigUInt_SentenceStr_Hex_256bitHash(void)
+{
+   size_t used = 0;
+   const char str[] = "digest = 0e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855h (empty)";
+
+   enum NParsyResult res = NParsyBigUInt(str, Limbs, 4, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(4, used);
+   TEST_ASSERT_EQUAL_UINT64(0xa495991b7852b855u, Limbs[0]);
+   TEST_ASSERT_EQUAL_UINT64(0x27ae41e4649b934cu, Limbs[1]);
+   TEST_ASSERT_EQUAL_UINT64(0x9afbf4c8996fb924u, Limbs[2]);
+   TEST_ASSERT_EQUAL_UINT64(0xe3b0c44298fc1c14u, Limbs[3]);
+
+   // Hex by default, bare
+   res = NParsyBigUInt(str + strlen("digest = 0"), Limbs, 4, &used, nullptr, NParsy_Hex);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_UINT64(0xe3b0c44298fc1c14u, Limbs[3]);
+}
+
+void test_NParsyBigUInt_Dec_RangeOfLengths(void)
+{
+   // Straddle the block, base case, and Karatsuba thresholds
+   for ( size_t ndigits = 1; ndigits <= 1500; ndigits += 7 )
+   {
+      FillRandomDigits(BigStr, ndigits, "0123456789", (unsigned)ndigits);
+      size_t expected_used = ReferenceDecToLimbs(BigStr, ndigits, Expected);
+
+      size_t used = 0;
+      enum NParsyResult res = NParsyBigUInt(BigStr, Limbs, MAX_TEST_LIMBS, &used, nullptr, NParsy_Dec);
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+      TEST_ASSERT_EQUAL_size_t(expected_used, used);
+      TEST_ASSERT_EQUAL_UINT64_ARRAY(Expected, Limbs, used);
+   }
+}
+
+void test_NParsyBigUInt_Dec_10kDigits(void)
+{
+   for ( unsigned seed = 1; seed <= 3; seed++ )
+   {
+      size_t ndigits = 10'000u + seed;
+      FillRandomDigits(BigStr, ndigits, "0123456789", seed);
+      size_t expected_used = ReferenceDecToLimbs(BigStr, ndigits, Expected);
+
+      size_t used = 0;
+      enum NParsyResult res = NParsyBigUInt(BigStr, Limbs, MAX_TEST_LIMBS, &used, nullptr, NParsy_Dec);
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+      TEST_ASSERT_EQUAL_size_t(expected_used, used);
+      TEST_ASSERT_EQUAL_UINT64_ARRAY(Expected, Limbs, used);
+   }
+}
+
+void test_NParsyBigUInt_TooFewLimbs(void)
+{
+   size_t used = 0;
+   enum NParsyResult res = NParsyBigUInt("18446744073709551616", Limbs, 1, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, res);
+   TEST_ASSERT_EQUAL_size_t(2, used);
+   TEST_ASSERT_EQUAL_UINT64(0xA5A5A5A5A5A5A5A5u, Limbs[0]);
+
+   res = NParsyBigUInt("0x10000000000000000", Limbs, 1, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, res);
+   TEST_ASSERT_EQUAL_size_t(2, used);
+   TEST_ASSERT_EQUAL_UINT64(0xA5A5A5A5A5A5A5A5u, Limbs[0]);
+}
+
+void test_NParsyBigUInt_LeadingZerosDontCount(void)
+{
+   size_t used = 0;
+   enum NParsyResult res = NParsyBigUInt("0x0000000000000000000000000000000000000000FF", Limbs, 1, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(1, used);
+   TEST_ASSERT_EQUAL_UINT64(0xFFu, Limbs[0]);
+
+   res = NParsyBigUInt("00000000000000000000000000000000000000000042", Limbs, 1, &used, nullptr, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(1, used);
+   TEST_ASSERT_EQUAL_UINT64(42u, Limbs[0]);
+}
+
+void test_NParsyBigUInt_AccumulatedStrlen(void)
+{
+   const char str[] = "a: 0x1F, b: 99999999999999999999999";
+   size_t used = 0;
+   size_t acc = 0;
+
+   enum NParsyResult res = NParsyBigUInt(str, Limbs, 4, &used, &acc, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_UINT64(0x1Fu, Limbs[0]);
+   TEST_ASSERT_EQUAL_size_t(strlen("a: 0x1F"), acc);
+
+   size_t acc2 = 0;
+   res = NParsyBigUInt(str + acc, Limbs, 4, &used, &acc2, NParsy_Dec);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(2, used);
+   TEST_ASSERT_EQUAL_size_t(strlen(str), acc + acc2);
+}
@@ -0,0 +1,230 @@
+/*!
+ * @file    test_nparsy_file.c
+ * @brief   Test file for the memory-mapped file nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "unity.h"
+#include "nparsy_file.h"
+
+/* Local Macro Definitions */
+
+/* Local Datatypes */
+
+/* Local Variables */
+static char TmpPath[64];
+static int TmpFd = -1;
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// Helpers
+static void WriteTmpFile(const char * contents, size_t len);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyUIntFile_NullPath(void);
+void test_NParsyUIntFile_NullBuf(void);
+void test_NParsyUIntFile_InvalidDefaultFmt(void);
+void test_NParsyUIntFile_MissingFile(void);
+void test_NParsyUIntFd_BadFd(void);
+
+// - Basic Usage -
+void test_NParsyUIntFile_EmptyFile(void);
+void test_NParsyUIntFile_Telemetry(void);
+void test_NParsyUIntFile_NumberRightAtPageEnd(void);
+void test_NParsyUIntFile_EmbeddedNullsDontStopParse(void);
+void test_NParsyUIntFile_BufLimit(void);
+void test_NParsyUIntFd_IgnoresOffset(void);
+void test_NParsyUIntFile_LargerThanStringLimit(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyUIntFile_NullPath);
+   RUN_TEST(test_NParsyUIntFile_NullBuf);
+   RUN_TEST(test_NParsyUIntFile_InvalidDefaultFmt);
+   RUN_TEST(test_NParsyUIntFile_MissingFile);
+   RUN_TEST(test_NParsyUIntFd_BadFd);
+
+   RUN_TEST(test_NParsyUIntFile_EmptyFile);
+   RUN_TEST(test_NParsyUIntFile_Telemetry);
+   RUN_TEST(test_NParsyUIntFile_NumberRightAtPageEnd);
+   RUN_TEST(test_NParsyUIntFile_EmbeddedNullsDontStopParse);
+   RUN_TEST(test_NParsyUIntFile_BufLimit);
+   RUN_TEST(test_NParsyUIntFd_IgnoresOffset);
+   RUN_TEST(test_NParsyUIntFile_LargerThanStringLimit);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   strcpy(TmpPath, "/tmp/nparsy_file_test_XXXXXX");
+   TmpFd = mkstemp(TmpPath);
+   TEST_ASSERT_TRUE(TmpFd >= 0);
+}
+void tearDown(void)
+{
+   if ( TmpFd >= 0 )
+   {
+      (void)close(TmpFd);
+      (void)unlink(TmpPath);
+      TmpFd = -1;
+   }
+}
+
+/* Helpers */
+static void WriteTmpFile(const char * contents, size_t len)
+{
+   TEST_ASSERT_EQUAL_INT64((int64_t)len, (int64_t)write(TmpFd, contents, len));
+}
+
+/* Test Cases */
+void test_NParsyUIntFile_NullPath(void)
+{
+   uint64_t buf[1];
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyUIntFile(nullptr, buf, 1, nullptr, NParsy_Dec));
+}
+
+void test_NParsyUIntFile_NullBuf(void)
+{
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntFile(TmpPath, nullptr, 1, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntFd(TmpFd, nullptr, 1, nullptr, NParsy_Dec));
+}
+
+void test_NParsyUIntFile_InvalidDefaultFmt(void)
+{
+   uint64_t buf[1];
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyUIntFile(TmpPath, buf, 1, nullptr, NParsy_NumOfFmts));
+}
+
+void test_NParsyUIntFile_MissingFile(void)
+{
+   uint64_t buf[1];
+   TEST_ASSERT_EQUAL_INT(NParsy_FileAccessFailed, NParsyUIntFile("/nonexistent/nparsy/file", buf, 1, nullptr, NParsy_Dec));
+   // Not a regular file
+   TEST_ASSERT_EQUAL_INT(NParsy_FileAccessFailed, NParsyUIntFile("/tmp", buf, 1, nullptr, NParsy_Dec));
+}
+
+void test_NParsyUIntFd_BadFd(void)
+{
+   uint64_t buf[1];
+   TEST_ASSERT_EQUAL_INT(NParsy_FileAccessFailed, NParsyUIntFd(-1, buf, 1, nullptr, NParsy_Dec));
+}
+
+void test_NParsyUIntFile_EmptyFile(void)
+{
+   uint64_t buf[1];
+   size_t n = 99;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntFile(TmpPath, buf, 1, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+}
+
+void test_NParsyUIntFile_Telemetry(void)
+{
+   const char contents[] = "t=1000 rpm=0x1F40 flags=0b1010 err=-1 temp=21.5\nt=1001 rpm=8000 flags=0b1011\n";
+   WriteTmpFile(contents, sizeof contents - 1);
+
+   uint64_t buf[8];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntFile(TmpPath, buf, 8, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(6, n);
+   const uint64_t expected[] = { 1000, 0x1F40, 0xA, 1001, 8000, 0xB };
+   TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, buf, 6);
+}
+
+void test_NParsyUIntFile_NumberRightAtPageEnd(void)
+{
+   // The file ends on a page boundary, mid-digit-run: any read past the end
+   // of the mapping would fault.
+   long pagesz = sysconf(_SC_PAGESIZE);
+   char * contents = malloc((size_t)pagesz);
+   TEST_ASSERT_NOT_NULL(contents);
+   memset(contents, ' ', (size_t)pagesz);
+   memcpy(contents + pagesz - 21, " 12345678901234567890", 21);
+   WriteTmpFile(contents, (size_t)pagesz);
+   free(contents);
+
+   uint64_t buf[2];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntFile(TmpPath, buf, 2, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+   TEST_ASSERT_EQUAL_UINT64(12345678901234567890u, buf[0]);
+}
+
+void test_NParsyUIntFile_EmbeddedNullsDontStopParse(void)
+{
+   const char contents[] = "1\0" "2\0" "3";
+   WriteTmpFile(contents, sizeof contents - 1);
+
+   uint64_t buf[4];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntFile(TmpPath, buf, 4, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(3, n);
+   TEST_ASSERT_EQUAL_UINT64(3, buf[2]);
+}
+
+void test_NParsyUIntFile_BufLimit(void)
+{
+   const char contents[] = "1 2 3 4 5";
+   WriteTmpFile(contents, sizeof contents - 1);
+
+   uint64_t buf[2];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntFile(TmpPath, buf, 2, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(2, n);
+   TEST_ASSERT_EQUAL_UINT64(2, buf[1]);
+}
+
+void test_NParsyUIntFd_IgnoresOffset(void)
+{
+   const char contents[] = "FF 10";
+   WriteTmpFile(contents, sizeof contents - 1); // fd offset now at the end
+
+   uint64_t buf[2];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntFd(TmpFd, buf, 2, &n, NParsy_Hex));
+   TEST_ASSERT_EQUAL_size_t(2, n);
+   TEST_ASSERT_EQUAL_UINT64(0xFF, buf[0]);
+   TEST_ASSERT_EQUAL_UINT64(0x10, buf[1]);
+}
+
+void test_NParsyUIntFile_LargerThanStringLimit(void)
+{
+   // 300k 7-char lines = 2.1M chars, over NPARSY_MAX_PARSABLE_STRING_LEN
+   FILE * f = fdopen(dup(TmpFd), "w");
+   TEST_ASSERT_NOT_NULL(f);
+   for ( unsigned i = 0; i < 300'000u; i++ )
+      fprintf(f, "%06u\n", i);
+   TEST_ASSERT_EQUAL_INT(0, fclose(f));
+
+   uint64_t * buf = malloc(300'000u * sizeof *buf);
+   TEST_ASSERT_NOT_NULL(buf);
+   size_t n = 0;
+   enum NParsyResult res = NParsyUIntFile(TmpPath, buf, 300'000u, &n, NParsy_Dec);
+   uint64_t last = buf[299'999];
+   free(buf);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(300'000u, n);
+   TEST_ASSERT_EQUAL_UINT64(299'999u, last);
+}
@@ -0,0 +1,388 @@
+/*!
+ * @file    test_nparsy_fixed.c
+ * @brief   Test file for the fixed-point nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "unity.h"
+#include "nparsy_fixed.h"
+
+/* Local Macro Definitions */
+
+/* Local Datatypes */
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// ----- Unit Test Cases -----
+// -- Single Fixed-Point Parsing --
+// - Invalid Inputs -
+void test_NParsyFixed_NullStr(void);
+void test_NParsyFixed_NullBuf(void);
+void test_NParsyFixed_InvalidScale(void);
+void test_NParsyFixed_InvalidRoundingPolicy(void);
+void test_NParsyFixed_NoNumber(void);
+
+// - Basic Usage -
+void test_NParsyFixed_IntegerOnly(void);
+void test_NParsyFixed_ExactScale(void);
+void test_NParsyFixed_ShortFractionPadded(void);
+void test_NParsyFixed_LeadingDot(void);
+void test_NParsyFixed_Negative(void);
+void test_NParsyFixed_SentenceStr(void);
+void test_NParsyFixed_LongIntegerPart(void);
+void test_NParsyFixed_AccumulatedStrlen(void);
+
+// - Rounding -
+void test_NParsyFixed_Truncate(void);
+void test_NParsyFixed_RoundHalfAwayFromZero(void);
+void test_NParsyFixed_RoundHalfEven(void);
+
+// - Range -
+void test_NParsyFixed_Int64Limits(void);
+void test_NParsyFixed_OutOfRange(void);
+void test_NParsyFixed_RoundingIntoOutOfRange(void);
+
+// -- List Parsing --
+void test_NParsyFixedList_Basic(void);
+void test_NParsyFixedList_BufLimit(void);
+void test_NParsyFixedList_SkipsOutOfRange(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyFixed_NullStr);
+   RUN_TEST(test_NParsyFixed_NullBuf);
+   RUN_TEST(test_NParsyFixed_InvalidScale);
+   RUN_TEST(test_NParsyFixed_InvalidRoundingPolicy);
+   RUN_TEST(test_NParsyFixed_NoNumber);
+
+   RUN_TEST(test_NParsyFixed_IntegerOnly);
+   RUN_TEST(test_NParsyFixed_ExactScale);
+   RUN_TEST(test_NParsyFixed_ShortFractionPadded);
+   RUN_TEST(test_NParsyFixed_LeadingDot);
+   RUN_TEST(test_NParsyFixed_Negative);
+   RUN_TEST(test_NParsyFixed_SentenceStr);
+   RUN_TEST(test_NParsyFixed_LongIntegerPart);
+   RUN_TEST(test_NParsyFixed_AccumulatedStrlen);
+
+   RUN_TEST(test_NParsyFixed_Truncate);
+   RUN_TEST(test_NParsyFixed_RoundHalfAwayFromZero);
+   RUN_TEST(test_NParsyFixed_RoundHalfEven);
+
+   RUN_TEST(test_NParsyFixed_Int64Limits);
+   RUN_TEST(test_NParsyFixed_OutOfRange);
+   RUN_TEST(test_NParsyFixed_RoundingIntoOutOfRange);
+
+   RUN_TEST(test_NParsyFixedList_Basic);
+   RUN_TEST(test_NParsyFixedList_BufLimit);
+   RUN_TEST(test_NParsyFixedList_SkipsOutOfRange);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   // Do nothing
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/* Test Cases */
+void test_NParsyFixed_NullStr(void)
+{
+   int64_t val = 0;
+   enum NParsyResult res = NParsyFixed(nullptr, 3, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, res);
+}
+
+void test_NParsyFixed_NullBuf(void)
+{
+   enum NParsyResult res = NParsyFixed("12.345", 3, nullptr, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, res);
+}
+
+void test_NParsyFixed_InvalidScale(void)
+{
+   int64_t val = 0;
+   for ( unsigned scale = NPARSY_MAX_FIXED_SCALE + 1u; scale <= UINT8_MAX; scale++ )
+   {
+      enum NParsyResult res = NParsyFixed("12.345", (uint8_t)scale, &val, nullptr, NParsy_Truncate);
+      TEST_ASSERT_EQUAL_INT(NParsy_InvalidScale, res);
+   }
+}
+
+void test_NParsyFixed_InvalidRoundingPolicy(void)
+{
+   int64_t val = 0;
+   enum NParsyResult res = NParsyFixed("12.345", 3, &val, nullptr, NParsy_NumOfRoundingPolicies);
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidRoundingPolicy, res);
+}
+
+void test_NParsyFixed_NoNumber(void)
+{
+   int64_t val = 42;
+   size_t acc = 0;
+   const char str[] = "Hi, there are no numbers here. - + .";
+   enum NParsyResult res = NParsyFixed(str, 3, &val, &acc, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_NoNumberFound, res);
+   TEST_ASSERT_EQUAL_INT64(42, val);
+   TEST_ASSERT_EQUAL_size_t(strlen(str), acc);
+}
+
+void test_NParsyFixed_IntegerOnly(void)
+{
+   int64_t val = 0;
+   int64_t expected = 12;
+   for ( uint8_t scale = 0; scale <= 17; scale++ )
+   {
+      enum NParsyResult res = NParsyFixed("12", scale, &val, nullptr, NParsy_Truncate);
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+      TEST_ASSERT_EQUAL_INT64(expected, val);
+      if ( scale < 17 )
+         expected *= 10;
+   }
+}
+
+void test_NParsyFixed_ExactScale(void)
+{
+   int64_t val = 0;
+   enum NParsyResult res = NParsyFixed("12.345", 3, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(12345, val);
+
+   res = NParsyFixed("98765432.123456789", 9, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(98765432123456789, val);
+}
+
+void test_NParsyFixed_ShortFractionPadded(void)
+{
+   int64_t val = 0;
+   enum NParsyResult res = NParsyFixed("12.3", 4, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(123000, val);
+
+   res = NParsyFixed("7.", 2, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(700, val);
+}
+
+void test_NParsyFixed_LeadingDot(void)
+{
+   int64_t val = 0;
+   enum NParsyResult res = NParsyFixed(".05", 2, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(5, val);
+
+   res = NParsyFixed("-.5", 2, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(-50, val);
+
+   // At scale 0 the only digit is the round digit
+   static const int64_t pos[NParsy_NumOfRoundingPolicies] = { 0, 1, 0 };
+   static const int64_t neg[NParsy_NumOfRoundingPolicies] = { 0, -1, 0 };
+   for ( int r = 0; r < (int)NParsy_NumOfRoundingPolicies; r++ )
+   {
+      res = NParsyFixed(".5", 0, &val, nullptr, (enum NParsyRoundingPolicy)r);
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+      TEST_ASSERT_EQUAL_INT64(pos[r], val);
+
+      res = NParsyFixed("-.5", 0, &val, nullptr, (enum NParsyRoundingPolicy)r);
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+      TEST_ASSERT_EQUAL_INT64(neg[r], val);
+   }
+}
+
+void test_NParsyFixed_Negative(void)
+{
+   int64_t val = 0;
+   enum NParsyResult res = NParsyFixed("-12.345", 3, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(-12345, val);
+
+   res = NParsyFixed("+12.345", 3, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(12345, val);
+}
+
+void test_NParsyFixed_SentenceStr(void)
+{
+   int64_t val = 0;
+   enum NParsyResult res = NParsyFixed("The price is $1999.99 today.", 2, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(199999, val);
+}
+
+void test_NParsyFixed_LongIntegerPart(void)
+{
+   // Long enough to go through more than one 8-digit chunk
+   int64_t val = 0;
+   enum NParsyResult res = NParsyFixed("x 1234567890123456.7", 1, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(12345678901234567, val);
+}
+
+void test_NParsyFixed_AccumulatedStrlen(void)
+{
+   const char str[] = "a=1.5, b=-2.25";
+   int64_t val = 0;
+   size_t acc = 0;
+
+   enum NParsyResult res = NParsyFixed(str, 2, &val, &acc, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(150, val);
+   TEST_ASSERT_EQUAL_size_t(strlen("a=1.5"), acc);
+
+   size_t acc2 = 0;
+   res = NParsyFixed(str + acc, 2, &val, &acc2, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(-225, val);
+   TEST_ASSERT_EQUAL_size_t(strlen(str), acc + acc2);
+}
+
+void test_NParsyFixed_Truncate(void)
+{
+   int64_t val = 0;
+   enum NParsyResult res = NParsyFixed("1.23499999", 3, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(1234, val);
+
+   res = NParsyFixed("-1.23499999", 3, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(-1234, val);
+}
+
+void test_NParsyFixed_RoundHalfAwayFromZero(void)
+{
+   int64_t val = 0;
+   enum NParsyResult res = NParsyFixed("1.2345", 3, &val, nullptr, NParsy_RoundHalfAwayFromZero);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(1235, val);
+
+   res = NParsyFixed("-1.2345", 3, &val, nullptr, NParsy_RoundHalfAwayFromZero);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(-1235, val);
+
+   res = NParsyFixed("1.2344999", 3, &val, nullptr, NParsy_RoundHalfAwayFromZero);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(1234, val);
+
+   res = NParsyFixed("9.9999", 2, &val, nullptr, NParsy_RoundHalfAwayFromZero);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(1000, val);
+}
+
+void test_NParsyFixed_RoundHalfEven(void)
+{
+   struct { const char * str; int64_t expected; } cases[] =
+   {
+      { "1.2345",    1234  },
+      { "1.2355",    1236  },
+      { "1.23450001", 1235 },
+      { "-1.2345",  -1234  },
+      { "-1.2355",  -1236  },
+      { "0.0005",      0   },
+      { "0.0015",      2   },
+   };
+
+   for ( size_t i = 0; i < (sizeof cases / sizeof cases[0]); i++ )
+   {
+      int64_t val = 0;
+      enum NParsyResult res = NParsyFixed(cases[i].str, 3, &val, nullptr, NParsy_RoundHalfEven);
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+      TEST_ASSERT_EQUAL_INT64(cases[i].expected, val);
+   }
+}
+
+void test_NParsyFixed_Int64Limits(void)
+{
+   int64_t val = 0;
+   enum NParsyResult res = NParsyFixed("922337203685477.5807", 4, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(INT64_MAX, val);
+
+   res = NParsyFixed("-922337203685477.5808", 4, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_INT64(INT64_MIN, val);
+}
+
+void test_NParsyFixed_OutOfRange(void)
+{
+   int64_t val = 42;
+   size_t acc = 0;
+   const char str[] = "922337203685477.5808";
+   enum NParsyResult res = NParsyFixed(str, 4, &val, &acc, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, res);
+   TEST_ASSERT_EQUAL_INT64(42, val);
+   TEST_ASSERT_EQUAL_size_t(strlen(str), acc);
+
+   res = NParsyFixed("99999999999999999999999", 0, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, res);
+
+   res = NParsyFixed("10", NPARSY_MAX_FIXED_SCALE, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, res);
+}
+
+void test_NParsyFixed_RoundingIntoOutOfRange(void)
+{
+   int64_t val = 0;
+   enum NParsyResult res = NParsyFixed("922337203685477.58075", 4, &val, nullptr, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+
+   res = NParsyFixed("922337203685477.58075", 4, &val, nullptr, NParsy_RoundHalfAwayFromZero);
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, res);
+}
+
+void test_NParsyFixedList_Basic(void)
+{
+   int64_t buf[8] = {0};
+   size_t nparsed = 0;
+   const int64_t expected[] = { 1234, -50, 7000, 1 };
+
+   enum NParsyResult res = NParsyFixedList("12.34, -0.5; 70 and .014", 2, buf, 8, &nparsed, NParsy_RoundHalfEven);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(4, nparsed);
+   TEST_ASSERT_EQUAL_INT64_ARRAY(expected, buf, 4);
+}
+
+void test_NParsyFixedList_BufLimit(void)
+{
+   int64_t buf[3] = {0};
+   size_t nparsed = 0;
+   const int64_t expected[] = { 10, 20 };
+
+   enum NParsyResult res = NParsyFixedList("1 2 3 4", 1, buf, 2, &nparsed, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(2, nparsed);
+   TEST_ASSERT_EQUAL_INT64_ARRAY(expected, buf, 2);
+   TEST_ASSERT_EQUAL_INT64(0, buf[2]);
+}
+
+void test_NParsyFixedList_SkipsOutOfRange(void)
+{
+   int64_t buf[4] = {0};
+   size_t nparsed = 0;
+   const int64_t expected[] = { 100, 300 };
+
+   enum NParsyResult res = NParsyFixedList("1 99999999999999999999 3", 2, buf, 4, &nparsed, NParsy_Truncate);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(2, nparsed);
+   TEST_ASSERT_EQUAL_INT64_ARRAY(expected, buf, 2);
+}
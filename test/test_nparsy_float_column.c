@@ -0,0 +1,335 @@
+/*!
+ * @file    test_nparsy_float_column.c
+ * @brief   Test file for the fixed-width float column nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "unity.h"
+#include "nparsy_float.h"
+
+/* Local Macro Definitions */
+
+/* Local Datatypes */
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyDoubleColumn_NullBuf(void);
+void test_NParsyDoubleColumn_NullOut(void);
+void test_NParsyDoubleColumn_InvalidLayout(void);
+
+// - Basic Usage -
+void test_NParsyDoubleColumn_UniformRows(void);
+void test_NParsyDoubleColumn_NegativeAndSignedRows(void);
+void test_NParsyDoubleColumn_ColumnWithinRow(void);
+void test_NParsyDoubleColumn_LastRowWithoutNewline(void);
+void test_NParsyDoubleColumn_OutLenLimit(void);
+void test_NParsyDoubleColumn_RangeOfValues(void);
+
+// - Fallback -
+void test_NParsyDoubleColumn_DeviatingRowFallsBack(void);
+void test_NParsyDoubleColumn_WideFieldFallsBack(void);
+void test_NParsyDoubleColumn_GarbageRowStops(void);
+void test_NParsyDoubleColumn_OnlyPlainDecimals(void);
+
+// - Single Precision -
+void test_NParsyFloatColumn_UniformRows(void);
+void test_NParsyFloatColumn_GarbageRowStops(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyDoubleColumn_NullBuf);
+   RUN_TEST(test_NParsyDoubleColumn_NullOut);
+   RUN_TEST(test_NParsyDoubleColumn_InvalidLayout);
+
+   RUN_TEST(test_NParsyDoubleColumn_UniformRows);
+   RUN_TEST(test_NParsyDoubleColumn_NegativeAndSignedRows);
+   RUN_TEST(test_NParsyDoubleColumn_ColumnWithinRow);
+   RUN_TEST(test_NParsyDoubleColumn_LastRowWithoutNewline);
+   RUN_TEST(test_NParsyDoubleColumn_OutLenLimit);
+   RUN_TEST(test_NParsyDoubleColumn_RangeOfValues);
+
+   RUN_TEST(test_NParsyDoubleColumn_DeviatingRowFallsBack);
+   RUN_TEST(test_NParsyDoubleColumn_WideFieldFallsBack);
+   RUN_TEST(test_NParsyDoubleColumn_GarbageRowStops);
+   RUN_TEST(test_NParsyDoubleColumn_OnlyPlainDecimals);
+
+   RUN_TEST(test_NParsyFloatColumn_UniformRows);
+   RUN_TEST(test_NParsyFloatColumn_GarbageRowStops);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   // Do nothing
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/* Test Cases */
+void test_NParsyDoubleColumn_NullBuf(void)
+{
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 9, .decimal_pos = 4, .stride = 10 };
+   double out[4];
+   enum NParsyResult res = NParsyDoubleColumn(nullptr, 10, &layout, out, 4, nullptr);
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, res);
+}
+
+void test_NParsyDoubleColumn_NullOut(void)
+{
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 9, .decimal_pos = 4, .stride = 10 };
+   double out[4];
+   enum NParsyResult res = NParsyDoubleColumn("  12.3456\n", 10, &layout, nullptr, 4, nullptr);
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, res);
+   res = NParsyDoubleColumn("  12.3456\n", 10, nullptr, out, 4, nullptr);
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, res);
+}
+
+void test_NParsyDoubleColumn_InvalidLayout(void)
+{
+   const struct NParsyColumnLayout layouts[] =
+   {
+      { .offset = 0, .width = 0,  .decimal_pos = 0, .stride = 10 }, // empty field
+      { .offset = 0, .width = 9,  .decimal_pos = 9, .stride = 10 }, // '.' outside field
+      { .offset = 0, .width = 9,  .decimal_pos = 4, .stride = 0  }, // no stride
+      { .offset = 2, .width = 9,  .decimal_pos = 4, .stride = 10 }, // field spills into next row
+      { .offset = 0, .width = 11, .decimal_pos = 4, .stride = 10 },
+   };
+   double out[4];
+
+   for ( size_t i = 0; i < (sizeof layouts / sizeof layouts[0]); i++ )
+   {
+      enum NParsyResult res = NParsyDoubleColumn("  12.3456\n", 10, &layouts[i], out, 4, nullptr);
+      TEST_ASSERT_EQUAL_INT(NParsy_InvalidColumnLayout, res);
+   }
+}
+
+void test_NParsyDoubleColumn_UniformRows(void)
+{
+   const char col[] = "  12.3456\n"
+                      "   0.0001\n"
+                      "9999.9999\n"
+                      "   1.5000\n"
+                      "  42.4200\n";
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 9, .decimal_pos = 4, .stride = 10 };
+   const double expected[] = { 12.3456, 0.0001, 9999.9999, 1.5, 42.42 };
+   double out[8] = {0};
+   size_t nparsed = 0;
+
+   enum NParsyResult res = NParsyDoubleColumn(col, strlen(col), &layout, out, 8, &nparsed);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(5, nparsed);
+   for ( size_t i = 0; i < 5; i++ )
+      TEST_ASSERT_EQUAL_DOUBLE(expected[i], out[i]);
+}
+
+void test_NParsyDoubleColumn_NegativeAndSignedRows(void)
+{
+   const char col[] = " -12.3456\n"
+                      "  -0.0001\n"
+                      "  +1.2500\n"
+                      "-999.9999\n";
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 9, .decimal_pos = 4, .stride = 10 };
+   const double expected[] = { -12.3456, -0.0001, 1.25, -999.9999 };
+   double out[4] = {0};
+   size_t nparsed = 0;
+
+   enum NParsyResult res = NParsyDoubleColumn(col, strlen(col), &layout, out, 4, &nparsed);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(4, nparsed);
+   for ( size_t i = 0; i < 4; i++ )
+      TEST_ASSERT_EQUAL_DOUBLE(expected[i], out[i]);
+}
+
+void test_NParsyDoubleColumn_ColumnWithinRow(void)
+{
+   const char rows[] = "A,  1.25,x\n"
+                       "B, 10.50,y\n"
+                       "C,100.75,z\n";
+   const struct NParsyColumnLayout layout = { .offset = 2, .width = 6, .decimal_pos = 3, .stride = 11 };
+   const double expected[] = { 1.25, 10.5, 100.75 };
+   double out[3] = {0};
+   size_t nparsed = 0;
+
+   enum NParsyResult res = NParsyDoubleColumn(rows, strlen(rows), &layout, out, 3, &nparsed);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(3, nparsed);
+   for ( size_t i = 0; i < 3; i++ )
+      TEST_ASSERT_EQUAL_DOUBLE(expected[i], out[i]);
+}
+
+void test_NParsyDoubleColumn_LastRowWithoutNewline(void)
+{
+   const char col[] = "1.5\n2.5\n3.5";
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 3, .decimal_pos = 1, .stride = 4 };
+   double out[4] = {0};
+   size_t nparsed = 0;
+
+   enum NParsyResult res = NParsyDoubleColumn(col, strlen(col), &layout, out, 4, &nparsed);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(3, nparsed);
+   TEST_ASSERT_EQUAL_DOUBLE(3.5, out[2]);
+}
+
+void test_NParsyDoubleColumn_OutLenLimit(void)
+{
+   const char col[] = "1.5\n2.5\n3.5\n4.5\n5.5\n6.5\n";
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 3, .decimal_pos = 1, .stride = 4 };
+   double out[6] = {0};
+   size_t nparsed = 0;
+
+   enum NParsyResult res = NParsyDoubleColumn(col, strlen(col), &layout, out, 5, &nparsed);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(5, nparsed);
+   TEST_ASSERT_EQUAL_DOUBLE(5.5, out[4]);
+   TEST_ASSERT_EQUAL_DOUBLE(0.0, out[5]);
+}
+
+void test_NParsyDoubleColumn_RangeOfValues(void)
+{
+   // Every value from -99.999 to 99.999 in steps of 0.011, as "%8.3f\n" rows
+   enum { NUM_ROWS = 18181, ROW_LEN = 9 };
+   static char col[(NUM_ROWS * ROW_LEN) + 1];
+   static double out[NUM_ROWS];
+
+   for ( int i = 0; i < NUM_ROWS; i++ )
+   {
+      int milli = -99999 + (i * 11);
+      snprintf(col + (i * ROW_LEN), ROW_LEN + 1, "%8.3f\n", milli / 1000.0);
+   }
+
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 8, .decimal_pos = 4, .stride = ROW_LEN };
+   size_t nparsed = 0;
+   enum NParsyResult res = NParsyDoubleColumn(col, NUM_ROWS * ROW_LEN, &layout, out, NUM_ROWS, &nparsed);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(NUM_ROWS, nparsed);
+   for ( int i = 0; i < NUM_ROWS; i++ )
+      TEST_ASSERT_TRUE(strtod(col + (i * ROW_LEN), nullptr) == out[i]); // Must be correctly rounded
+}
+
+void test_NParsyDoubleColumn_DeviatingRowFallsBack(void)
+{
+   const char col[] = "  12.3456\n"
+                      "  123.0  \n" // '.' off the decimal position
+                      "12.34    \n" // left-aligned
+                      "   7.0   \n"
+                      "  -2.5000\n";
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 9, .decimal_pos = 4, .stride = 10 };
+   const double expected[] = { 12.3456, 123.0, 12.34, 7.0, -2.5 };
+   double out[5] = {0};
+   size_t nparsed = 0;
+
+   enum NParsyResult res = NParsyDoubleColumn(col, strlen(col), &layout, out, 5, &nparsed);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(5, nparsed);
+   for ( size_t i = 0; i < 5; i++ )
+      TEST_ASSERT_EQUAL_DOUBLE(expected[i], out[i]);
+}
+
+void test_NParsyDoubleColumn_WideFieldFallsBack(void)
+{
+   const char col[] = "      123456789.1234567891\n"
+                      "     -123456789.1234567891\n";
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 26, .decimal_pos = 15, .stride = 27 };
+   double out[2] = {0};
+   size_t nparsed = 0;
+
+   enum NParsyResult res = NParsyDoubleColumn(col, strlen(col), &layout, out, 2, &nparsed);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(2, nparsed);
+   TEST_ASSERT_EQUAL_DOUBLE(123456789.1234567891, out[0]);
+   TEST_ASSERT_EQUAL_DOUBLE(-123456789.1234567891, out[1]);
+}
+
+void test_NParsyDoubleColumn_GarbageRowStops(void)
+{
+   const char col[] = "  12.3456\n"
+                      "   0.0001\n"
+                      "  N/A    \n"
+                      "   1.5000\n";
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 9, .decimal_pos = 4, .stride = 10 };
+   double out[4] = {0};
+   size_t nparsed = 0;
+
+   enum NParsyResult res = NParsyDoubleColumn(col, strlen(col), &layout, out, 4, &nparsed);
+   TEST_ASSERT_EQUAL_INT(NParsy_ColumnRowMismatch, res);
+   TEST_ASSERT_EQUAL_size_t(2, nparsed);
+   TEST_ASSERT_EQUAL_DOUBLE(0.0001, out[1]);
+}
+
+void test_NParsyDoubleColumn_OnlyPlainDecimals(void)
+{
+   // Forms strtod/strtof would take, but that aren't [+-]digits[.digits]
+   const char * rows[] = { "     0x1A", "      inf", "      nan", "  1.23e+2", "   1,5000", "  - 1.500" };
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 9, .decimal_pos = 4, .stride = 10 };
+
+   for ( size_t i = 0; i < sizeof rows / sizeof rows[0]; i++ )
+   {
+      char col[32];
+      snprintf(col, sizeof col, "   2.5000\n%s\n", rows[i]);
+      double dout[2] = { -1.0, -1.0 };
+      float fout[2] = { -1.0f, -1.0f };
+      size_t nparsed = 0;
+
+      TEST_ASSERT_EQUAL_INT_MESSAGE(NParsy_ColumnRowMismatch, NParsyDoubleColumn(col, strlen(col), &layout, dout, 2, &nparsed), rows[i]);
+      TEST_ASSERT_EQUAL_size_t(1, nparsed);
+      TEST_ASSERT_EQUAL_DOUBLE(2.5, dout[0]);
+      TEST_ASSERT_EQUAL_DOUBLE(-1.0, dout[1]); // left alone
+
+      TEST_ASSERT_EQUAL_INT_MESSAGE(NParsy_ColumnRowMismatch, NParsyFloatColumn(col, strlen(col), &layout, fout, 2, &nparsed), rows[i]);
+      TEST_ASSERT_EQUAL_size_t(1, nparsed);
+      TEST_ASSERT_EQUAL_FLOAT(-1.0f, fout[1]);
+   }
+}
+
+void test_NParsyFloatColumn_UniformRows(void)
+{
+   const char col[] = "  12.3456\n"
+                      "  -0.0001\n"
+                      "9999.9999\n" // too many significant digits for the float fast path
+                      "   1.5000\n"
+                      "  42.4200\n";
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 9, .decimal_pos = 4, .stride = 10 };
+   const float expected[] = { 12.3456f, -0.0001f, 9999.9999f, 1.5f, 42.42f };
+   float out[5] = {0};
+   size_t nparsed = 0;
+
+   enum NParsyResult res = NParsyFloatColumn(col, strlen(col), &layout, out, 5, &nparsed);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(5, nparsed);
+   for ( size_t i = 0; i < 5; i++ )
+      TEST_ASSERT_TRUE(expected[i] == out[i]); // Must be correctly rounded
+}
+
+void test_NParsyFloatColumn_GarbageRowStops(void)
+{
+   const char col[] = "1.5\n?.?\n3.5\n";
+   const struct NParsyColumnLayout layout = { .offset = 0, .width = 3, .decimal_pos = 1, .stride = 4 };
+   float out[3] = {0};
+   size_t nparsed = 0;
+
+   enum NParsyResult res = NParsyFloatColumn(col, strlen(col), &layout, out, 3, &nparsed);
+   TEST_ASSERT_EQUAL_INT(NParsy_ColumnRowMismatch, res);
+   TEST_ASSERT_EQUAL_size_t(1, nparsed);
+}
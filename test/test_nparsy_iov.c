@@ -0,0 +1,425 @@
+/*!
+ * @file    test_nparsy_iov.c
+ * @brief   Test file for the scatter/gather (iovec) nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "unity.h"
+#include "nparsy_iov.h"
+#include "nparsy_uint.h"
+
+/* Local Macro Definitions */
+#define MAX_VALS  32
+
+/* Local Datatypes */
+
+/* Local Variables */
+static const char MixedStr[] = "id=12, 0x1F,0b1010 -3 007 2.5 ffh 12ab 99999999999999999999 42";
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// Helpers
+static void CheckEverySplit(const char * str, enum NParsyNumFormat fmt);
+static size_t RingWrite(char * ring, size_t capacity, size_t head, const char * str);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyUIntIov_InvalidInputs(void);
+void test_NParsyU64ListIov_InvalidInputs(void);
+
+// - Basic Usage -
+void test_NParsyU64ListIov_NoSegments(void);
+void test_NParsyU64ListIov_SingleSegment(void);
+void test_NParsyU64ListIov_EverySplitDec(void);
+void test_NParsyU64ListIov_EverySplitHex(void);
+void test_NParsyU64ListIov_ByteSegments(void);
+void test_NParsyU64ListIov_BufFull(void);
+void test_NParsyU64ListIov_OverlongNumberSkipped(void);
+void test_NParsyUIntIov_CursorWalk(void);
+void test_NParsyUIntIov_NullCursor(void);
+void test_NParsyU64ListRing_InvalidInputs(void);
+void test_NParsyU64ListRing_Empty(void);
+void test_NParsyU64ListRing_EveryWrapPoint(void);
+void test_NParsyU64ListRing_TrailingNumberHeldBack(void);
+void test_NParsyU64ListRing_OverlongNumberHeldBack(void);
+void test_NParsyU64ListRing_BufFull(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyUIntIov_InvalidInputs);
+   RUN_TEST(test_NParsyU64ListIov_InvalidInputs);
+
+   RUN_TEST(test_NParsyU64ListIov_NoSegments);
+   RUN_TEST(test_NParsyU64ListIov_SingleSegment);
+   RUN_TEST(test_NParsyU64ListIov_EverySplitDec);
+   RUN_TEST(test_NParsyU64ListIov_EverySplitHex);
+   RUN_TEST(test_NParsyU64ListIov_ByteSegments);
+   RUN_TEST(test_NParsyU64ListIov_BufFull);
+   RUN_TEST(test_NParsyU64ListIov_OverlongNumberSkipped);
+   RUN_TEST(test_NParsyUIntIov_CursorWalk);
+   RUN_TEST(test_NParsyUIntIov_NullCursor);
+
+   RUN_TEST(test_NParsyU64ListRing_InvalidInputs);
+   RUN_TEST(test_NParsyU64ListRing_Empty);
+   RUN_TEST(test_NParsyU64ListRing_EveryWrapPoint);
+   RUN_TEST(test_NParsyU64ListRing_TrailingNumberHeldBack);
+   RUN_TEST(test_NParsyU64ListRing_OverlongNumberHeldBack);
+   RUN_TEST(test_NParsyU64ListRing_BufFull);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   // Do nothing
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/* Helpers */
+// Split str into three segments at every pair of positions (with an empty
+// segment between each) and compare against parsing it whole
+static void CheckEverySplit(const char * str, enum NParsyNumFormat fmt)
+{
+   uint64_t whole[MAX_VALS];
+   size_t nwhole = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64List(str, whole, MAX_VALS, &nwhole, fmt));
+
+   size_t len = strlen(str);
+   for ( size_t i = 0; i <= len; i++ )
+   {
+      for ( size_t j = i; j <= len; j++ )
+      {
+         struct iovec iov[5] =
+         {
+            { .iov_base = (void *)str,       .iov_len = i },
+            { .iov_base = nullptr,           .iov_len = 0 },
+            { .iov_base = (void *)(str + i), .iov_len = j - i },
+            { .iov_base = (void *)str,       .iov_len = 0 },
+            { .iov_base = (void *)(str + j), .iov_len = len - j },
+         };
+         uint64_t vals[MAX_VALS];
+         size_t n = 0;
+         TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListIov(iov, 5, vals, MAX_VALS, &n, fmt));
+         TEST_ASSERT_EQUAL_size_t(nwhole, n);
+         TEST_ASSERT_EQUAL_UINT64_ARRAY(whole, vals, nwhole);
+      }
+   }
+}
+
+// Write str into the ring at head, wrapping as needed; returns the new head
+static size_t RingWrite(char * ring, size_t capacity, size_t head, const char * str)
+{
+   for ( ; *str != '\0'; str++ )
+   {
+      ring[head] = *str;
+      head = (head + 1u) % capacity;
+   }
+   return head;
+}
+
+/* Test Cases */
+void test_NParsyUIntIov_InvalidInputs(void)
+{
+   uint64_t val = 0;
+   struct iovec bad[2] = { { .iov_base = (void *)"1", .iov_len = 1 }, { .iov_base = nullptr, .iov_len = 1 } };
+   struct iovec good = { .iov_base = (void *)"1", .iov_len = 1 };
+
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyUIntIov(nullptr, 1, &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyUIntIov(bad, 2, &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntIov(&good, 1, nullptr, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyUIntIov(&good, 1, &val, nullptr, NParsy_NumOfFmts));
+   TEST_ASSERT_EQUAL_INT(NParsy_NoNumberFound, NParsyUIntIov(nullptr, 0, &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT64(0, val);
+}
+
+void test_NParsyU64ListIov_InvalidInputs(void)
+{
+   uint64_t buf[4];
+   struct iovec bad[2] = { { .iov_base = (void *)"1", .iov_len = 1 }, { .iov_base = nullptr, .iov_len = 1 } };
+   struct iovec good = { .iov_base = (void *)"1", .iov_len = 1 };
+
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyU64ListIov(nullptr, 1, buf, 4, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyU64ListIov(bad, 2, buf, 4, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU64ListIov(&good, 1, nullptr, 4, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyU64ListIov(&good, 1, buf, 4, nullptr, NParsy_NumOfFmts));
+}
+
+void test_NParsyU64ListIov_NoSegments(void)
+{
+   uint64_t buf[4];
+   size_t n = 99;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListIov(nullptr, 0, buf, 4, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+
+   struct iovec empty[3] = { 0 };
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListIov(empty, 3, buf, 4, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+}
+
+void test_NParsyU64ListIov_SingleSegment(void)
+{
+   struct iovec iov = { .iov_base = (void *)MixedStr, .iov_len = strlen(MixedStr) };
+   uint64_t buf[MAX_VALS];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListIov(&iov, 1, buf, MAX_VALS, &n, NParsy_Dec));
+
+   const uint64_t expected[] = { 12, 0x1F, 0b1010, 7, 42 };
+   TEST_ASSERT_EQUAL_size_t(5, n);
+   TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, buf, 5);
+}
+
+void test_NParsyU64ListIov_EverySplitDec(void)
+{
+   CheckEverySplit(MixedStr, NParsy_Dec);
+}
+
+void test_NParsyU64ListIov_EverySplitHex(void)
+{
+   CheckEverySplit("ff 0d12 x1F 10 abc -ab 0b11 zz12 7h", NParsy_Hex);
+}
+
+void test_NParsyU64ListIov_ByteSegments(void)
+{
+   // One segment per char - every number is stitched
+   size_t len = strlen(MixedStr);
+   struct iovec iov[sizeof MixedStr];
+   for ( size_t i = 0; i < len; i++ )
+      iov[i] = (struct iovec){ .iov_base = (void *)&MixedStr[i], .iov_len = 1 };
+
+   uint64_t buf[MAX_VALS];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListIov(iov, len, buf, MAX_VALS, &n, NParsy_Dec));
+   const uint64_t expected[] = { 12, 0x1F, 0b1010, 7, 42 };
+   TEST_ASSERT_EQUAL_size_t(5, n);
+   TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, buf, 5);
+}
+
+void test_NParsyU64ListIov_BufFull(void)
+{
+   struct iovec iov[2] = { { .iov_base = (void *)"1 2 3", .iov_len = 5 }, { .iov_base = (void *)"4 5", .iov_len = 3 } };
+   uint64_t buf[2];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListIov(iov, 2, buf, 2, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(2, n);
+   TEST_ASSERT_EQUAL_UINT64(2, buf[1]);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListIov(iov, 2, buf, 0, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+}
+
+void test_NParsyU64ListIov_OverlongNumberSkipped(void)
+{
+   // A run of leading zeros too long to carry, cut across segments
+   static char zeros[3u * NPARSY_IOV_CARRY_LEN];
+   memset(zeros, '0', sizeof zeros);
+   struct iovec iov[4] =
+   {
+      { .iov_base = (void *)"5 ", .iov_len = 2 },
+      { .iov_base = zeros,         .iov_len = sizeof zeros },
+      { .iov_base = zeros,         .iov_len = 10 },
+      { .iov_base = (void *)"7 8", .iov_len = 3 },
+   };
+   uint64_t buf[4];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListIov(iov, 4, buf, 4, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(2, n);
+   TEST_ASSERT_EQUAL_UINT64(5, buf[0]);
+   TEST_ASSERT_EQUAL_UINT64(8, buf[1]);
+
+   // Short enough to carry, and fine once stitched
+   iov[1].iov_len = NPARSY_IOV_CARRY_LEN - 10u;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListIov(iov, 4, buf, 4, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(3, n);
+   TEST_ASSERT_EQUAL_UINT64(7, buf[1]);
+}
+
+void test_NParsyUIntIov_CursorWalk(void)
+{
+   struct iovec iov[3] =
+   {
+      { .iov_base = (void *)"a 1",                 .iov_len = 3 },
+      { .iov_base = (void *)"2 999999999999999999", .iov_len = 20 },
+      { .iov_base = (void *)"99 -4 x",              .iov_len = 7 },
+   };
+   struct NParsyIovCursor cur = { 0 };
+   uint64_t val = 0;
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntIov(iov, 3, &val, &cur, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT64(12, val);
+   TEST_ASSERT_EQUAL_size_t(1, cur.seg);
+   TEST_ASSERT_EQUAL_size_t(1, cur.off);
+
+   // Cursor still moves past a number too big to fit
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyUIntIov(iov, 3, &val, &cur, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT64(12, val);
+   TEST_ASSERT_EQUAL_size_t(2, cur.seg);
+   TEST_ASSERT_EQUAL_size_t(2, cur.off);
+
+   // The negative and the lone x aren't unsigned integers
+   TEST_ASSERT_EQUAL_INT(NParsy_NoNumberFound, NParsyUIntIov(iov, 3, &val, &cur, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(3, cur.seg);
+   TEST_ASSERT_EQUAL_INT(NParsy_NoNumberFound, NParsyUIntIov(iov, 3, &val, &cur, NParsy_Dec));
+}
+
+void test_NParsyUIntIov_NullCursor(void)
+{
+   struct iovec iov[2] = { { .iov_base = (void *)"x", .iov_len = 1 }, { .iov_base = (void *)"1f 3", .iov_len = 4 } };
+   uint64_t val = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntIov(iov, 2, &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT64(0x1F, val);
+}
+
+void test_NParsyU64ListRing_InvalidInputs(void)
+{
+   char ring[8] = "1 2 3 4";
+   uint64_t buf[4];
+   size_t consumed = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyU64ListRing(nullptr, 8, 4, 0, buf, 4, nullptr, &consumed, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU64ListRing(ring, 8, 4, 0, nullptr, 4, nullptr, &consumed, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU64ListRing(ring, 8, 4, 0, buf, 4, nullptr, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyU64ListRing(ring, 8, 4, 0, buf, 4, nullptr, &consumed, NParsy_NumOfFmts));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidRingBuffer, NParsyU64ListRing(ring, 0, 0, 0, buf, 4, nullptr, &consumed, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidRingBuffer, NParsyU64ListRing(ring, 8, 8, 0, buf, 4, nullptr, &consumed, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidRingBuffer, NParsyU64ListRing(ring, 8, 0, 8, buf, 4, nullptr, &consumed, NParsy_Dec));
+}
+
+void test_NParsyU64ListRing_Empty(void)
+{
+   char ring[8] = "1 2 3 4";
+   uint64_t buf[4];
+   size_t n = 99;
+   size_t consumed = 99;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListRing(ring, 8, 5, 5, buf, 4, &n, &consumed, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+   TEST_ASSERT_EQUAL_size_t(0, consumed);
+}
+
+void test_NParsyU64ListRing_EveryWrapPoint(void)
+{
+   const char str[] = "id 12 0x3F,-4 0b101 99\n";
+   const uint64_t expected[] = { 12, 0x3F, 0b101, 99 };
+   constexpr size_t CAPACITY = 32u;
+   char ring[CAPACITY];
+
+   for ( size_t tail = 0; tail < CAPACITY; tail++ )
+   {
+      memset(ring, '#', sizeof ring);
+      size_t head = RingWrite(ring, CAPACITY, tail, str);
+
+      uint64_t buf[MAX_VALS];
+      size_t n = 0;
+      size_t consumed = 0;
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListRing(ring, CAPACITY, head, tail, buf, MAX_VALS, &n, &consumed, NParsy_Dec));
+      TEST_ASSERT_EQUAL_size_t(4, n);
+      TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, buf, 4);
+      TEST_ASSERT_EQUAL_size_t(strlen(str), consumed);
+   }
+}
+
+void test_NParsyU64ListRing_TrailingNumberHeldBack(void)
+{
+   constexpr size_t CAPACITY = 8u;
+   char ring[CAPACITY];
+   uint64_t buf[4];
+   size_t n = 0;
+   size_t consumed = 0;
+
+   // "5 1" so far, with the 1 right at the wrap point - more digits may follow
+   size_t tail = 5;
+   size_t head = RingWrite(ring, CAPACITY, tail, "5 1");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListRing(ring, CAPACITY, head, tail, buf, 4, &n, &consumed, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+   TEST_ASSERT_EQUAL_UINT64(5, buf[0]);
+   TEST_ASSERT_EQUAL_size_t(2, consumed);
+   tail = (tail + consumed) % CAPACITY;
+
+   head = RingWrite(ring, CAPACITY, head, "23");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListRing(ring, CAPACITY, head, tail, buf, 4, &n, &consumed, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+   TEST_ASSERT_EQUAL_size_t(0, consumed);
+
+   head = RingWrite(ring, CAPACITY, head, ";");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListRing(ring, CAPACITY, head, tail, buf, 4, &n, &consumed, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+   TEST_ASSERT_EQUAL_UINT64(123, buf[0]);
+   TEST_ASSERT_EQUAL_size_t(4, consumed);
+}
+
+void test_NParsyU64ListRing_OverlongNumberHeldBack(void)
+{
+   constexpr size_t CAPACITY = 4u * NPARSY_IOV_CARRY_LEN;
+   static char ring[CAPACITY];
+   static char ones[600];
+   memset(ones, '1', sizeof ones - 1u);
+   uint64_t buf[4];
+   size_t n = 0;
+   size_t consumed = 0;
+
+   // Too long to carry: unwrapped, cut at the wrap point with more than a
+   // carry's worth before it, and cut with more than a carry's worth after it
+   static const size_t tails[] = { 0u, CAPACITY - NPARSY_IOV_CARRY_LEN - 24u, CAPACITY - 100u };
+   for ( size_t i = 0; i < (sizeof tails / sizeof tails[0]); i++ )
+   {
+      size_t tail = tails[i];
+      size_t head = RingWrite(ring, CAPACITY, tail, "5 ");
+      head = RingWrite(ring, CAPACITY, head, ones);
+
+      // Still arriving, so none of it is consumed yet...
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListRing(ring, CAPACITY, head, tail, buf, 4, &n, &consumed, NParsy_Dec));
+      TEST_ASSERT_EQUAL_size_t(1, n);
+      TEST_ASSERT_EQUAL_UINT64(5, buf[0]);
+      TEST_ASSERT_EQUAL_size_t(2, consumed);
+      tail = (tail + consumed) % CAPACITY;
+
+      // ...and its last digits aren't mistaken for a number of their own
+      head = RingWrite(ring, CAPACITY, head, "11 7 ");
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListRing(ring, CAPACITY, head, tail, buf, 4, &n, &consumed, NParsy_Dec));
+      TEST_ASSERT_EQUAL_size_t(1, n);
+      TEST_ASSERT_EQUAL_UINT64(7, buf[0]);
+      TEST_ASSERT_EQUAL_size_t(strlen(ones) + 5u, consumed);
+   }
+}
+
+void test_NParsyU64ListRing_BufFull(void)
+{
+   constexpr size_t CAPACITY = 16u;
+   char ring[CAPACITY];
+   uint64_t buf[2];
+   size_t n = 0;
+   size_t consumed = 0;
+
+   size_t tail = 10;
+   size_t head = RingWrite(ring, CAPACITY, tail, "1 22 333 4\n");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListRing(ring, CAPACITY, head, tail, buf, 2, &n, &consumed, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(2, n);
+   TEST_ASSERT_EQUAL_UINT64(22, buf[1]);
+   TEST_ASSERT_EQUAL_size_t(4, consumed);
+
+   // Picking up where that left off
+   tail = (tail + consumed) % CAPACITY;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListRing(ring, CAPACITY, head, tail, buf, 2, &n, &consumed, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(2, n);
+   TEST_ASSERT_EQUAL_UINT64(333, buf[0]);
+   TEST_ASSERT_EQUAL_UINT64(4, buf[1]);
+   TEST_ASSERT_EQUAL_size_t(6, consumed); // buf filled up before the newline
+}
@@ -0,0 +1,279 @@
+/*!
+ * @file    test_nparsy_npy.c
+ * @brief   Test file for the .npy array writer nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "unity.h"
+#include "nparsy_npy.h"
+#include "nparsy_stream.h"
+
+/* Local Macro Definitions */
+
+/* Local Datatypes */
+
+/* Local Variables */
+static char TmpPath[64];
+static char * FileData;
+static size_t FileLen;
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// Helpers
+static void ReadBack(void);
+static const char * HeaderDict(void);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyNpyOpen_InvalidInputs(void);
+void test_NParsyNpyOpen_UnwritablePath(void);
+void test_NParsyNpyAppend_DtypeMismatch(void);
+
+// - Basic Usage -
+void test_NParsyNpy_EmptyArray(void);
+void test_NParsyNpy_HeaderLayout(void);
+void test_NParsyNpy_U64Values(void);
+void test_NParsyNpy_I64AndF64Values(void);
+void test_NParsyNpy_GrowsInPlace(void);
+void test_NParsyNpy_StreamSink(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyNpyOpen_InvalidInputs);
+   RUN_TEST(test_NParsyNpyOpen_UnwritablePath);
+   RUN_TEST(test_NParsyNpyAppend_DtypeMismatch);
+
+   RUN_TEST(test_NParsyNpy_EmptyArray);
+   RUN_TEST(test_NParsyNpy_HeaderLayout);
+   RUN_TEST(test_NParsyNpy_U64Values);
+   RUN_TEST(test_NParsyNpy_I64AndF64Values);
+   RUN_TEST(test_NParsyNpy_GrowsInPlace);
+   RUN_TEST(test_NParsyNpy_StreamSink);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   strcpy(TmpPath, "/tmp/nparsy_npy_test_XXXXXX");
+   int fd = mkstemp(TmpPath);
+   TEST_ASSERT_TRUE(fd >= 0);
+   (void)close(fd);
+   FileData = nullptr;
+   FileLen = 0;
+}
+void tearDown(void)
+{
+   (void)unlink(TmpPath);
+   free(FileData);
+}
+
+/* Helpers */
+static void ReadBack(void)
+{
+   FILE * f = fopen(TmpPath, "rb");
+   TEST_ASSERT_NOT_NULL(f);
+   TEST_ASSERT_EQUAL_INT(0, fseek(f, 0, SEEK_END));
+   FileLen = (size_t)ftell(f);
+   rewind(f);
+   FileData = malloc(FileLen + 1u);
+   TEST_ASSERT_NOT_NULL(FileData);
+   TEST_ASSERT_EQUAL_size_t(FileLen, fread(FileData, 1, FileLen, f));
+   FileData[FileLen] = '\0';
+   (void)fclose(f);
+}
+
+// The header dict, null-terminated in place of its trailing '\n'
+static const char * HeaderDict(void)
+{
+   size_t hlen = (size_t)(uint8_t)FileData[8] | ((size_t)(uint8_t)FileData[9] << 8);
+   FileData[10 + hlen - 1] = '\0';
+   return FileData + 10;
+}
+
+/* Test Cases */
+void test_NParsyNpyOpen_InvalidInputs(void)
+{
+   struct NParsyNpyWriter * w = nullptr;
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyNpyOpen(nullptr, TmpPath, NParsy_NpyU64));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyNpyOpen(&w, nullptr, NParsy_NpyU64));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDtype, NParsyNpyOpen(&w, TmpPath, NParsy_NumOfNpyDtypes));
+   TEST_ASSERT_NULL(w);
+
+   const uint64_t v = 1;
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyNpyAppendU64(nullptr, &v, 1));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyNpyClose(nullptr, nullptr));
+   TEST_ASSERT_FALSE(NParsyNpyUIntSink(&v, 1, nullptr));
+}
+
+void test_NParsyNpyOpen_UnwritablePath(void)
+{
+   struct NParsyNpyWriter * w = nullptr;
+   TEST_ASSERT_EQUAL_INT(NParsy_FileAccessFailed, NParsyNpyOpen(&w, "/nonexistent/nparsy/out.npy", NParsy_NpyU64));
+   TEST_ASSERT_NULL(w);
+}
+
+void test_NParsyNpyAppend_DtypeMismatch(void)
+{
+   struct NParsyNpyWriter * w;
+   const int64_t iv = -1;
+   const double dv = 1.5;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyOpen(&w, TmpPath, NParsy_NpyU64));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDtype, NParsyNpyAppendI64(w, &iv, 1));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDtype, NParsyNpyAppendF64(w, &dv, 1));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyNpyAppendU64(w, nullptr, 1));
+   size_t n = 99;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyClose(w, &n));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+}
+
+void test_NParsyNpy_EmptyArray(void)
+{
+   struct NParsyNpyWriter * w;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyOpen(&w, TmpPath, NParsy_NpyU64));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyAppendU64(w, nullptr, 0));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyClose(w, nullptr));
+
+   ReadBack();
+   TEST_ASSERT_EQUAL_size_t(128, FileLen);
+   TEST_ASSERT_NOT_NULL(strstr(HeaderDict(), "'shape': (0,)"));
+}
+
+void test_NParsyNpy_HeaderLayout(void)
+{
+   struct NParsyNpyWriter * w;
+   const uint64_t v = 7;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyOpen(&w, TmpPath, NParsy_NpyU64));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyAppendU64(w, &v, 1));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyClose(w, nullptr));
+
+   ReadBack();
+   // Magic, version 1.0, little-endian header length; data 64-byte aligned
+   TEST_ASSERT_EQUAL_MEMORY("\x93NUMPY\x01\x00", FileData, 8);
+   size_t hlen = (size_t)(uint8_t)FileData[8] | ((size_t)(uint8_t)FileData[9] << 8);
+   TEST_ASSERT_EQUAL_size_t(0, (10 + hlen) % 64);
+   TEST_ASSERT_EQUAL_CHAR('\n', FileData[10 + hlen - 1]);
+   TEST_ASSERT_EQUAL_size_t(10 + hlen + 8, FileLen);
+   const char dict[] = "{'descr': '<u8', 'fortran_order': False, 'shape': (1,), }";
+   TEST_ASSERT_EQUAL_MEMORY(dict, HeaderDict(), sizeof dict - 1);
+}
+
+void test_NParsyNpy_U64Values(void)
+{
+   struct NParsyNpyWriter * w;
+   const uint64_t a[] = { 0, 1, UINT64_MAX };
+   const uint64_t b[] = { 0x0123'4567'89AB'CDEFull };
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyOpen(&w, TmpPath, NParsy_NpyU64));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyAppendU64(w, a, 3));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyAppendU64(w, b, 1));
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyClose(w, &n));
+   TEST_ASSERT_EQUAL_size_t(4, n);
+
+   ReadBack();
+   TEST_ASSERT_EQUAL_size_t(128 + (4 * 8), FileLen);
+   uint64_t got[4];
+   memcpy(got, FileData + 128, sizeof got);
+   const uint64_t expected[] = { 0, 1, UINT64_MAX, 0x0123'4567'89AB'CDEFull };
+   TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, got, 4);
+   TEST_ASSERT_NOT_NULL(strstr(HeaderDict(), "'shape': (4,)"));
+}
+
+void test_NParsyNpy_I64AndF64Values(void)
+{
+   struct NParsyNpyWriter * w;
+   const int64_t iv[] = { -5, INT64_MIN, 42 };
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyOpen(&w, TmpPath, NParsy_NpyI64));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyAppendI64(w, iv, 3));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyClose(w, nullptr));
+   ReadBack();
+   int64_t igot[3];
+   memcpy(igot, FileData + 128, sizeof igot);
+   TEST_ASSERT_EQUAL_INT64_ARRAY(iv, igot, 3);
+   TEST_ASSERT_NOT_NULL(strstr(HeaderDict(), "'descr': '<i8'"));
+   free(FileData);
+
+   // Reopening truncates
+   const double dv[] = { 1.5, -0.25 };
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyOpen(&w, TmpPath, NParsy_NpyF64));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyAppendF64(w, dv, 2));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyClose(w, nullptr));
+   ReadBack();
+   TEST_ASSERT_EQUAL_size_t(128 + (2 * 8), FileLen);
+   double dgot[2];
+   memcpy(dgot, FileData + 128, sizeof dgot);
+   TEST_ASSERT_EQUAL_MEMORY(dv, dgot, sizeof dv);
+   TEST_ASSERT_NOT_NULL(strstr(HeaderDict(), "'descr': '<f8'"));
+}
+
+void test_NParsyNpy_GrowsInPlace(void)
+{
+   // Well past the initial capacity, in odd-sized appends
+   constexpr size_t COUNT = 1'000'003u;
+   uint64_t chunk[997];
+   struct NParsyNpyWriter * w;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyOpen(&w, TmpPath, NParsy_NpyU64));
+   for ( size_t i = 0; i < COUNT; )
+   {
+      size_t n = ((COUNT - i) < 997u) ? (COUNT - i) : 997u;
+      for ( size_t j = 0; j < n; j++ )
+         chunk[j] = (uint64_t)(i + j) * 3u;
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyAppendU64(w, chunk, n));
+      i += n;
+   }
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyClose(w, &n));
+   TEST_ASSERT_EQUAL_size_t(COUNT, n);
+
+   ReadBack();
+   TEST_ASSERT_EQUAL_size_t(128 + (COUNT * 8), FileLen);
+   for ( size_t i = 0; i < COUNT; i += 4'999u )
+   {
+      uint64_t v;
+      memcpy(&v, FileData + 128 + (i * 8), sizeof v);
+      TEST_ASSERT_EQUAL_UINT64((uint64_t)i * 3u, v);
+   }
+   TEST_ASSERT_NOT_NULL(strstr(HeaderDict(), "'shape': (1000003,)"));
+}
+
+void test_NParsyNpy_StreamSink(void)
+{
+   int fds[2];
+   TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+   const char str[] = "t=10 v=0x20 n=30\n";
+   TEST_ASSERT_EQUAL_INT64((int64_t)strlen(str), (int64_t)write(fds[1], str, strlen(str)));
+   (void)close(fds[1]);
+
+   struct NParsyNpyWriter * w;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyOpen(&w, TmpPath, NParsy_NpyU64));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamFd(fds[0], 0, NParsyNpyUIntSink, w, nullptr, NParsy_Dec));
+   (void)close(fds[0]);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyNpyClose(w, nullptr));
+
+   ReadBack();
+   uint64_t got[3];
+   TEST_ASSERT_EQUAL_size_t(128 + sizeof got, FileLen);
+   memcpy(got, FileData + 128, sizeof got);
+   const uint64_t expected[] = { 10, 0x20, 30 };
+   TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, got, 3);
+}
@@ -0,0 +1,382 @@
+/*!
+ * @file    test_nparsy_scan.c
+ * @brief   Test file for the compiled scan format nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <locale.h>
+
+#include "unity.h"
+#include "nparsy_scan.h"
+
+/* Local Macro Definitions */
+
+/* Local Datatypes */
+
+/* Local Variables */
+static struct NParsyScanPlan * Plan;
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// Helpers
+static void Compile(const char * fmt);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyCompileFormat_InvalidInputs(void);
+void test_NParsyCompileFormat_InvalidFormats(void);
+void test_NParsyScan_InvalidInputs(void);
+
+// - Basic Usage -
+void test_NParsyScan_MixedLine(void);
+void test_NParsyScan_Widths(void);
+void test_NParsyScan_Suppressed(void);
+void test_NParsyScan_Whitespace(void);
+void test_NParsyScan_LiteralPercent(void);
+void test_NParsyScan_Mismatch(void);
+void test_NParsyScan_UIntFormats(void);
+void test_NParsyScan_SignedLimits(void);
+void test_NParsyScan_Floats(void);
+void test_NParsyScan_LongFloats(void);
+void test_NParsyScan_FloatsIgnoreLocale(void);
+void test_NParsyScan_Str(void);
+void test_NParsyScan_ReusedPlanMatchesSscanf(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyCompileFormat_InvalidInputs);
+   RUN_TEST(test_NParsyCompileFormat_InvalidFormats);
+   RUN_TEST(test_NParsyScan_InvalidInputs);
+
+   RUN_TEST(test_NParsyScan_MixedLine);
+   RUN_TEST(test_NParsyScan_Widths);
+   RUN_TEST(test_NParsyScan_Suppressed);
+   RUN_TEST(test_NParsyScan_Whitespace);
+   RUN_TEST(test_NParsyScan_LiteralPercent);
+   RUN_TEST(test_NParsyScan_Mismatch);
+   RUN_TEST(test_NParsyScan_UIntFormats);
+   RUN_TEST(test_NParsyScan_SignedLimits);
+   RUN_TEST(test_NParsyScan_Floats);
+   RUN_TEST(test_NParsyScan_LongFloats);
+   RUN_TEST(test_NParsyScan_FloatsIgnoreLocale);
+   RUN_TEST(test_NParsyScan_Str);
+   RUN_TEST(test_NParsyScan_ReusedPlanMatchesSscanf);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   Plan = nullptr;
+}
+void tearDown(void)
+{
+   NParsyFreeFormat(Plan);
+   Plan = nullptr;
+}
+
+/* Helpers */
+static void Compile(const char * fmt)
+{
+   NParsyFreeFormat(Plan);
+   Plan = nullptr;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyCompileFormat(fmt, &Plan));
+   TEST_ASSERT_NOT_NULL(Plan);
+}
+
+/* Test Cases */
+void test_NParsyCompileFormat_InvalidInputs(void)
+{
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyCompileFormat(nullptr, &Plan));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyCompileFormat("%u", nullptr));
+   TEST_ASSERT_NULL(Plan);
+}
+
+void test_NParsyCompileFormat_InvalidFormats(void)
+{
+   const char * bad[] = { "%q", "id=%", "%s", "%*s", "%0u", "%99999999999u", "%lu", "%5" };
+   for ( size_t i = 0; i < sizeof bad / sizeof bad[0]; i++ )
+   {
+      TEST_ASSERT_EQUAL_INT_MESSAGE(NParsy_InvalidFormat, NParsyCompileFormat(bad[i], &Plan), bad[i]);
+      TEST_ASSERT_NULL(Plan);
+   }
+
+   // Nothing to convert is fine
+   Compile("");
+   size_t n = 99;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "anything", &n));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+}
+
+void test_NParsyScan_InvalidInputs(void)
+{
+   uint64_t v = 0;
+   Compile("%u");
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyScan(Plan, nullptr, nullptr, &v));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyScan(nullptr, "1", nullptr, &v));
+}
+
+void test_NParsyScan_MixedLine(void)
+{
+   uint64_t id = 0;
+   uint64_t val = 0;
+   double t = 0.0;
+   size_t n = 0;
+   Compile("id=%u val=%x t=%f");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "id=42 val=0x1F t=3.25 (ignored)", &n, &id, &val, &t));
+   TEST_ASSERT_EQUAL_size_t(3, n);
+   TEST_ASSERT_EQUAL_UINT64(42, id);
+   TEST_ASSERT_EQUAL_UINT64(0x1F, val);
+   TEST_ASSERT_EQUAL_DOUBLE(3.25, t);
+}
+
+void test_NParsyScan_Widths(void)
+{
+   uint64_t a = 0;
+   uint64_t b = 0;
+   uint64_t c = 0;
+   Compile("%2u%3x%u");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "12ab09", nullptr, &a, &b, &c));
+   TEST_ASSERT_EQUAL_UINT64(12, a);
+   TEST_ASSERT_EQUAL_UINT64(0xAB0, b);
+   TEST_ASSERT_EQUAL_UINT64(9, c);
+
+   // Leading whitespace doesn't count towards the width
+   Compile("%2u");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "   345", nullptr, &a));
+   TEST_ASSERT_EQUAL_UINT64(34, a);
+}
+
+void test_NParsyScan_Suppressed(void)
+{
+   uint64_t v = 0;
+   size_t n = 0;
+   Compile("%*u,%*f,%u");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "1,2.5,3", &n, &v));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+   TEST_ASSERT_EQUAL_UINT64(3, v);
+}
+
+void test_NParsyScan_Whitespace(void)
+{
+   uint64_t a = 0;
+   uint64_t b = 0;
+   Compile(" %u ,%u");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "\t 7 \n ,   8", nullptr, &a, &b));
+   TEST_ASSERT_EQUAL_UINT64(7, a);
+   TEST_ASSERT_EQUAL_UINT64(8, b);
+
+   // Format whitespace may match nothing at all
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "7,8", nullptr, &a, &b));
+
+   // But literal chars don't skip any
+   Compile("%u,%u");
+   TEST_ASSERT_EQUAL_INT(NParsy_FormatMismatch, NParsyScan(Plan, "7 ,8", nullptr, &a, &b));
+}
+
+void test_NParsyScan_LiteralPercent(void)
+{
+   uint64_t v = 0;
+   Compile("load %u%% done");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "load 85% done", nullptr, &v));
+   TEST_ASSERT_EQUAL_UINT64(85, v);
+   TEST_ASSERT_EQUAL_INT(NParsy_FormatMismatch, NParsyScan(Plan, "load 85 done", nullptr, &v));
+}
+
+void test_NParsyScan_Mismatch(void)
+{
+   uint64_t a = 0;
+   uint64_t b = 0;
+   size_t n = 99;
+   Compile("a=%u b=%u");
+   TEST_ASSERT_EQUAL_INT(NParsy_FormatMismatch, NParsyScan(Plan, "x=1 b=2", &n, &a, &b));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_FormatMismatch, NParsyScan(Plan, "a=1 c=2", &n, &a, &b));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+   TEST_ASSERT_EQUAL_UINT64(1, a);
+
+   // Input ending early is a mismatch too
+   TEST_ASSERT_EQUAL_INT(NParsy_FormatMismatch, NParsyScan(Plan, "a=1 b=", &n, &a, &b));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+   TEST_ASSERT_EQUAL_INT(NParsy_FormatMismatch, NParsyScan(Plan, "a=-1 b=2", &n, &a, &b));
+}
+
+void test_NParsyScan_UIntFormats(void)
+{
+   uint64_t v = 0;
+
+   Compile("%x");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "0XdeadBEEF", nullptr, &v));
+   TEST_ASSERT_EQUAL_UINT64(0xDEADBEEF, v);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "0xg", nullptr, &v)); // Just the 0
+   TEST_ASSERT_EQUAL_UINT64(0, v);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "0000ffffffffffffffff", nullptr, &v));
+   TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, v);
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyScan(Plan, "10000000000000000", nullptr, &v));
+
+   Compile("%b %o");
+   uint64_t w = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "0b101 0o17", nullptr, &v, &w));
+   TEST_ASSERT_EQUAL_UINT64(5, v);
+   TEST_ASSERT_EQUAL_UINT64(15, w);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "1102 1777777777777777777777", nullptr, &v, &w));
+   TEST_ASSERT_EQUAL_UINT64(6, v); // %b stops at the 2, which %o then takes
+   TEST_ASSERT_EQUAL_UINT64(2, w);
+
+   Compile("%o");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "1777777777777777777777", nullptr, &v));
+   TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, v);
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyScan(Plan, "2000000000000000000000", nullptr, &v));
+
+   Compile("%u");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "18446744073709551615", nullptr, &v));
+   TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, v);
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyScan(Plan, "18446744073709551616", nullptr, &v));
+}
+
+void test_NParsyScan_SignedLimits(void)
+{
+   int64_t a = 0;
+   int64_t b = 0;
+   int64_t c = 0;
+   Compile("%d %d %d");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "-9223372036854775808 +5 9223372036854775807", nullptr, &a, &b, &c));
+   TEST_ASSERT_EQUAL_INT64(INT64_MIN, a);
+   TEST_ASSERT_EQUAL_INT64(5, b);
+   TEST_ASSERT_EQUAL_INT64(INT64_MAX, c);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyScan(Plan, "9223372036854775808 1 1", nullptr, &a, &b, &c));
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyScan(Plan, "-9223372036854775809 1 1", nullptr, &a, &b, &c));
+   TEST_ASSERT_EQUAL_INT(NParsy_FormatMismatch, NParsyScan(Plan, "- 1 1 1", nullptr, &a, &b, &c));
+}
+
+void test_NParsyScan_Floats(void)
+{
+   const char * strs[] =
+   {
+      "0", "0.1", "3.14159", "-2.5", "+7.", ".5", "123456789012345", "1234567.89012345",
+      "-2.5e-3", "1E10", "1e308", "4.9e-324", "0.30000000000000004", "123456789012345678",
+      "1e", "2.5e+",
+   };
+   Compile("%f");
+   for ( size_t i = 0; i < sizeof strs / sizeof strs[0]; i++ )
+   {
+      double v = 0.0;
+      TEST_ASSERT_EQUAL_INT_MESSAGE(NParsy_GoodResult, NParsyScan(Plan, strs[i], nullptr, &v), strs[i]);
+      TEST_ASSERT_TRUE_MESSAGE(v == strtod(strs[i], nullptr), strs[i]); // Bit-exact
+   }
+
+   double v = 0.0;
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyScan(Plan, "1e400", nullptr, &v));
+   TEST_ASSERT_EQUAL_INT(NParsy_FormatMismatch, NParsyScan(Plan, ".", nullptr, &v));
+   TEST_ASSERT_EQUAL_INT(NParsy_FormatMismatch, NParsyScan(Plan, "-e5", nullptr, &v));
+
+   // The width applies to the whole field
+   Compile("%4f%f");
+   double w = 0.0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "1.2345", nullptr, &v, &w));
+   TEST_ASSERT_EQUAL_DOUBLE(1.23, v);
+   TEST_ASSERT_EQUAL_DOUBLE(45.0, w);
+}
+
+void test_NParsyScan_LongFloats(void)
+{
+   const char * strs[] =
+   {
+      "3.1415926535897932384626433827950288419716939937510582097494459230781",
+      "0.0000000000000000000000000000000000000000000000000000000000000000001e67",
+      "123456789012345678901234567890123456789012345678901234567890e-50",
+      // Past the midpoint of 2^53 and 2^53 + 2 only well after the 40th digit
+      "9007199254740993.00000000000000000000000000000000000000000000000001",
+      "-9007199254740993.0000000000000000000000000000000000000000000000000",
+      "1797693134862315708145274237317043567980705675258449965989174768031572607800e232",
+   };
+   Compile("%f");
+   for ( size_t i = 0; i < sizeof strs / sizeof strs[0]; i++ )
+   {
+      double v = 0.0;
+      TEST_ASSERT_EQUAL_INT_MESSAGE(NParsy_GoodResult, NParsyScan(Plan, strs[i], nullptr, &v), strs[i]);
+      TEST_ASSERT_TRUE_MESSAGE(v == strtod(strs[i], nullptr), strs[i]); // Bit-exact
+   }
+
+   double v = 0.0;
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange,
+                         NParsyScan(Plan, "1797693134862315708145274237317043567980705675258449965989174768031572607800e235", nullptr, &v));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "1e-99999999999999999999", nullptr, &v));
+   TEST_ASSERT_TRUE(v == 0.0);
+}
+
+void test_NParsyScan_FloatsIgnoreLocale(void)
+{
+   const char * comma_locales[] = { "de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8" };
+   const char * found = nullptr;
+   for ( size_t i = 0; (i < sizeof comma_locales / sizeof comma_locales[0]) && (found == nullptr); i++ )
+      found = setlocale(LC_NUMERIC, comma_locales[i]);
+   if ( found == nullptr )
+      TEST_IGNORE_MESSAGE("No comma-decimal locale installed");
+
+   double v = 0.0;
+   double w = 0.0;
+   Compile("%f %f");
+   enum NParsyResult res = NParsyScan(Plan, "1.5e3 3.1415926535897932384626433827950288", nullptr, &v, &w);
+   setlocale(LC_NUMERIC, "C");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_TRUE(v == 1500.0);
+   TEST_ASSERT_TRUE(w == strtod("3.1415926535897932384626433827950288", nullptr));
+}
+
+void test_NParsyScan_Str(void)
+{
+   char name[8];
+   uint64_t v = 0;
+   Compile("%7s=%u");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "counter=5", nullptr, name, &v));
+   TEST_ASSERT_EQUAL_STRING("counter", name);
+   TEST_ASSERT_EQUAL_UINT64(5, v);
+
+   Compile("%7s %u");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, "  ab 6", nullptr, name, &v));
+   TEST_ASSERT_EQUAL_STRING("ab", name);
+   TEST_ASSERT_EQUAL_UINT64(6, v);
+   TEST_ASSERT_EQUAL_INT(NParsy_FormatMismatch, NParsyScan(Plan, "   ", nullptr, name, &v));
+}
+
+void test_NParsyScan_ReusedPlanMatchesSscanf(void)
+{
+   Compile("id=%u val=%x t=%f");
+   char line[128];
+   for ( unsigned i = 0; i < 5'000u; i++ )
+   {
+      double t_in = (double)(i * 37u) / 64.0 - 1000.0;
+      (void)snprintf(line, sizeof line, "id=%u val=%x t=%.6f", i * 7919u, i * 2654435761u, t_in);
+
+      uint64_t id = 0;
+      uint64_t val = 0;
+      double t = 0.0;
+      unsigned sid = 0;
+      unsigned sval = 0;
+      double st = 0.0;
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyScan(Plan, line, nullptr, &id, &val, &t));
+      TEST_ASSERT_EQUAL_INT(3, sscanf(line, "id=%u val=%x t=%lf", &sid, &sval, &st));
+      TEST_ASSERT_EQUAL_UINT64(sid, id);
+      TEST_ASSERT_EQUAL_UINT64(sval, val);
+      TEST_ASSERT_TRUE(t == st);
+   }
+}
@@ -0,0 +1,531 @@
+/*!
+ * @file    test_nparsy_stream.c
+ * @brief   Test file for the streaming nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "unity.h"
+#include "nparsy_stream.h"
+
+/* Local Macro Definitions */
+#define MAX_COLLECTED   64
+
+/* Local Datatypes */
+struct Collector
+{
+   uint64_t vals[MAX_COLLECTED];
+   size_t n;
+   size_t calls;
+   size_t stop_after; // stop once this many values were seen (0 = never)
+   uint64_t sum;      // of everything, for streams too big to collect
+};
+
+struct PipeWriter
+{
+   int fd;
+   unsigned count;
+};
+
+/* Local Variables */
+static struct Collector Col;
+static int TmpFd = -1;
+static char TmpPath[64];
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// Helpers
+static bool Collect(const uint64_t * vals, size_t n, void * ctx);
+static void * WriteNumbers(void * arg);
+static void StreamStringInChunks(const char * str, size_t chunk_len, enum NParsyNumFormat fmt);
+static void AppendToTmp(const char * str);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyUIntStreamFd_NullSink(void);
+void test_NParsyUIntStreamFd_InvalidDefaultFmt(void);
+void test_NParsyUIntStreamFd_BadFd(void);
+
+// - Basic Usage -
+void test_NParsyUIntStreamFd_EmptyPipe(void);
+void test_NParsyUIntStreamFd_SmallPipe(void);
+void test_NParsyUIntStreamFd_StitchAtEveryChunkLen(void);
+void test_NParsyUIntStreamFd_StitchHexDefault(void);
+void test_NParsyUIntStreamFd_NegativeSplitFromSign(void);
+void test_NParsyUIntStreamFd_OverlongNumberSkipped(void);
+void test_NParsyUIntStreamFd_LargePipe(void);
+void test_NParsyUIntStreamFd_SinkStopsEarly(void);
+void test_NParsyUIntStream_InvalidInputs(void);
+void test_NParsyUIntStream_FeedCharByChar(void);
+void test_NParsyUIntStream_WholeInputBeyondStringLimit(void);
+void test_NParsyUIntStream_PieceOverStringLimit(void);
+void test_NParsyUIntStream_SinkStopsEarly(void);
+void test_NParsyUIntTail_InvalidInputs(void);
+void test_NParsyUIntTail_OnlyNewValues(void);
+void test_NParsyUIntTail_Truncated(void);
+void test_NParsyUIntTail_ResumeOffset(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyUIntStreamFd_NullSink);
+   RUN_TEST(test_NParsyUIntStreamFd_InvalidDefaultFmt);
+   RUN_TEST(test_NParsyUIntStreamFd_BadFd);
+
+   RUN_TEST(test_NParsyUIntStreamFd_EmptyPipe);
+   RUN_TEST(test_NParsyUIntStreamFd_SmallPipe);
+   RUN_TEST(test_NParsyUIntStreamFd_StitchAtEveryChunkLen);
+   RUN_TEST(test_NParsyUIntStreamFd_StitchHexDefault);
+   RUN_TEST(test_NParsyUIntStreamFd_NegativeSplitFromSign);
+   RUN_TEST(test_NParsyUIntStreamFd_OverlongNumberSkipped);
+   RUN_TEST(test_NParsyUIntStreamFd_LargePipe);
+   RUN_TEST(test_NParsyUIntStreamFd_SinkStopsEarly);
+
+   RUN_TEST(test_NParsyUIntStream_InvalidInputs);
+   RUN_TEST(test_NParsyUIntStream_FeedCharByChar);
+   RUN_TEST(test_NParsyUIntStream_WholeInputBeyondStringLimit);
+   RUN_TEST(test_NParsyUIntStream_PieceOverStringLimit);
+   RUN_TEST(test_NParsyUIntStream_SinkStopsEarly);
+
+   RUN_TEST(test_NParsyUIntTail_InvalidInputs);
+   RUN_TEST(test_NParsyUIntTail_OnlyNewValues);
+   RUN_TEST(test_NParsyUIntTail_Truncated);
+   RUN_TEST(test_NParsyUIntTail_ResumeOffset);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset(&Col, 0, sizeof Col);
+   strcpy(TmpPath, "/tmp/nparsy_stream_test_XXXXXX");
+   TmpFd = mkstemp(TmpPath);
+   TEST_ASSERT_TRUE(TmpFd >= 0);
+}
+void tearDown(void)
+{
+   if ( TmpFd >= 0 )
+   {
+      (void)close(TmpFd);
+      (void)unlink(TmpPath);
+      TmpFd = -1;
+   }
+}
+
+/* Helpers */
+static bool Collect(const uint64_t * vals, size_t n, void * ctx)
+{
+   struct Collector * col = ctx;
+   col->calls++;
+   for ( size_t i = 0; i < n; i++ )
+   {
+      if ( col->n < MAX_COLLECTED )
+         col->vals[col->n] = vals[i];
+      col->n++;
+      col->sum += vals[i];
+   }
+   return (col->stop_after == 0u) || (col->n < col->stop_after);
+}
+
+static void * WriteNumbers(void * arg)
+{
+   struct PipeWriter * w = arg;
+   FILE * f = fdopen(w->fd, "w");
+   for ( unsigned i = 1; i <= w->count; i++ )
+      fprintf(f, "%u%s", i, ((i % 3u) == 0u) ? "\n" : ", ");
+   fclose(f);
+   return nullptr;
+}
+
+// Regular files hand back exactly chunk_len bytes per read(), so every
+// boundary position gets exercised
+static void StreamStringInChunks(const char * str, size_t chunk_len, enum NParsyNumFormat fmt)
+{
+   TEST_ASSERT_EQUAL_INT(0, ftruncate(TmpFd, 0));
+   TEST_ASSERT_EQUAL_INT64((int64_t)strlen(str), (int64_t)pwrite(TmpFd, str, strlen(str), 0));
+   TEST_ASSERT_EQUAL_INT64(0, (int64_t)lseek(TmpFd, 0, SEEK_SET));
+
+   memset(&Col, 0, sizeof Col);
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamFd(TmpFd, chunk_len, Collect, &Col, &n, fmt));
+   TEST_ASSERT_EQUAL_size_t(Col.n, n);
+}
+
+static void AppendToTmp(const char * str)
+{
+   off_t end = lseek(TmpFd, 0, SEEK_END);
+   TEST_ASSERT_TRUE(end >= 0);
+   TEST_ASSERT_EQUAL_INT64((int64_t)strlen(str), (int64_t)pwrite(TmpFd, str, strlen(str), end));
+}
+
+/* Test Cases */
+void test_NParsyUIntStreamFd_NullSink(void)
+{
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntStreamFd(TmpFd, 0, nullptr, nullptr, nullptr, NParsy_Dec));
+}
+
+void test_NParsyUIntStreamFd_InvalidDefaultFmt(void)
+{
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyUIntStreamFd(TmpFd, 0, Collect, &Col, nullptr, NParsy_NumOfFmts));
+}
+
+void test_NParsyUIntStreamFd_BadFd(void)
+{
+   TEST_ASSERT_EQUAL_INT(NParsy_FileAccessFailed, NParsyUIntStreamFd(-1, 0, Collect, &Col, nullptr, NParsy_Dec));
+}
+
+void test_NParsyUIntStreamFd_EmptyPipe(void)
+{
+   int fds[2];
+   TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+   (void)close(fds[1]);
+
+   size_t n = 99;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamFd(fds[0], 0, Collect, &Col, &n, NParsy_Dec));
+   (void)close(fds[0]);
+   TEST_ASSERT_EQUAL_size_t(0, n);
+   TEST_ASSERT_EQUAL_size_t(0, Col.calls);
+}
+
+void test_NParsyUIntStreamFd_SmallPipe(void)
+{
+   int fds[2];
+   TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+   const char str[] = "rpm 0x1F40, temp 21.5, id 63d";
+   TEST_ASSERT_EQUAL_INT64((int64_t)strlen(str), (int64_t)write(fds[1], str, strlen(str)));
+   (void)close(fds[1]);
+
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamFd(fds[0], 0, Collect, &Col, &n, NParsy_Dec));
+   (void)close(fds[0]);
+   TEST_ASSERT_EQUAL_size_t(2, n);
+   TEST_ASSERT_EQUAL_UINT64(0x1F40, Col.vals[0]);
+   TEST_ASSERT_EQUAL_UINT64(63, Col.vals[1]);
+}
+
+void test_NParsyUIntStreamFd_StitchAtEveryChunkLen(void)
+{
+   const char str[] = "12345678901234567890 0x1F 0b1011 0o17 7Fh 99d x10 -5 2.5e3 0x1Fh 42 "
+                      "0000000000000000000000000000007 18446744073709551616 3";
+   const uint64_t expected[] = { 12345678901234567890u, 0x1F, 0xB, 017, 0x7F, 99, 0x10, 42, 7, 3 };
+   const size_t nexpected = sizeof expected / sizeof expected[0];
+
+   for ( size_t chunk_len = 1; chunk_len <= sizeof str; chunk_len++ )
+   {
+      StreamStringInChunks(str, chunk_len, NParsy_Dec);
+      TEST_ASSERT_EQUAL_size_t(nexpected, Col.n);
+      TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, Col.vals, nexpected);
+   }
+}
+
+void test_NParsyUIntStreamFd_StitchHexDefault(void)
+{
+   const char str[] = "deadBEEF cafe 0b11 12d 0o7 ffffffffffffffff";
+   const uint64_t expected[] = { 0xDEADBEEF, 0xCAFE, 3, 0x12D, 7, UINT64_MAX };
+   const size_t nexpected = sizeof expected / sizeof expected[0];
+
+   for ( size_t chunk_len = 1; chunk_len <= 9; chunk_len++ )
+   {
+      StreamStringInChunks(str, chunk_len, NParsy_Hex);
+      TEST_ASSERT_EQUAL_size_t(nexpected, Col.n);
+      TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, Col.vals, nexpected);
+   }
+}
+
+void test_NParsyUIntStreamFd_NegativeSplitFromSign(void)
+{
+   // The '-' ends one chunk and its digits start the next: still negative
+   StreamStringInChunks("a -12 b 34", 3, NParsy_Dec);
+   TEST_ASSERT_EQUAL_size_t(1, Col.n);
+   TEST_ASSERT_EQUAL_UINT64(34, Col.vals[0]);
+
+   // An alnum char right before a '-' in the previous chunk: not a sign
+   StreamStringInChunks("ab-12", 3, NParsy_Dec);
+   TEST_ASSERT_EQUAL_size_t(1, Col.n);
+   TEST_ASSERT_EQUAL_UINT64(12, Col.vals[0]);
+}
+
+void test_NParsyUIntStreamFd_OverlongNumberSkipped(void)
+{
+   static char str[2 * NPARSY_STREAM_CARRY_LEN + 32];
+   memset(str, '0', sizeof str);
+   str[0] = '5';
+   str[1] = ' ';
+   memcpy(str + sizeof str - 6, "1 77", 5); // trailing "01 77" and a null
+
+   for ( size_t chunk_len = 7; chunk_len <= 300; chunk_len += 41 )
+   {
+      StreamStringInChunks(str, chunk_len, NParsy_Dec);
+      TEST_ASSERT_EQUAL_size_t(2, Col.n);
+      TEST_ASSERT_EQUAL_UINT64(5, Col.vals[0]);
+      TEST_ASSERT_EQUAL_UINT64(77, Col.vals[1]);
+   }
+}
+
+void test_NParsyUIntStreamFd_LargePipe(void)
+{
+   int fds[2];
+   TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+   struct PipeWriter w = { .fd = fds[1], .count = 500'000u };
+   pthread_t writer;
+   TEST_ASSERT_EQUAL_INT(0, pthread_create(&writer, nullptr, WriteNumbers, &w));
+
+   size_t n = 0;
+   enum NParsyResult res = NParsyUIntStreamFd(fds[0], 4096, Collect, &Col, &n, NParsy_Dec);
+   (void)pthread_join(writer, nullptr);
+   (void)close(fds[0]);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, res);
+   TEST_ASSERT_EQUAL_size_t(500'000u, n);
+   TEST_ASSERT_EQUAL_UINT64((uint64_t)500'000u * 500'001u / 2u, Col.sum);
+}
+
+void test_NParsyUIntStreamFd_SinkStopsEarly(void)
+{
+   // The write end stays open, so the reader would block forever
+   int fds[2];
+   TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+   const char str[] = "1 2 3 ";
+   TEST_ASSERT_EQUAL_INT64((int64_t)strlen(str), (int64_t)write(fds[1], str, strlen(str)));
+
+   Col.stop_after = 1;
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamFd(fds[0], 0, Collect, &Col, &n, NParsy_Dec));
+   (void)close(fds[0]);
+   (void)close(fds[1]);
+
+   TEST_ASSERT_EQUAL_size_t(1, Col.calls);
+   TEST_ASSERT_EQUAL_UINT64(1, Col.vals[0]);
+}
+
+void test_NParsyUIntStream_InvalidInputs(void)
+{
+   struct NParsyUIntStream * stream = nullptr;
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntStreamBegin(nullptr, Collect, &Col, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntStreamBegin(&stream, nullptr, &Col, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyUIntStreamBegin(&stream, Collect, &Col, NParsy_NumOfFmts));
+   TEST_ASSERT_NULL(stream);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntStreamFeed(nullptr, "1", 1));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntStreamFeedStr(nullptr, "1"));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntStreamEnd(nullptr, nullptr));
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamBegin(&stream, Collect, &Col, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyUIntStreamFeed(stream, nullptr, 1));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamFeed(stream, nullptr, 0));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyUIntStreamFeedStr(stream, nullptr));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamEnd(stream, nullptr));
+}
+
+void test_NParsyUIntStream_FeedCharByChar(void)
+{
+   const char str[] = "id 12, 0x1F, 0b1010 and -3 but 007 then 42";
+   struct NParsyUIntStream * stream;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamBegin(&stream, Collect, &Col, NParsy_Dec));
+   for ( size_t i = 0; i < sizeof str - 1; i++ )
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamFeed(stream, &str[i], 1));
+
+   // The last number is only known to be complete at the end
+   TEST_ASSERT_EQUAL_size_t(4, Col.n);
+
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamEnd(stream, &n));
+   TEST_ASSERT_EQUAL_size_t(5, n);
+   const uint64_t expected[] = { 12, 0x1F, 0b1010, 7, 42 };
+   TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, Col.vals, 5);
+}
+
+void test_NParsyUIntStream_WholeInputBeyondStringLimit(void)
+{
+   // 1..400'000 comes to ~2.7M chars, fed in string pieces that each stay
+   // under the limit and cut numbers anywhere
+   constexpr unsigned COUNT = 400'000u;
+   constexpr size_t PIECE_LEN = 99'991u;
+   size_t cap = (size_t)COUNT * 8u;
+   char * text = malloc(cap);
+   TEST_ASSERT_NOT_NULL(text);
+   size_t len = 0;
+   for ( unsigned i = 1; i <= COUNT; i++ )
+      len += (size_t)snprintf(text + len, cap - len, "%u ", i);
+   TEST_ASSERT_TRUE(len > NPARSY_MAX_PARSABLE_STRING_LEN);
+
+   char * piece = malloc(PIECE_LEN + 1u);
+   TEST_ASSERT_NOT_NULL(piece);
+   struct NParsyUIntStream * stream;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamBegin(&stream, Collect, &Col, NParsy_Dec));
+   for ( size_t off = 0; off < len; off += PIECE_LEN )
+   {
+      size_t plen = ((len - off) < PIECE_LEN) ? (len - off) : PIECE_LEN;
+      memcpy(piece, text + off, plen);
+      piece[plen] = '\0';
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamFeedStr(stream, piece));
+   }
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamEnd(stream, &n));
+   free(piece);
+   free(text);
+
+   TEST_ASSERT_EQUAL_size_t(COUNT, n);
+   TEST_ASSERT_EQUAL_UINT64((uint64_t)COUNT * (COUNT + 1u) / 2u, Col.sum);
+}
+
+void test_NParsyUIntStream_PieceOverStringLimit(void)
+{
+   // The limit still applies to any one null-terminated piece...
+   char * big = malloc(NPARSY_MAX_PARSABLE_STRING_LEN + 1u);
+   TEST_ASSERT_NOT_NULL(big);
+   memset(big, ' ', NPARSY_MAX_PARSABLE_STRING_LEN);
+   big[0] = '7';
+   big[NPARSY_MAX_PARSABLE_STRING_LEN] = '\0';
+
+   struct NParsyUIntStream * stream;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamBegin(&stream, Collect, &Col, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyUIntStreamFeedStr(stream, big));
+
+   // ...but not to one of caller-declared length
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamFeed(stream, big, NPARSY_MAX_PARSABLE_STRING_LEN));
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamEnd(stream, &n));
+   free(big);
+
+   TEST_ASSERT_EQUAL_size_t(1, n);
+   TEST_ASSERT_EQUAL_UINT64(7, Col.vals[0]);
+}
+
+void test_NParsyUIntStream_SinkStopsEarly(void)
+{
+   struct NParsyUIntStream * stream;
+   Col.stop_after = 2;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamBegin(&stream, Collect, &Col, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamFeedStr(stream, "1 2 3 4 "));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamFeedStr(stream, "5 6 7"));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntStreamEnd(stream, nullptr));
+
+   TEST_ASSERT_EQUAL_size_t(1, Col.calls);
+}
+
+void test_NParsyUIntTail_InvalidInputs(void)
+{
+   struct NParsyUIntTail * tail = nullptr;
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntTailBegin(nullptr, TmpFd, 0, Collect, &Col, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntTailBegin(&tail, TmpFd, 0, nullptr, &Col, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyUIntTailBegin(&tail, TmpFd, 0, Collect, &Col, NParsy_NumOfFmts));
+   TEST_ASSERT_EQUAL_INT(NParsy_FileAccessFailed, NParsyUIntTailBegin(&tail, -1, 0, Collect, &Col, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_FileAccessFailed, NParsyUIntTailBegin(&tail, TmpFd, -1, Collect, &Col, NParsy_Dec));
+   // Nothing at start - 1 to read
+   TEST_ASSERT_EQUAL_INT(NParsy_FileAccessFailed, NParsyUIntTailBegin(&tail, TmpFd, 10, Collect, &Col, NParsy_Dec));
+   TEST_ASSERT_NULL(tail);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntTailPoll(nullptr, nullptr, nullptr));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyUIntTailEnd(nullptr, nullptr));
+}
+
+void test_NParsyUIntTail_OnlyNewValues(void)
+{
+   struct NParsyUIntTail * tail;
+   size_t n = 99;
+   off_t resume = -1;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailBegin(&tail, TmpFd, 0, Collect, &Col, NParsy_Dec));
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailPoll(tail, &n, &resume));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+   TEST_ASSERT_EQUAL_INT64(0, (int64_t)resume);
+
+   // The last number may still be being written, so it's held back...
+   AppendToTmp("t=1 v=0x2");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailPoll(tail, &n, &resume));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+   TEST_ASSERT_EQUAL_INT64(6, (int64_t)resume);
+
+   // ...and finished off by what comes next
+   AppendToTmp("A\nt=2 v=3\n");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailPoll(tail, &n, &resume));
+   TEST_ASSERT_EQUAL_size_t(3, n);
+   TEST_ASSERT_EQUAL_INT64(19, (int64_t)resume);
+
+   // Nothing new
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailPoll(tail, &n, nullptr));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+
+   AppendToTmp("t=3 v=44");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailPoll(tail, &n, nullptr));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailEnd(tail, &n));
+   TEST_ASSERT_EQUAL_size_t(6, n);
+   const uint64_t expected[] = { 1, 0x2A, 2, 3, 3, 44 };
+   TEST_ASSERT_EQUAL_size_t(6, Col.n);
+   TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, Col.vals, 6);
+}
+
+void test_NParsyUIntTail_Truncated(void)
+{
+   struct NParsyUIntTail * tail;
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailBegin(&tail, TmpFd, 0, Collect, &Col, NParsy_Dec));
+
+   AppendToTmp("100 200 30");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailPoll(tail, &n, nullptr));
+   TEST_ASSERT_EQUAL_size_t(2, n);
+
+   // Rotated in place: the held-back 30 belonged to the old contents
+   TEST_ASSERT_EQUAL_INT(0, ftruncate(TmpFd, 0));
+   AppendToTmp("5 6");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailPoll(tail, &n, nullptr));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailEnd(tail, &n));
+   TEST_ASSERT_EQUAL_size_t(4, n);
+   const uint64_t expected[] = { 100, 200, 5, 6 };
+   TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, Col.vals, 4);
+}
+
+void test_NParsyUIntTail_ResumeOffset(void)
+{
+   struct NParsyUIntTail * tail;
+   off_t resume = 0;
+   AppendToTmp("7 12 8");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailBegin(&tail, TmpFd, 0, Collect, &Col, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailPoll(tail, nullptr, &resume));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailEnd(tail, nullptr));
+   TEST_ASSERT_EQUAL_INT64(5, (int64_t)resume);
+
+   // A later tail picks up the held-back 8 and carries on
+   memset(&Col, 0, sizeof Col);
+   AppendToTmp("9 10");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailBegin(&tail, TmpFd, resume, Collect, &Col, NParsy_Dec));
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailPoll(tail, &n, nullptr));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailEnd(tail, &n));
+   TEST_ASSERT_EQUAL_size_t(2, n);
+   TEST_ASSERT_EQUAL_UINT64(89, Col.vals[0]);
+   TEST_ASSERT_EQUAL_UINT64(10, Col.vals[1]);
+
+   // Starting mid-word: with hex as the default, the b of "ab" isn't a number
+   memset(&Col, 0, sizeof Col);
+   TEST_ASSERT_EQUAL_INT(0, ftruncate(TmpFd, 0));
+   AppendToTmp("zz ab c");
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailBegin(&tail, TmpFd, 4, Collect, &Col, NParsy_Hex));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailPoll(tail, nullptr, nullptr));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntTailEnd(tail, &n));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+   TEST_ASSERT_EQUAL_UINT64(0xC, Col.vals[0]);
+}
@@ -0,0 +1,301 @@
+/*!
+ * @file    test_nparsy_u128.c
+ * @brief   Test file for the 128-bit unsigned integer nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "unity.h"
+#include "nparsy_u128.h"
+
+/* Local Macro Definitions */
+#define U128(hi, lo)    ( ((nparsy_u128_t)(hi) << 64) | (uint64_t)(lo) )
+
+#define TEST_ASSERT_EQUAL_U128(expected, actual)                                    \
+   do {                                                                             \
+      TEST_ASSERT_EQUAL_HEX64( (uint64_t)((expected) >> 64), (uint64_t)((actual) >> 64) ); \
+      TEST_ASSERT_EQUAL_HEX64( (uint64_t)(expected), (uint64_t)(actual) );          \
+   } while (0)
+
+/* Local Datatypes */
+
+/* Local Variables */
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyU128_NullStr(void);
+void test_NParsyU128_NullBuf(void);
+void test_NParsyU128_InvalidDefaultFmt(void);
+void test_NParsyU128_NoNumber(void);
+
+// - Basic Usage -
+void test_NParsyU128_NumStr_Zero(void);
+void test_NParsyU128_NumStr_Dec_64bit(void);
+void test_NParsyU128_NumStr_Dec_128bit(void);
+void test_NParsyU128_NumStr_Dec_Max(void);
+void test_NParsyU128_NumStr_Dec_EveryLength(void);
+void test_NParsyU128_NumStr_Hex_128bit(void);
+void test_NParsyU128_NumStr_Bin_128bit(void);
+void test_NParsyU128_NumStr_Oct_128bit(void);
+void test_NParsyU128_SentenceStr_UUIDKey(void);
+
+// - Limits -
+void test_NParsyU128_OutOfRange(void);
+void test_NParsyU128_AccumulatedStrlen(void);
+
+// -- List Parsing --
+void test_NParsyU128List_MixedFormats(void);
+void test_NParsyU128List_SkipsOutOfRange(void);
+void test_NParsyU128List_BufLimit(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyU128_NullStr);
+   RUN_TEST(test_NParsyU128_NullBuf);
+   RUN_TEST(test_NParsyU128_InvalidDefaultFmt);
+   RUN_TEST(test_NParsyU128_NoNumber);
+
+   RUN_TEST(test_NParsyU128_NumStr_Zero);
+   RUN_TEST(test_NParsyU128_NumStr_Dec_64bit);
+   RUN_TEST(test_NParsyU128_NumStr_Dec_128bit);
+   RUN_TEST(test_NParsyU128_NumStr_Dec_Max);
+   RUN_TEST(test_NParsyU128_NumStr_Dec_EveryLength);
+   RUN_TEST(test_NParsyU128_NumStr_Hex_128bit);
+   RUN_TEST(test_NParsyU128_NumStr_Bin_128bit);
+   RUN_TEST(test_NParsyU128_NumStr_Oct_128bit);
+   RUN_TEST(test_NParsyU128_SentenceStr_UUIDKey);
+
+   RUN_TEST(test_NParsyU128_OutOfRange);
+   RUN_TEST(test_NParsyU128_AccumulatedStrlen);
+
+   RUN_TEST(test_NParsyU128List_MixedFormats);
+   RUN_TEST(test_NParsyU128List_SkipsOutOfRange);
+   RUN_TEST(test_NParsyU128List_BufLimit);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   // Do nothing
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/* Test Cases */
+void test_NParsyU128_NullStr(void)
+{
+   nparsy_u128_t val;
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyU128(nullptr, &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyU128List(nullptr, &val, 1, nullptr, NParsy_Dec));
+}
+
+void test_NParsyU128_NullBuf(void)
+{
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU128("5", nullptr, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU128List("5", nullptr, 1, nullptr, NParsy_Dec));
+}
+
+void test_NParsyU128_InvalidDefaultFmt(void)
+{
+   nparsy_u128_t val;
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyU128("5", &val, nullptr, NParsy_NumOfFmts));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyU128List("5", &val, 1, nullptr, NParsy_NumOfFmts));
+}
+
+void test_NParsyU128_NoNumber(void)
+{
+   nparsy_u128_t val = 7;
+   TEST_ASSERT_EQUAL_INT(NParsy_NoNumberFound, NParsyU128("Hi, there are no numbers here.", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_U128((nparsy_u128_t)7, val);
+}
+
+void test_NParsyU128_NumStr_Zero(void)
+{
+   const char * strs[] = { "0", "0000000000000000000000000000000000000000000", "0x0", "0b0", "0o0", "0h" };
+   for ( size_t i = 0; i < (sizeof strs / sizeof strs[0]); i++ )
+   {
+      nparsy_u128_t val = 7;
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128(strs[i], &val, nullptr, NParsy_Dec));
+      TEST_ASSERT_EQUAL_U128((nparsy_u128_t)0, val);
+   }
+}
+
+void test_NParsyU128_NumStr_Dec_64bit(void)
+{
+   nparsy_u128_t val;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128("18446744073709551615", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_U128(U128(0, UINT64_MAX), val);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128("18446744073709551616", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_U128(U128(1, 0), val);
+}
+
+void test_NParsyU128_NumStr_Dec_128bit(void)
+{
+   nparsy_u128_t val;
+   // 2^100
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128("1267650600228229401496703205376", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_U128(U128(1ull << 36, 0), val);
+
+   // Decimal suffix
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128("1267650600228229401496703205376d", &val, nullptr, NParsy_Bin));
+   TEST_ASSERT_EQUAL_U128(U128(1ull << 36, 0), val);
+}
+
+void test_NParsyU128_NumStr_Dec_Max(void)
+{
+   nparsy_u128_t val;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128("340282366920938463463374607431768211455", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_U128(U128(UINT64_MAX, UINT64_MAX), val);
+}
+
+void test_NParsyU128_NumStr_Dec_EveryLength(void)
+{
+   // 1, 12, 123, ... up to 39 digits, checked against a plain multiply-add
+   char str[40];
+   nparsy_u128_t expected = 0;
+   for ( size_t n = 1; n <= 39; n++ )
+   {
+      char digit = (char)('0' + ((n % 9u) + 1u));
+      str[n - 1] = digit;
+      str[n] = '\0';
+      expected = (expected * 10u) + (unsigned)(digit - '0');
+
+      nparsy_u128_t val = 0;
+      TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128(str, &val, nullptr, NParsy_Dec));
+      TEST_ASSERT_EQUAL_U128(expected, val);
+   }
+}
+
+void test_NParsyU128_NumStr_Hex_128bit(void)
+{
+   nparsy_u128_t val;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128("0x0123456789ABCDEFfedcba9876543210", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_U128(U128(0x0123456789ABCDEFu, 0xFEDCBA9876543210u), val);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF", &val, nullptr, NParsy_Hex));
+   TEST_ASSERT_EQUAL_U128(U128(UINT64_MAX, UINT64_MAX), val);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128("1ABCDEF0123456789h", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_U128(U128(0x1u, 0xABCDEF0123456789u), val);
+}
+
+void test_NParsyU128_NumStr_Bin_128bit(void)
+{
+   // 0b1 followed by 100 zeros = 2^100
+   char str[2 + 1 + 100 + 1] = "0b1";
+   memset(str + 3, '0', 100);
+   str[103] = '\0';
+
+   nparsy_u128_t val;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128(str, &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_U128(U128(1ull << 36, 0), val);
+}
+
+void test_NParsyU128_NumStr_Oct_128bit(void)
+{
+   // 3 followed by 42 sevens = 2^128 - 1
+   char str[2 + 43 + 1] = "0o3";
+   memset(str + 3, '7', 42);
+   str[45] = '\0';
+
+   nparsy_u128_t val;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128(str, &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_U128(U128(UINT64_MAX, UINT64_MAX), val);
+
+   // 0o1 followed by 22 zeros = 2^66
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128("10000000000000000000000", &val, nullptr, NParsy_Oct));
+   TEST_ASSERT_EQUAL_U128(U128(4, 0), val);
+}
+
+void test_NParsyU128_SentenceStr_UUIDKey(void)
+{
+   nparsy_u128_t val;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult,
+                         NParsyU128("key=0x550e8400e29b41d4a716446655440000 (session)", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_U128(U128(0x550e8400e29b41d4u, 0xa716446655440000u), val);
+}
+
+void test_NParsyU128_OutOfRange(void)
+{
+   nparsy_u128_t val = 7;
+   size_t acc = 0;
+   const char str[] = "340282366920938463463374607431768211456 next";
+
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU128(str, &val, &acc, NParsy_Dec));
+   TEST_ASSERT_EQUAL_U128((nparsy_u128_t)7, val);
+   TEST_ASSERT_EQUAL_size_t(39, acc);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU128("0x1FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU128("999999999999999999999999999999999999999", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU128("0o4000000000000000000000000000000000000000000", &val, nullptr, NParsy_Dec));
+}
+
+void test_NParsyU128_AccumulatedStrlen(void)
+{
+   const char str[] = "a 100000000000000000000000, b 0x1F";
+   nparsy_u128_t val;
+   size_t acc = 0;
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128(str, &val, &acc, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(strlen("a 100000000000000000000000"), acc);
+
+   size_t acc2 = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128(str + acc, &val, &acc2, NParsy_Dec));
+   TEST_ASSERT_EQUAL_U128((nparsy_u128_t)0x1F, val);
+   TEST_ASSERT_EQUAL_size_t(strlen(str), acc + acc2);
+}
+
+void test_NParsyU128List_MixedFormats(void)
+{
+   nparsy_u128_t buf[8];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult,
+         NParsyU128List("1, 0x10, 0b11, 0o17, 18446744073709551616, -5, 2.5", buf, 8, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(5, n);
+   TEST_ASSERT_EQUAL_U128((nparsy_u128_t)1, buf[0]);
+   TEST_ASSERT_EQUAL_U128((nparsy_u128_t)16, buf[1]);
+   TEST_ASSERT_EQUAL_U128((nparsy_u128_t)3, buf[2]);
+   TEST_ASSERT_EQUAL_U128((nparsy_u128_t)15, buf[3]);
+   TEST_ASSERT_EQUAL_U128(U128(1, 0), buf[4]);
+}
+
+void test_NParsyU128List_SkipsOutOfRange(void)
+{
+   nparsy_u128_t buf[4];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult,
+         NParsyU128List("1 999999999999999999999999999999999999999 2", buf, 4, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(2, n);
+   TEST_ASSERT_EQUAL_U128((nparsy_u128_t)1, buf[0]);
+   TEST_ASSERT_EQUAL_U128((nparsy_u128_t)2, buf[1]);
+}
+
+void test_NParsyU128List_BufLimit(void)
+{
+   nparsy_u128_t buf[2];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU128List("1 2 3 4", buf, 2, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(2, n);
+   TEST_ASSERT_EQUAL_U128((nparsy_u128_t)2, buf[1]);
+}
@@ -0,0 +1,254 @@
+/*!
+ * @file    test_nparsy_uint_adaptive.c
+ * @brief   Test file for the adaptive (format-sampling) unsigned integer list nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "unity.h"
+#include "nparsy_uint.h"
+
+/* Local Macro Definitions */
+#define MAX_VALS      4096
+#define MAX_STR_LEN   (MAX_VALS * 32)
+
+/* Local Datatypes */
+enum Style
+{
+   Style_BareDec,
+   Style_PrefixedHex,
+   Style_BareHex,
+   Style_Mixed
+};
+
+/* Local Variables */
+static char Str[MAX_STR_LEN];
+static uint64_t Expected[MAX_VALS];
+static uint64_t Actual[MAX_VALS];
+static uint64_t Rng = 0x9E3779B97F4A7C15u;
+
+// Things the specialized kernels must hand back to the general path
+static const char * const Outliers[] =
+{
+   "0x1Fh", "12d", "34D", "-5", "3.14", "1e5", "2E-3", ".5", "-.5", "ffh", "0AH",
+   "7fx", "0b101", "0o17", "0B1", "x1F", "X2a", "12ab", "ab12", "g12", "0x", "0xg",
+   "99999999999999999999999", "0x123456789abcdef01", "000000000000000000000000042",
+   "18446744073709551615", "18446744073709551616", "1.", "1..2", "5-", "--7", "deadbeef",
+};
+
+static const char * const Separators[] = { " ", ", ", "\n", "\t", ";", " | ", "=", "(" };
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyU64ListAdaptive_InvalidInputs(void);
+
+// - Basic Usage -
+void test_NParsyU64ListAdaptive_ShortInput(void);
+void test_NParsyU64ListAdaptive_BufFull(void);
+void test_NParsyU64ListAdaptive_DominantBareDec(void);
+void test_NParsyU64ListAdaptive_DominantPrefixedHex(void);
+void test_NParsyU64ListAdaptive_DominantBareHex(void);
+void test_NParsyU64ListAdaptive_Mixed(void);
+void test_NParsyU64ListAdaptive_ShiftsFormatAfterSample(void);
+
+static void FillStr(enum Style style, size_t nvals, unsigned outlier_pct);
+static void CheckMatchesList(enum NParsyNumFormat fmt, size_t len);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyU64ListAdaptive_InvalidInputs);
+
+   RUN_TEST(test_NParsyU64ListAdaptive_ShortInput);
+   RUN_TEST(test_NParsyU64ListAdaptive_BufFull);
+   RUN_TEST(test_NParsyU64ListAdaptive_DominantBareDec);
+   RUN_TEST(test_NParsyU64ListAdaptive_DominantPrefixedHex);
+   RUN_TEST(test_NParsyU64ListAdaptive_DominantBareHex);
+   RUN_TEST(test_NParsyU64ListAdaptive_Mixed);
+   RUN_TEST(test_NParsyU64ListAdaptive_ShiftsFormatAfterSample);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset(Expected, 0xA5, sizeof Expected);
+   memset(Actual, 0xA5, sizeof Actual);
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/******************************************************************************/
+/* Test Cases */
+
+void test_NParsyU64ListAdaptive_InvalidInputs(void)
+{
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyU64ListAdaptive(nullptr, Actual, 1, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyU64ListAdaptive("1 2", nullptr, 1, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDefaultFormat, NParsyU64ListAdaptive("1 2", Actual, 1, &n, NParsy_NumOfFmts) );
+}
+
+void test_NParsyU64ListAdaptive_ShortInput(void)
+{
+   // Fewer values than the sample: never leaves the general path
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult,
+                          NParsyU64ListAdaptive("a=1, b=0x2, c=-3, d=4.5, e=6", Actual, MAX_VALS, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( 3, n );
+   TEST_ASSERT_EQUAL_UINT64( 1, Actual[0] );
+   TEST_ASSERT_EQUAL_UINT64( 2, Actual[1] );
+   TEST_ASSERT_EQUAL_UINT64( 6, Actual[2] );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListAdaptive("", Actual, MAX_VALS, &n, NParsy_Hex) );
+   TEST_ASSERT_EQUAL_size_t( 0, n );
+}
+
+void test_NParsyU64ListAdaptive_BufFull(void)
+{
+   FillStr(Style_BareDec, 500, 5);
+   CheckMatchesList(NParsy_Dec, 0);
+   CheckMatchesList(NParsy_Dec, NPARSY_ADAPTIVE_SAMPLE_LEN - 1u);
+   CheckMatchesList(NParsy_Dec, NPARSY_ADAPTIVE_SAMPLE_LEN);
+   CheckMatchesList(NParsy_Dec, NPARSY_ADAPTIVE_SAMPLE_LEN + 1u);
+   CheckMatchesList(NParsy_Dec, 123);
+}
+
+void test_NParsyU64ListAdaptive_DominantBareDec(void)
+{
+   for ( unsigned pct = 0; pct <= 20; pct += 5 )
+   {
+      FillStr(Style_BareDec, 2000, pct);
+      for ( int fmt = 0; fmt < (int)NParsy_NumOfFmts; fmt++ )
+         CheckMatchesList((enum NParsyNumFormat)fmt, MAX_VALS);
+   }
+}
+
+void test_NParsyU64ListAdaptive_DominantPrefixedHex(void)
+{
+   for ( unsigned pct = 0; pct <= 20; pct += 5 )
+   {
+      FillStr(Style_PrefixedHex, 2000, pct);
+      for ( int fmt = 0; fmt < (int)NParsy_NumOfFmts; fmt++ )
+         CheckMatchesList((enum NParsyNumFormat)fmt, MAX_VALS);
+   }
+}
+
+void test_NParsyU64ListAdaptive_DominantBareHex(void)
+{
+   for ( unsigned pct = 0; pct <= 20; pct += 5 )
+   {
+      FillStr(Style_BareHex, 2000, pct);
+      for ( int fmt = 0; fmt < (int)NParsy_NumOfFmts; fmt++ )
+         CheckMatchesList((enum NParsyNumFormat)fmt, MAX_VALS);
+   }
+}
+
+void test_NParsyU64ListAdaptive_Mixed(void)
+{
+   FillStr(Style_Mixed, 2000, 30);
+   for ( int fmt = 0; fmt < (int)NParsy_NumOfFmts; fmt++ )
+      CheckMatchesList((enum NParsyNumFormat)fmt, MAX_VALS);
+}
+
+void test_NParsyU64ListAdaptive_ShiftsFormatAfterSample(void)
+{
+   // Sampled as bare dec, then the rest of the file is all hex
+   size_t off = 0;
+   for ( size_t i = 0; i < NPARSY_ADAPTIVE_SAMPLE_LEN; i++ )
+      off += (size_t)snprintf(Str + off, MAX_STR_LEN - off, "%zu ", i * 7u);
+   for ( size_t i = 0; i < 1000; i++ )
+      off += (size_t)snprintf(Str + off, MAX_STR_LEN - off, "0x%zX %zxh ", i * 13u, i);
+
+   CheckMatchesList(NParsy_Dec, MAX_VALS);
+   CheckMatchesList(NParsy_Hex, MAX_VALS);
+}
+
+/******************************************************************************/
+/* Helpers */
+
+static uint64_t Rand(void)
+{
+   // xorshift64
+   Rng ^= Rng << 13;
+   Rng ^= Rng >> 7;
+   Rng ^= Rng << 17;
+   return Rng;
+}
+
+static uint64_t RandVal(void)
+{
+   // Mostly small numbers, with the odd full-width one
+   switch ( Rand() % 4u )
+   {
+      case 0:  return Rand() % 10u;
+      case 1:  return Rand() % 1000u;
+      case 2:  return Rand() % 1000000u;
+      default: return Rand();
+   }
+}
+
+static void FillStr(enum Style style, size_t nvals, unsigned outlier_pct)
+{
+   size_t off = 0;
+   for ( size_t i = 0; i < nvals; i++ )
+   {
+      const char * sep = Separators[Rand() % (sizeof Separators / sizeof Separators[0])];
+      enum Style s = (style == Style_Mixed) ? (enum Style)(Rand() % 3u) : style;
+      uint64_t v = RandVal();
+      int n;
+
+      if ( (Rand() % 100u) < outlier_pct )
+         n = snprintf(Str + off, MAX_STR_LEN - off, "%s%s",
+                      Outliers[Rand() % (sizeof Outliers / sizeof Outliers[0])], sep);
+      else if ( s == Style_BareDec )
+         n = snprintf(Str + off, MAX_STR_LEN - off, "%llu%s", (unsigned long long)v, sep);
+      else if ( s == Style_PrefixedHex )
+         n = snprintf(Str + off, MAX_STR_LEN - off, (v & 1u) ? "0x%llX%s" : "0X%llx%s", (unsigned long long)v, sep);
+      else
+         n = snprintf(Str + off, MAX_STR_LEN - off, "%llx%s", (unsigned long long)v, sep);
+
+      TEST_ASSERT_TRUE( (n > 0) && ((size_t)n < (MAX_STR_LEN - off)) );
+      off += (size_t)n;
+   }
+}
+
+static void CheckMatchesList(enum NParsyNumFormat fmt, size_t len)
+{
+   size_t nexp = 0;
+   size_t nact = 0;
+   char msg[64];
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64List(Str, Expected, len, &nexp, fmt) );
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListAdaptive(Str, Actual, len, &nact, fmt) );
+
+   (void)snprintf(msg, sizeof msg, "fmt %d, len %zu", (int)fmt, len);
+   TEST_ASSERT_EQUAL_INT_MESSAGE( (int)nexp, (int)nact, msg );
+   for ( size_t i = 0; i < nexp; i++ )
+   {
+      if ( Expected[i] != Actual[i] )
+      {
+         (void)snprintf(msg, sizeof msg, "fmt %d, value %zu", (int)fmt, i);
+         TEST_FAIL_MESSAGE(msg);
+      }
+   }
+}
@@ -0,0 +1,280 @@
+/*!
+ * @file    test_nparsy_uint_grouped.c
+ * @brief   Test file for parsing decimal numbers with thousands separators
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "unity.h"
+#include "nparsy_uint.h"
+
+/* Local Macro Definitions */
+#define MAX_VALS      1024
+#define MAX_STR_LEN   (MAX_VALS * 40)
+#define THIN_SPACE    "\xE2\x80\x89"
+
+/* Local Datatypes */
+
+/* Local Variables */
+static char Str[MAX_STR_LEN];
+static uint64_t Expected[MAX_VALS];
+static uint64_t Actual[MAX_VALS];
+static uint64_t Rng = 0xA0761D6478BD642Fu;
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyUIntGrouped_InvalidInputs(void);
+void test_NParsyU64ListGrouped_InvalidInputs(void);
+
+// - Basic Usage -
+void test_NParsyUIntGrouped_EverySeparator(void);
+void test_NParsyU64ListGrouped_Report(void);
+void test_NParsyU64ListGrouped_GroupsOfThreeOnly(void);
+void test_NParsyU64ListGrouped_FloatsAndMalformed(void);
+void test_NParsyU64ListGrouped_Limits(void);
+void test_NParsyU64ListGrouped_NoGroupingMatchesList(void);
+void test_NParsyU64ListGrouped_RandomlyGrouped(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyUIntGrouped_InvalidInputs);
+   RUN_TEST(test_NParsyU64ListGrouped_InvalidInputs);
+
+   RUN_TEST(test_NParsyUIntGrouped_EverySeparator);
+   RUN_TEST(test_NParsyU64ListGrouped_Report);
+   RUN_TEST(test_NParsyU64ListGrouped_GroupsOfThreeOnly);
+   RUN_TEST(test_NParsyU64ListGrouped_FloatsAndMalformed);
+   RUN_TEST(test_NParsyU64ListGrouped_Limits);
+   RUN_TEST(test_NParsyU64ListGrouped_NoGroupingMatchesList);
+   RUN_TEST(test_NParsyU64ListGrouped_RandomlyGrouped);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset(Expected, 0xA5, sizeof Expected);
+   memset(Actual, 0xA5, sizeof Actual);
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/******************************************************************************/
+/* Test Cases */
+
+void test_NParsyUIntGrouped_InvalidInputs(void)
+{
+   uint64_t val = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyUIntGrouped(nullptr, &val, nullptr, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyUIntGrouped("1,000", nullptr, nullptr, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidGroupSeparator, NParsyUIntGrouped("1,000", &val, nullptr, NParsy_NumOfGroupSeps) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidGroupSeparator, NParsyUIntGrouped("1,000", &val, nullptr, (enum NParsyGroupSep)-1) );
+}
+
+void test_NParsyU64ListGrouped_InvalidInputs(void)
+{
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyU64ListGrouped(nullptr, Actual, 1, &n, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyU64ListGrouped("1,000", nullptr, 1, &n, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidGroupSeparator, NParsyU64ListGrouped("1,000", Actual, 1, &n, NParsy_NumOfGroupSeps) );
+}
+
+void test_NParsyUIntGrouped_EverySeparator(void)
+{
+   static const struct
+   {
+      const char * str;
+      enum NParsyGroupSep group;
+      size_t consumed;
+   } cases[] =
+   {
+      { "total: 1,234,567 units",           NParsy_GroupComma,     16 },
+      { "total: 1.234.567 units",           NParsy_GroupPeriod,    16 },
+      { "total: 1 234 567 units",           NParsy_GroupSpace,     16 },
+      { "total: 1" THIN_SPACE "234" THIN_SPACE "567 units", NParsy_GroupThinSpace, 20 },
+   };
+
+   for ( size_t i = 0; i < (sizeof cases / sizeof cases[0]); i++ )
+   {
+      uint64_t val = 0;
+      size_t consumed = 0;
+      TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntGrouped(cases[i].str, &val, &consumed, cases[i].group) );
+      TEST_ASSERT_EQUAL_UINT64( 1234567u, val );
+      TEST_ASSERT_EQUAL_size_t( cases[i].consumed, consumed );
+   }
+
+   // Another separator doesn't group
+   uint64_t val = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntGrouped("1,234,567", &val, nullptr, NParsy_GroupSpace) );
+   TEST_ASSERT_EQUAL_UINT64( 1u, val );
+}
+
+void test_NParsyU64ListGrouped_Report(void)
+{
+   size_t n = 0;
+   static const char report[] =
+      "region,revenue,units\n"
+      "north,\"1,234,567\",\"12,000\"\n"
+      "south,\"987,654,321\",\"7\"\n";
+   static const uint64_t expected[] = { 1234567u, 12000u, 987654321u, 7u };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped(report, Actual, MAX_VALS, &n, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_size_t( 4, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( expected, Actual, 4 );
+
+   // Plain lists still split on the separator
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64List("1,234,567", Actual, MAX_VALS, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( 3, n );
+}
+
+void test_NParsyU64ListGrouped_GroupsOfThreeOnly(void)
+{
+   size_t n = 0;
+   static const uint64_t short_group[] = { 1, 23 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped("1,23", Actual, MAX_VALS, &n, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( short_group, Actual, 2 );
+
+   static const uint64_t long_group[] = { 1, 2345 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped("1,2345", Actual, MAX_VALS, &n, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( long_group, Actual, 2 );
+
+   static const uint64_t long_first[] = { 1234, 567 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped("1234,567", Actual, MAX_VALS, &n, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( long_first, Actual, 2 );
+
+   // The number stops at the first bad group, where the next one starts
+   static const uint64_t bad_middle[] = { 1234, 56789 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped("1,234,56,789", Actual, MAX_VALS, &n, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( bad_middle, Actual, 2 );
+
+   static const uint64_t doubled[] = { 1, 234 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped("1,,234", Actual, MAX_VALS, &n, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( doubled, Actual, 2 );
+
+   static const uint64_t trailing[] = { 1234 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped("1,234,", Actual, MAX_VALS, &n, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_size_t( 1, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( trailing, Actual, 1 );
+
+   static const uint64_t at_end[] = { 12345, 678 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped("12,345 678", Actual, MAX_VALS, &n, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( at_end, Actual, 2 );
+
+   // A truncated thin space isn't a separator
+   static const uint64_t torn[] = { 1, 234 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped("1\xE2\x80" "234", Actual, MAX_VALS, &n, NParsy_GroupThinSpace) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( torn, Actual, 2 );
+}
+
+void test_NParsyU64ListGrouped_FloatsAndMalformed(void)
+{
+   size_t n = 0;
+   // 1,234.5 is a float; 1,234abc isn't a number
+   static const uint64_t expected[] = { 9, 1234 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped("1,234.5 -2,000 9 1,234abc 1,234", Actual, MAX_VALS, &n, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( expected, Actual, 2 );
+
+   // With a '.' separator, only exact groups of three are grouping
+   static const uint64_t period[] = { 1234, 5678000 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped("1.234 3.14 5.678.000", Actual, MAX_VALS, &n, NParsy_GroupPeriod) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( period, Actual, 2 );
+
+   // Prefixed numbers parse as usual
+   static const uint64_t prefixed[] = { 0x1Fu, 1000u };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped("0x1F, 1,000", Actual, MAX_VALS, &n, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( prefixed, Actual, 2 );
+}
+
+void test_NParsyU64ListGrouped_Limits(void)
+{
+   uint64_t val = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult,
+                          NParsyUIntGrouped("18,446,744,073,709,551,615", &val, nullptr, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_UINT64( UINT64_MAX, val );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_NumberOutOfRange,
+                          NParsyUIntGrouped("18,446,744,073,709,551,616", &val, nullptr, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NumberOutOfRange,
+                          NParsyUIntGrouped("1,000,000,000,000,000,000,000,000,000,000", &val, nullptr, NParsy_GroupComma) );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult,
+                          NParsyUIntGrouped("000,000,000,000,000,000,000,000,000,042", &val, nullptr, NParsy_GroupComma) );
+   TEST_ASSERT_EQUAL_UINT64( 42u, val );
+}
+
+void test_NParsyU64ListGrouped_NoGroupingMatchesList(void)
+{
+   static const char str[] = "id=12, 1,234 0x1F 1 000 -3 007 2.5 12ab 99999999999999999999 42";
+   size_t nexp = 0;
+   size_t nact = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64List(str, Expected, MAX_VALS, &nexp, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped(str, Actual, MAX_VALS, &nact, NParsy_NoGrouping) );
+   TEST_ASSERT_EQUAL_size_t( nexp, nact );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( Expected, Actual, nexp );
+}
+
+void test_NParsyU64ListGrouped_RandomlyGrouped(void)
+{
+   // Print random values grouped with every separator, in lists separated by
+   // something else, and check they all come back
+   static const char * const groups[NParsy_NumOfGroupSeps] = { "", ",", ".", " ", THIN_SPACE };
+   static const char * const delims[NParsy_NumOfGroupSeps] = { " ", "; ", ", ", "\n", " | " };
+
+   for ( int g = NParsy_GroupComma; g < (int)NParsy_NumOfGroupSeps; g++ )
+   {
+      size_t off = 0;
+      for ( size_t i = 0; i < MAX_VALS; i++ )
+      {
+         Rng ^= Rng << 13;
+         Rng ^= Rng >> 7;
+         Rng ^= Rng << 17;
+         uint64_t v = Rng >> (Rng % 64u);
+         Expected[i] = v;
+
+         char digits[24];
+         int nd = snprintf(digits, sizeof digits, "%llu", (unsigned long long)v);
+         for ( int k = 0; k < nd; k++ )
+         {
+            Str[off++] = digits[k];
+            if ( ((nd - 1 - k) % 3 == 0) && (k != nd - 1) )
+               off += (size_t)snprintf(Str + off, MAX_STR_LEN - off, "%s", groups[g]);
+         }
+         off += (size_t)snprintf(Str + off, MAX_STR_LEN - off, "%s", delims[g]);
+      }
+      Str[off] = '\0';
+
+      size_t n = 0;
+      TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListGrouped(Str, Actual, MAX_VALS, &n, (enum NParsyGroupSep)g) );
+      TEST_ASSERT_EQUAL_size_t( MAX_VALS, n );
+      TEST_ASSERT_EQUAL_UINT64_ARRAY( Expected, Actual, MAX_VALS );
+   }
+}
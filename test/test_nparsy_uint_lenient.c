@@ -0,0 +1,173 @@
+/*!
+ * @file    test_nparsy_uint_lenient.c
+ * @brief   Test file for the lenient (no consistency checks) unsigned integer nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "unity.h"
+#include "nparsy_uint.h"
+
+/* Local Macro Definitions */
+#define MAX_VALS      2048
+#define MAX_STR_LEN   (MAX_VALS * 32)
+
+/* Local Datatypes */
+
+/* Local Variables */
+static char Str[MAX_STR_LEN];
+static uint64_t Expected[MAX_VALS];
+static uint64_t Actual[MAX_VALS];
+static uint64_t Rng = 0x2545F4914F6CDD1Du;
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyUIntLenient_InvalidInputs(void);
+void test_NParsyU64ListLenient_InvalidInputs(void);
+
+// - Basic Usage -
+void test_NParsyUIntLenient_PrefixAndSuffix(void);
+void test_NParsyU64ListLenient_TrailingJunk(void);
+void test_NParsyU64ListLenient_StillSkipsNonUInts(void);
+void test_NParsyU64ListLenient_WellFormedMatchesStrict(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyUIntLenient_InvalidInputs);
+   RUN_TEST(test_NParsyU64ListLenient_InvalidInputs);
+
+   RUN_TEST(test_NParsyUIntLenient_PrefixAndSuffix);
+   RUN_TEST(test_NParsyU64ListLenient_TrailingJunk);
+   RUN_TEST(test_NParsyU64ListLenient_StillSkipsNonUInts);
+   RUN_TEST(test_NParsyU64ListLenient_WellFormedMatchesStrict);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset(Expected, 0xA5, sizeof Expected);
+   memset(Actual, 0xA5, sizeof Actual);
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/******************************************************************************/
+/* Test Cases */
+
+void test_NParsyUIntLenient_InvalidInputs(void)
+{
+   uint64_t val = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyUIntLenient(nullptr, &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyUIntLenient("1", nullptr, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDefaultFormat, NParsyUIntLenient("1", &val, nullptr, NParsy_NumOfFmts) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NoNumberFound, NParsyUIntLenient("no numbers", &val, nullptr, NParsy_Dec) );
+}
+
+void test_NParsyU64ListLenient_InvalidInputs(void)
+{
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyU64ListLenient(nullptr, Actual, 1, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyU64ListLenient("1 2", nullptr, 1, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDefaultFormat, NParsyU64ListLenient("1 2", Actual, 1, &n, NParsy_NumOfFmts) );
+}
+
+void test_NParsyUIntLenient_PrefixAndSuffix(void)
+{
+   uint64_t val = 0;
+   size_t consumed = 0;
+
+   // Strict skips it...
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUInt("0x1Fh 7", &val, &consumed, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_UINT64( 7u, val );
+
+   // ...lenient takes the prefix and digits and leaves the suffix
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntLenient("0x1Fh 7", &val, &consumed, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_UINT64( 0x1Fu, val );
+   TEST_ASSERT_EQUAL_size_t( 4, consumed );
+
+   // Out of range is still out of range
+   TEST_ASSERT_EQUAL_INT( NParsy_NumberOutOfRange,
+                          NParsyUIntLenient("0x10000000000000000", &val, nullptr, NParsy_Dec) );
+}
+
+void test_NParsyU64ListLenient_TrailingJunk(void)
+{
+   static const uint64_t dec_strict[] = { 5 };
+   static const uint64_t dec_lenient[] = { 12, 5 };
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64List("12ab 5", Actual, MAX_VALS, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( 1, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( dec_strict, Actual, 1 );
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListLenient("12ab 5", Actual, MAX_VALS, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( dec_lenient, Actual, 2 );
+
+   // The junk is part of the number, not the start of another one
+   static const uint64_t oct[] = { 012u, 03u };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListLenient("129 3", Actual, MAX_VALS, &n, NParsy_Oct) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( oct, Actual, 2 );
+
+   static const uint64_t bin[] = { 0x2u, 0x1u };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListLenient("1027 1", Actual, MAX_VALS, &n, NParsy_Bin) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( bin, Actual, 2 );
+}
+
+void test_NParsyU64ListLenient_StillSkipsNonUInts(void)
+{
+   size_t n = 0;
+   static const uint64_t expected[] = { 4, 0xFFu, 16 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListLenient("-1 2.5 3e8 .7 4 0xFF 16d", Actual, MAX_VALS, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( 3, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( expected, Actual, 3 );
+}
+
+void test_NParsyU64ListLenient_WellFormedMatchesStrict(void)
+{
+   static const char * const fmts[] = { "%llu", "0x%llX", "%llxh", "0b1", "0o%llo", "%lluD", "x%llx" };
+   static const char * const delims[] = { " ", ", ", "\n", ";", " = " };
+
+   size_t off = 0;
+   for ( size_t i = 0; i < MAX_VALS; i++ )
+   {
+      Rng ^= Rng << 13;
+      Rng ^= Rng >> 7;
+      Rng ^= Rng << 17;
+      unsigned long long v = Rng >> (Rng % 64u);
+      off += (size_t)snprintf(Str + off, MAX_STR_LEN - off, fmts[i % 7u], v);
+      off += (size_t)snprintf(Str + off, MAX_STR_LEN - off, "%s", delims[(Rng >> 7) % 5u]);
+   }
+
+   // Bare decimal numbers are only well-formed under the dec and hex defaults
+   for ( int fmt = NParsy_Dec; fmt <= (int)NParsy_Hex; fmt++ )
+   {
+      size_t nexp = 0;
+      size_t nact = 0;
+      TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64List(Str, Expected, MAX_VALS, &nexp, (enum NParsyNumFormat)fmt) );
+      TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListLenient(Str, Actual, MAX_VALS, &nact, (enum NParsyNumFormat)fmt) );
+      TEST_ASSERT_EQUAL_size_t( nexp, nact );
+      TEST_ASSERT_EQUAL_UINT64_ARRAY( Expected, Actual, nexp );
+   }
+}
@@ -0,0 +1,251 @@
+/*!
+ * @file    test_nparsy_uint_lines.c
+ * @brief   Test file for the line-indexed unsigned integer list nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "unity.h"
+#include "nparsy_uint.h"
+
+/* Local Macro Definitions */
+#define MAX_LINES 16
+
+/* Local Datatypes */
+
+/* Local Variables */
+static size_t LineStarts[MAX_LINES];
+static size_t LineCounts[MAX_LINES];
+static struct NParsyLineIndex Index;
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyU64ListLines_InvalidInputs(void);
+void test_NParsyU64ListLineRange_InvalidInputs(void);
+
+// - Basic Usage -
+void test_NParsyU64ListLines_EmptyStr(void);
+void test_NParsyU64ListLines_Lines(void);
+void test_NParsyU64ListLines_TrailingNewline(void);
+void test_NParsyU64ListLines_SkippedNumbersStillCountLines(void);
+void test_NParsyU64ListLines_BufFull(void);
+void test_NParsyU64ListLines_IndexFull(void);
+void test_NParsyU64ListLines_ManyLinesMatchesList(void);
+void test_NParsyU64ListLineRange_ReparsesLines(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyU64ListLines_InvalidInputs);
+   RUN_TEST(test_NParsyU64ListLineRange_InvalidInputs);
+
+   RUN_TEST(test_NParsyU64ListLines_EmptyStr);
+   RUN_TEST(test_NParsyU64ListLines_Lines);
+   RUN_TEST(test_NParsyU64ListLines_TrailingNewline);
+   RUN_TEST(test_NParsyU64ListLines_SkippedNumbersStillCountLines);
+   RUN_TEST(test_NParsyU64ListLines_BufFull);
+   RUN_TEST(test_NParsyU64ListLines_IndexFull);
+   RUN_TEST(test_NParsyU64ListLines_ManyLinesMatchesList);
+   RUN_TEST(test_NParsyU64ListLineRange_ReparsesLines);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset(LineStarts, 0xA5, sizeof LineStarts);
+   memset(LineCounts, 0xA5, sizeof LineCounts);
+   Index = (struct NParsyLineIndex){ .line_starts = LineStarts, .line_counts = LineCounts, .cap = MAX_LINES };
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/* Test Cases */
+void test_NParsyU64ListLines_InvalidInputs(void)
+{
+   uint64_t buf[4];
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyU64ListLines(nullptr, buf, 4, nullptr, NParsy_Dec, &Index));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU64ListLines("1", nullptr, 4, nullptr, NParsy_Dec, &Index));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU64ListLines("1", buf, 4, nullptr, NParsy_Dec, nullptr));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyU64ListLines("1", buf, 4, nullptr, NParsy_NumOfFmts, &Index));
+
+   Index.line_counts = nullptr;
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU64ListLines("1", buf, 4, nullptr, NParsy_Dec, &Index));
+}
+
+void test_NParsyU64ListLineRange_InvalidInputs(void)
+{
+   const char str[] = "1\n2\n3";
+   uint64_t buf[4];
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLines(str, buf, 4, nullptr, NParsy_Dec, &Index));
+   TEST_ASSERT_EQUAL_size_t(3, Index.num_lines);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU64ListLineRange(str, nullptr, 0, 1, buf, 4, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidLineRange, NParsyU64ListLineRange(str, &Index, 4, 0, buf, 4, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidLineRange, NParsyU64ListLineRange(str, &Index, 1, 3, buf, 4, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidLineRange, NParsyU64ListLineRange(str, &Index, 1, SIZE_MAX, buf, 4, nullptr, NParsy_Dec));
+   // An index from a longer string
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidLineRange, NParsyU64ListLineRange("1", &Index, 2, 1, buf, 4, nullptr, NParsy_Dec));
+}
+
+void test_NParsyU64ListLines_EmptyStr(void)
+{
+   uint64_t buf[4];
+   size_t n = 99;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLines("", buf, 4, &n, NParsy_Dec, &Index));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+   TEST_ASSERT_EQUAL_size_t(1, Index.num_lines);
+   TEST_ASSERT_EQUAL_size_t(0, LineStarts[0]);
+   TEST_ASSERT_EQUAL_size_t(0, LineCounts[0]);
+}
+
+void test_NParsyU64ListLines_Lines(void)
+{
+   const char str[] = "id=1 v=0x20\n\nno numbers\n7 8 9";
+   uint64_t buf[8];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLines(str, buf, 8, &n, NParsy_Dec, &Index));
+
+   const uint64_t expected_vals[] = { 1, 0x20, 7, 8, 9 };
+   TEST_ASSERT_EQUAL_size_t(5, n);
+   TEST_ASSERT_EQUAL_UINT64_ARRAY(expected_vals, buf, 5);
+
+   const size_t expected_starts[] = { 0, 12, 13, 24 };
+   const size_t expected_counts[] = { 2, 0, 0, 3 };
+   TEST_ASSERT_EQUAL_size_t(4, Index.num_lines);
+   for ( size_t i = 0; i < 4; i++ )
+   {
+      TEST_ASSERT_EQUAL_size_t(expected_starts[i], LineStarts[i]);
+      TEST_ASSERT_EQUAL_size_t(expected_counts[i], LineCounts[i]);
+   }
+}
+
+void test_NParsyU64ListLines_TrailingNewline(void)
+{
+   uint64_t buf[4];
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLines("1\n2\n", buf, 4, nullptr, NParsy_Dec, &Index));
+   TEST_ASSERT_EQUAL_size_t(2, Index.num_lines);
+   TEST_ASSERT_EQUAL_size_t(1, LineCounts[1]);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLines("\n", buf, 4, nullptr, NParsy_Dec, &Index));
+   TEST_ASSERT_EQUAL_size_t(1, Index.num_lines);
+}
+
+void test_NParsyU64ListLines_SkippedNumbersStillCountLines(void)
+{
+   // Negatives, floats, and out-of-range numbers are skipped, newlines around them aren't
+   const char str[] = "-1\n2.5\n99999999999999999999999\n4";
+   uint64_t buf[4];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLines(str, buf, 4, &n, NParsy_Dec, &Index));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+   TEST_ASSERT_EQUAL_UINT64(4, buf[0]);
+   TEST_ASSERT_EQUAL_size_t(4, Index.num_lines);
+   TEST_ASSERT_EQUAL_size_t(0, LineCounts[2]);
+   TEST_ASSERT_EQUAL_size_t(1, LineCounts[3]);
+   TEST_ASSERT_EQUAL_size_t(strlen(str) - 1, LineStarts[3]);
+}
+
+void test_NParsyU64ListLines_BufFull(void)
+{
+   uint64_t buf[3];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLines("1 2\n3 4\n5", buf, 3, &n, NParsy_Dec, &Index));
+   TEST_ASSERT_EQUAL_size_t(3, n);
+   // Line 1 is cut short; line 2 isn't reached
+   TEST_ASSERT_EQUAL_size_t(2, Index.num_lines);
+   TEST_ASSERT_EQUAL_size_t(2, LineCounts[0]);
+   TEST_ASSERT_EQUAL_size_t(1, LineCounts[1]);
+}
+
+void test_NParsyU64ListLines_IndexFull(void)
+{
+   uint64_t buf[8];
+   size_t n = 0;
+   Index.cap = 2;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLines("1 2\n3\n4 5\n6", buf, 8, &n, NParsy_Dec, &Index));
+   // Values from lines that couldn't be recorded aren't placed either
+   TEST_ASSERT_EQUAL_size_t(3, n);
+   TEST_ASSERT_EQUAL_size_t(2, Index.num_lines);
+
+   Index.cap = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLines("1 2", buf, 8, &n, NParsy_Dec, &Index));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+   TEST_ASSERT_EQUAL_size_t(0, Index.num_lines);
+}
+
+void test_NParsyU64ListLines_ManyLinesMatchesList(void)
+{
+   // Line i holds i values, all equal to i; compare against the plain list parse
+   char str[512];
+   size_t slen = 0;
+   for ( unsigned i = 0; i < MAX_LINES; i++ )
+   {
+      for ( unsigned j = 0; j < i; j++ )
+         slen += (size_t)snprintf(str + slen, sizeof str - slen, "%u ", i);
+      str[slen++] = '\n';
+   }
+   str[slen - 1] = '\0'; // No trailing newline
+
+   uint64_t plain[256];
+   uint64_t indexed[256];
+   size_t nplain = 0;
+   size_t nindexed = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64List(str, plain, 256, &nplain, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLines(str, indexed, 256, &nindexed, NParsy_Dec, &Index));
+   TEST_ASSERT_EQUAL_size_t(nplain, nindexed);
+   TEST_ASSERT_EQUAL_UINT64_ARRAY(plain, indexed, nplain);
+
+   TEST_ASSERT_EQUAL_size_t(MAX_LINES, Index.num_lines);
+   size_t k = 0;
+   for ( size_t i = 0; i < MAX_LINES; i++ )
+   {
+      TEST_ASSERT_EQUAL_size_t(i, LineCounts[i]);
+      TEST_ASSERT_TRUE((i == 0) || (str[LineStarts[i] - 1] == '\n'));
+      for ( size_t j = 0; j < LineCounts[i]; j++ )
+         TEST_ASSERT_EQUAL_UINT64(i, indexed[k++]);
+   }
+}
+
+void test_NParsyU64ListLineRange_ReparsesLines(void)
+{
+   const char str[] = "a 1 2\nb 3\nc\nd 4 5 6";
+   uint64_t buf[8];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLines(str, buf, 8, &n, NParsy_Dec, &Index));
+   TEST_ASSERT_EQUAL_size_t(4, Index.num_lines);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLineRange(str, &Index, 1, 2, buf, 8, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+   TEST_ASSERT_EQUAL_UINT64(3, buf[0]);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLineRange(str, &Index, 3, 1, buf, 8, &n, NParsy_Dec));
+   const uint64_t last_line[] = { 4, 5, 6 };
+   TEST_ASSERT_EQUAL_size_t(3, n);
+   TEST_ASSERT_EQUAL_UINT64_ARRAY(last_line, buf, 3);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLineRange(str, &Index, 0, 4, buf, 2, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(2, n);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU64ListLineRange(str, &Index, 2, 0, buf, 8, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(0, n);
+}
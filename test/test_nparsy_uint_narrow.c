@@ -0,0 +1,266 @@
+/*!
+ * @file    test_nparsy_uint_narrow.c
+ * @brief   Test file for the width-specialized unsigned integer nparsy API
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "unity.h"
+#include "nparsy_uint.h"
+
+/* Local Macro Definitions */
+
+/* Local Datatypes */
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyUNarrow_NullStr(void);
+void test_NParsyUNarrow_NullBuf(void);
+void test_NParsyUNarrow_InvalidDefaultFmt(void);
+
+// - Basic Usage -
+void test_NParsyU8_Limits(void);
+void test_NParsyU16_Limits(void);
+void test_NParsyU32_Limits(void);
+void test_NParsyUInt_Limits(void);
+void test_NParsyU8_LeadingZerosDontCount(void);
+void test_NParsyU8_SentenceStr_OutOfRangeThenContinue(void);
+
+// - Generic Selection -
+void test_NParsyUIntOf_PicksWidth(void);
+void test_NParsyUIntListOf_PicksWidth(void);
+
+// -- List Parsing --
+void test_NParsyU8List_SkipsOutOfRange(void);
+void test_NParsyU16List_MixedFormats(void);
+void test_NParsyUIntList_DecDefault(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyUNarrow_NullStr);
+   RUN_TEST(test_NParsyUNarrow_NullBuf);
+   RUN_TEST(test_NParsyUNarrow_InvalidDefaultFmt);
+
+   RUN_TEST(test_NParsyU8_Limits);
+   RUN_TEST(test_NParsyU16_Limits);
+   RUN_TEST(test_NParsyU32_Limits);
+   RUN_TEST(test_NParsyUInt_Limits);
+   RUN_TEST(test_NParsyU8_LeadingZerosDontCount);
+   RUN_TEST(test_NParsyU8_SentenceStr_OutOfRangeThenContinue);
+
+   RUN_TEST(test_NParsyUIntOf_PicksWidth);
+   RUN_TEST(test_NParsyUIntListOf_PicksWidth);
+
+   RUN_TEST(test_NParsyU8List_SkipsOutOfRange);
+   RUN_TEST(test_NParsyU16List_MixedFormats);
+   RUN_TEST(test_NParsyUIntList_DecDefault);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   // Do nothing
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/* Test Cases */
+void test_NParsyUNarrow_NullStr(void)
+{
+   uint8_t u8;
+   uint16_t u16;
+   uint32_t u32;
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyU8(nullptr, &u8, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyU16(nullptr, &u16, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyU32(nullptr, &u32, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidString, NParsyU8List(nullptr, &u8, 1, nullptr, NParsy_Dec));
+}
+
+void test_NParsyUNarrow_NullBuf(void)
+{
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU8("5", nullptr, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU16("5", nullptr, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU32("5", nullptr, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NullPtr, NParsyU32List("5", nullptr, 1, nullptr, NParsy_Dec));
+}
+
+void test_NParsyUNarrow_InvalidDefaultFmt(void)
+{
+   uint8_t u8;
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyU8("5", &u8, nullptr, NParsy_NumOfFmts));
+   TEST_ASSERT_EQUAL_INT(NParsy_InvalidDefaultFormat, NParsyU8List("5", &u8, 1, nullptr, NParsy_NumOfFmts));
+}
+
+void test_NParsyU8_Limits(void)
+{
+   uint8_t val = 7;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU8("255", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT8(255, val);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU8("0xFF", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT8(0xFF, val);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU8("0b11111111", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT8(0xFF, val);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU8("0o377", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT8(0xFF, val);
+
+   val = 7;
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU8("256", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU8("1000", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU8("0x100", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU8("0b100000000", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU8("0o400", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU8("99999999999999999999999999", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT8(7, val);
+}
+
+void test_NParsyU16_Limits(void)
+{
+   uint16_t val = 7;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU16("65535", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT16(UINT16_MAX, val);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU16("0FFFFh", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT16(UINT16_MAX, val);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU16("177777", &val, nullptr, NParsy_Oct));
+   TEST_ASSERT_EQUAL_UINT16(UINT16_MAX, val);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU16("65536", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU16("10000h", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU16("200000", &val, nullptr, NParsy_Oct));
+}
+
+void test_NParsyU32_Limits(void)
+{
+   uint32_t val = 7;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU32("4294967295", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, val);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU32("xFFFFFFFF", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, val);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU32("4294967296", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU32("100000000", &val, nullptr, NParsy_Hex));
+}
+
+void test_NParsyUInt_Limits(void)
+{
+   uint64_t val = 7;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUInt("18446744073709551615", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, val);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUInt("0o1777777777777777777777", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, val);
+
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyUInt("18446744073709551616", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyUInt("0o2000000000000000000000", &val, nullptr, NParsy_Dec));
+}
+
+void test_NParsyU8_LeadingZerosDontCount(void)
+{
+   uint8_t val = 7;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU8("00000000000000000000000063", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT8(63, val);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU8("0x00000000003F", &val, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT8(0x3F, val);
+}
+
+void test_NParsyU8_SentenceStr_OutOfRangeThenContinue(void)
+{
+   const char str[] = "id 300 was rejected, id 42 accepted";
+   uint8_t val = 7;
+   size_t acc = 0;
+
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyU8(str, &val, &acc, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(strlen("id 300"), acc);
+   TEST_ASSERT_EQUAL_UINT8(7, val);
+
+   size_t acc2 = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU8(str + acc, &val, &acc2, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT8(42, val);
+   TEST_ASSERT_EQUAL_size_t(strlen("id 300 was rejected, id 42"), acc + acc2);
+}
+
+void test_NParsyUIntOf_PicksWidth(void)
+{
+   uint8_t u8 = 0;
+   uint16_t u16 = 0;
+   uint32_t u32 = 0;
+   uint64_t u64 = 0;
+
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyUIntOf("300", &u8, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntOf("300", &u16, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT16(300, u16);
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyUIntOf("70000", &u16, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntOf("70000", &u32, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT32(70000, u32);
+   TEST_ASSERT_EQUAL_INT(NParsy_NumberOutOfRange, NParsyUIntOf("5000000000", &u32, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntOf("5000000000", &u64, nullptr, NParsy_Dec));
+   TEST_ASSERT_EQUAL_UINT64(5000000000u, u64);
+}
+
+void test_NParsyUIntListOf_PicksWidth(void)
+{
+   const char str[] = "1 300 70000 5000000000";
+   uint8_t u8[4];
+   uint32_t u32[4];
+   uint64_t u64[4];
+   size_t n = 0;
+
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntListOf(str, u8, 4, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(1, n);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntListOf(str, u32, 4, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(3, n);
+   TEST_ASSERT_EQUAL_UINT32(70000, u32[2]);
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntListOf(str, u64, 4, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(4, n);
+   TEST_ASSERT_EQUAL_UINT64(5000000000u, u64[3]);
+}
+
+void test_NParsyU8List_SkipsOutOfRange(void)
+{
+   uint8_t buf[8];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU8List("PIDs: 0x3C, 256, 17, -3, 63d, 1.5", buf, 8, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(3, n);
+   TEST_ASSERT_EQUAL_UINT8(0x3C, buf[0]);
+   TEST_ASSERT_EQUAL_UINT8(17, buf[1]);
+   TEST_ASSERT_EQUAL_UINT8(63, buf[2]);
+}
+
+void test_NParsyU16List_MixedFormats(void)
+{
+   uint16_t buf[3];
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyU16List("0b101 0o17 0FFh 9000 12", buf, 3, &n, NParsy_Dec));
+   TEST_ASSERT_EQUAL_size_t(3, n);
+   TEST_ASSERT_EQUAL_UINT16(5, buf[0]);
+   TEST_ASSERT_EQUAL_UINT16(15, buf[1]);
+   TEST_ASSERT_EQUAL_UINT16(255, buf[2]);
+}
+
+void test_NParsyUIntList_DecDefault(void)
+{
+   uint64_t buf[4] = { 0 };
+   TEST_ASSERT_EQUAL_INT(NParsy_GoodResult, NParsyUIntList("10 0x10 99999999999999999999 20", buf, 4));
+   TEST_ASSERT_EQUAL_UINT64(10, buf[0]);
+   TEST_ASSERT_EQUAL_UINT64(16, buf[1]);
+   TEST_ASSERT_EQUAL_UINT64(20, buf[2]);
+   TEST_ASSERT_EQUAL_UINT64(0, buf[3]);
+}
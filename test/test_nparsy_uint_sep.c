@@ -0,0 +1,295 @@
+/*!
+ * @file    test_nparsy_uint_sep.c
+ * @brief   Test file for unsigned integer parsing with digit separators
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "unity.h"
+#include "nparsy_uint.h"
+
+/* Local Macro Definitions */
+#define MAX_VALS      2048
+#define MAX_STR_LEN   (MAX_VALS * 96)
+
+/* Local Datatypes */
+
+/* Local Variables */
+static char Str[MAX_STR_LEN];
+static uint64_t Expected[MAX_VALS];
+static uint64_t Actual[MAX_VALS];
+static uint64_t Rng = 0xD1B54A32D192ED03u;
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyUIntSep_InvalidInputs(void);
+void test_NParsyU64ListSep_InvalidInputs(void);
+
+// - Basic Usage -
+void test_NParsyUIntSep_EveryFormat(void);
+void test_NParsyUIntSep_OnlyChosenSeps(void);
+void test_NParsyUIntSep_OnlyBetweenDigits(void);
+void test_NParsyUIntSep_Limits(void);
+void test_NParsyU64ListSep_FloatsAndNegativesStillSkipped(void);
+void test_NParsyU64ListSep_NoSepMatchesList(void);
+void test_NParsyU64ListSep_RandomlySeparated(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyUIntSep_InvalidInputs);
+   RUN_TEST(test_NParsyU64ListSep_InvalidInputs);
+
+   RUN_TEST(test_NParsyUIntSep_EveryFormat);
+   RUN_TEST(test_NParsyUIntSep_OnlyChosenSeps);
+   RUN_TEST(test_NParsyUIntSep_OnlyBetweenDigits);
+   RUN_TEST(test_NParsyUIntSep_Limits);
+   RUN_TEST(test_NParsyU64ListSep_FloatsAndNegativesStillSkipped);
+   RUN_TEST(test_NParsyU64ListSep_NoSepMatchesList);
+   RUN_TEST(test_NParsyU64ListSep_RandomlySeparated);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset(Expected, 0xA5, sizeof Expected);
+   memset(Actual, 0xA5, sizeof Actual);
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/******************************************************************************/
+/* Test Cases */
+
+void test_NParsyUIntSep_InvalidInputs(void)
+{
+   uint64_t val = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyUIntSep(nullptr, &val, nullptr, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyUIntSep("1'0", nullptr, nullptr, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDefaultFormat, NParsyUIntSep("1'0", &val, nullptr, NParsy_NumOfFmts, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDigitSeparators, NParsyUIntSep("1'0", &val, nullptr, NParsy_Dec, 1u << 2) );
+}
+
+void test_NParsyU64ListSep_InvalidInputs(void)
+{
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyU64ListSep(nullptr, Actual, 1, &n, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyU64ListSep("1'0", nullptr, 1, &n, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDefaultFormat, NParsyU64ListSep("1'0", Actual, 1, &n, NParsy_NumOfFmts, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDigitSeparators, NParsyU64ListSep("1'0", Actual, 1, &n, NParsy_Dec, ~0u) );
+}
+
+void test_NParsyUIntSep_EveryFormat(void)
+{
+   size_t n = 0;
+   static const uint64_t dec[] = { 1000000, 1000, 12345 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("a = 1'000'000, b = 1_000d; c = 12_3'45", Actual, MAX_VALS, &n, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_size_t( 3, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( dec, Actual, 3 );
+
+   static const uint64_t hex[] = { 0xFFFFFFFFu, 0x7FFFFu, 0xDEADBEEFu, 0xABCDu };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("0xFFFF_FFFF 7FF_FFh xDEAD'BEEF AB_CD", Actual, MAX_VALS, &n, NParsy_Hex, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_size_t( 4, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( hex, Actual, 4 );
+
+   static const uint64_t bin[] = { 0xAAu, 0x0Fu };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("0b1010'1010, 0000_1111", Actual, MAX_VALS, &n, NParsy_Bin, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( bin, Actual, 2 );
+
+   static const uint64_t oct[] = { 077u, 01234567u };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("0o7_7 1'234'567", Actual, MAX_VALS, &n, NParsy_Oct, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( oct, Actual, 2 );
+
+   // Single-value form, walking through with accumulated_strlen
+   uint64_t val = 0;
+   size_t consumed = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntSep("x: 0x12_34!", &val, &consumed, NParsy_Dec, NParsy_SepUnderscore) );
+   TEST_ASSERT_EQUAL_UINT64( 0x1234u, val );
+   TEST_ASSERT_EQUAL_size_t( 10, consumed );
+}
+
+void test_NParsyUIntSep_OnlyChosenSeps(void)
+{
+   size_t n = 0;
+   static const uint64_t apos_only[] = { 1000, 1, 0 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("1'000 1_000", Actual, MAX_VALS, &n, NParsy_Dec, NParsy_SepApostrophe) );
+   TEST_ASSERT_EQUAL_size_t( 3, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( apos_only, Actual, 3 );
+
+   static const uint64_t under_only[] = { 1, 0, 1000 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("1'000 1_000", Actual, MAX_VALS, &n, NParsy_Dec, NParsy_SepUnderscore) );
+   TEST_ASSERT_EQUAL_size_t( 3, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( under_only, Actual, 3 );
+
+   // No separators: exactly the old behavior
+   static const uint64_t none[] = { 1, 0, 1, 0 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("1'000 1_000", Actual, MAX_VALS, &n, NParsy_Dec, NParsy_NoSep) );
+   TEST_ASSERT_EQUAL_size_t( 4, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( none, Actual, 4 );
+}
+
+void test_NParsyUIntSep_OnlyBetweenDigits(void)
+{
+   size_t n = 0;
+   static const uint64_t doubled[] = { 1, 2 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("1__2", Actual, MAX_VALS, &n, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( doubled, Actual, 2 );
+
+   static const uint64_t mixed_pair[] = { 3, 4 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("3'_4", Actual, MAX_VALS, &n, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( mixed_pair, Actual, 2 );
+
+   static const uint64_t edges[] = { 12, 34, 56 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("_12 34_ '56'", Actual, MAX_VALS, &n, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_size_t( 3, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( edges, Actual, 3 );
+
+   // Right after a prefix isn't between two digits, so "0b_1" is no number...
+   static const uint64_t after_prefix[] = { 0xFFu };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("0b_1 0xFF", Actual, MAX_VALS, &n, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_size_t( 1, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( after_prefix, Actual, 1 );
+
+   // ...while without separators the '_' is just a delimiter
+   static const uint64_t after_prefix_nosep[] = { 1, 0xFFu };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("0b_1 0xFF", Actual, MAX_VALS, &n, NParsy_Dec, NParsy_NoSep) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( after_prefix_nosep, Actual, 2 );
+
+   // A separator at the very end of the string
+   static const uint64_t at_end[] = { 77 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("77'", Actual, MAX_VALS, &n, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_size_t( 1, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( at_end, Actual, 1 );
+}
+
+void test_NParsyUIntSep_Limits(void)
+{
+   uint64_t val = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult,
+                          NParsyUIntSep("18'446'744'073'709'551'615", &val, nullptr, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_UINT64( UINT64_MAX, val );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_NumberOutOfRange,
+                          NParsyUIntSep("18'446'744'073'709'551'616", &val, nullptr, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NumberOutOfRange,
+                          NParsyUIntSep("0x1_0000_0000_0000_0000", &val, nullptr, NParsy_Dec, NParsy_AllSeps) );
+
+   // Leading zeros don't count against the digit limit, separated or not
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult,
+                          NParsyUIntSep("0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0001",
+                                        &val, nullptr, NParsy_Bin, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_UINT64( 1u, val );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult,
+                          NParsyUIntSep("0b1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111",
+                                        &val, nullptr, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_UINT64( UINT64_MAX, val );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_NumberOutOfRange,
+                          NParsyUIntSep("0b1'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111'1111",
+                                        &val, nullptr, NParsy_Dec, NParsy_AllSeps) );
+}
+
+void test_NParsyU64ListSep_FloatsAndNegativesStillSkipped(void)
+{
+   size_t n = 0;
+   static const uint64_t expected[] = { 3, 1000 };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep("1'000.5 -2'000 3 1_0e3 1'000", Actual, MAX_VALS, &n, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( expected, Actual, 2 );
+}
+
+void test_NParsyU64ListSep_NoSepMatchesList(void)
+{
+   static const char str[] = "id=12, 0x1F,0b1010 -3 007 2.5 ffh 12ab 99999999999999999999 42 1'2 3_4";
+   for ( int fmt = 0; fmt < (int)NParsy_NumOfFmts; fmt++ )
+   {
+      size_t nexp = 0;
+      size_t nact = 0;
+      TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64List(str, Expected, MAX_VALS, &nexp, (enum NParsyNumFormat)fmt) );
+      TEST_ASSERT_EQUAL_INT( NParsy_GoodResult,
+                             NParsyU64ListSep(str, Actual, MAX_VALS, &nact, (enum NParsyNumFormat)fmt, NParsy_NoSep) );
+      TEST_ASSERT_EQUAL_size_t( nexp, nact );
+      TEST_ASSERT_EQUAL_UINT64_ARRAY( Expected, Actual, nexp );
+   }
+}
+
+void test_NParsyU64ListSep_RandomlySeparated(void)
+{
+   // Print random values in every format, with a separator after any digit
+   // but the last, and check they all come back
+   static const char * const prefixes[] = { "", "0x", "0b", "0o" };
+   static const unsigned bits[] = { 0, 4, 1, 3 };
+
+   size_t off = 0;
+   for ( size_t i = 0; i < MAX_VALS; i++ )
+   {
+      Rng ^= Rng << 13;
+      Rng ^= Rng >> 7;
+      Rng ^= Rng << 17;
+      uint64_t v = (i % 3u == 0u) ? (Rng % 100000u) : Rng;
+      size_t f = i % 4u;
+      Expected[i] = v;
+
+      // Digits, most significant first
+      char digits[72];
+      size_t nd = 0;
+      if ( bits[f] == 0u )
+         nd = (size_t)snprintf(digits, sizeof digits, "%llu", (unsigned long long)v);
+      else
+      {
+         uint64_t mask = (1u << bits[f]) - 1u;
+         do
+         {
+            digits[nd++] = "0123456789abcdef"[v & mask];
+            v >>= bits[f];
+         } while ( v != 0u );
+         for ( size_t a = 0, b = nd - 1u; a < b; a++, b-- )
+         {
+            char t = digits[a];
+            digits[a] = digits[b];
+            digits[b] = t;
+         }
+      }
+
+      off += (size_t)snprintf(Str + off, MAX_STR_LEN - off, "%s", prefixes[f]);
+      for ( size_t k = 0; k < nd; k++ )
+      {
+         Str[off++] = digits[k];
+         if ( ((k + 1u) < nd) && ((Rng >> (k % 60u)) & 1u) )
+            Str[off++] = ((Rng >> 61) & 1u) ? '\'' : '_';
+      }
+      Str[off++] = (i % 2u) ? ' ' : '\n';
+   }
+   Str[off] = '\0';
+
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSep(Str, Actual, MAX_VALS, &n, NParsy_Dec, NParsy_AllSeps) );
+   TEST_ASSERT_EQUAL_size_t( MAX_VALS, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( Expected, Actual, MAX_VALS );
+}
@@ -0,0 +1,251 @@
+/*!
+ * @file    test_nparsy_uint_syntax.c
+ * @brief   Test file for unsigned integer parsing with custom prefixes and suffixes
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "unity.h"
+#include "nparsy_uint.h"
+
+/* Local Macro Definitions */
+#define MAX_VALS      64
+
+/* Local Datatypes */
+
+/* Local Variables */
+static uint64_t Expected[MAX_VALS];
+static uint64_t Actual[MAX_VALS];
+static struct NParsySyntax * Asm = nullptr;
+
+static const struct NParsyAffix AsmPrefixes[] =
+{
+   { '$', NParsy_Hex },
+   { '#', NParsy_Hex },
+   { '%', NParsy_Bin },
+};
+
+static const struct NParsyAffix AsmSuffixes[] =
+{
+   { 'q', NParsy_Oct },
+   { 'Q', NParsy_Oct },
+   { 'o', NParsy_Oct },
+};
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyCompileSyntax_InvalidInputs(void);
+void test_NParsyCompileSyntax_InvalidAffixes(void);
+void test_NParsyUIntSyntax_InvalidInputs(void);
+void test_NParsyU64ListSyntax_InvalidInputs(void);
+
+// - Basic Usage -
+void test_NParsyUIntSyntax_Prefixes(void);
+void test_NParsyUIntSyntax_Suffixes(void);
+void test_NParsyU64ListSyntax_AssemblerListing(void);
+void test_NParsyU64ListSyntax_PrefixOnlyAtWordStart(void);
+void test_NParsyU64ListSyntax_NoAffixesMatchesList(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyCompileSyntax_InvalidInputs);
+   RUN_TEST(test_NParsyCompileSyntax_InvalidAffixes);
+   RUN_TEST(test_NParsyUIntSyntax_InvalidInputs);
+   RUN_TEST(test_NParsyU64ListSyntax_InvalidInputs);
+
+   RUN_TEST(test_NParsyUIntSyntax_Prefixes);
+   RUN_TEST(test_NParsyUIntSyntax_Suffixes);
+   RUN_TEST(test_NParsyU64ListSyntax_AssemblerListing);
+   RUN_TEST(test_NParsyU64ListSyntax_PrefixOnlyAtWordStart);
+   RUN_TEST(test_NParsyU64ListSyntax_NoAffixesMatchesList);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset(Expected, 0xA5, sizeof Expected);
+   memset(Actual, 0xA5, sizeof Actual);
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult,
+                          NParsyCompileSyntax(AsmPrefixes, sizeof AsmPrefixes / sizeof AsmPrefixes[0],
+                                              AsmSuffixes, sizeof AsmSuffixes / sizeof AsmSuffixes[0], &Asm) );
+}
+void tearDown(void)
+{
+   NParsyFreeSyntax(Asm);
+   Asm = nullptr;
+}
+
+/******************************************************************************/
+/* Test Cases */
+
+void test_NParsyCompileSyntax_InvalidInputs(void)
+{
+   struct NParsySyntax * syn = nullptr;
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyCompileSyntax(nullptr, 1, nullptr, 0, &syn) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyCompileSyntax(nullptr, 0, nullptr, 1, &syn) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyCompileSyntax(AsmPrefixes, 1, nullptr, 0, nullptr) );
+
+   // No affixes at all is just the built-in syntax
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyCompileSyntax(nullptr, 0, nullptr, 0, &syn) );
+   NParsyFreeSyntax(syn);
+   NParsyFreeSyntax(nullptr);
+}
+
+void test_NParsyCompileSyntax_InvalidAffixes(void)
+{
+   static const struct NParsyAffix bad[] =
+   {
+      { '7', NParsy_Hex }, { 'a', NParsy_Hex }, { 'F', NParsy_Hex }, { '-', NParsy_Hex },
+      { '.', NParsy_Hex }, { '\0', NParsy_Hex }, { 'x', NParsy_Bin }, { 'H', NParsy_Dec },
+      { '$', NParsy_NumOfFmts }, { '$', (enum NParsyNumFormat)-1 },
+   };
+   static const struct NParsyAffix twice[] = { { '$', NParsy_Hex }, { '$', NParsy_Bin } };
+
+   struct NParsySyntax * syn = (struct NParsySyntax *)&syn;
+   for ( size_t i = 0; i < (sizeof bad / sizeof bad[0]); i++ )
+   {
+      TEST_ASSERT_EQUAL_INT( NParsy_InvalidSyntax, NParsyCompileSyntax(&bad[i], 1, nullptr, 0, &syn) );
+      TEST_ASSERT_EQUAL_INT( NParsy_InvalidSyntax, NParsyCompileSyntax(nullptr, 0, &bad[i], 1, &syn) );
+   }
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidSyntax, NParsyCompileSyntax(twice, 2, nullptr, 0, &syn) );
+
+   // syntax is left alone on failure
+   TEST_ASSERT_TRUE( syn == (struct NParsySyntax *)&syn );
+
+   // The same char may be both a prefix and a suffix
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyCompileSyntax(twice, 1, twice, 1, &syn) );
+   NParsyFreeSyntax(syn);
+}
+
+void test_NParsyUIntSyntax_InvalidInputs(void)
+{
+   uint64_t val = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyUIntSyntax(Asm, nullptr, &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyUIntSyntax(nullptr, "$1F", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyUIntSyntax(Asm, "$1F", nullptr, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDefaultFormat, NParsyUIntSyntax(Asm, "$1F", &val, nullptr, NParsy_NumOfFmts) );
+}
+
+void test_NParsyU64ListSyntax_InvalidInputs(void)
+{
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyU64ListSyntax(Asm, nullptr, Actual, 1, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyU64ListSyntax(nullptr, "$1F", Actual, 1, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyU64ListSyntax(Asm, "$1F", nullptr, 1, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDefaultFormat, NParsyU64ListSyntax(Asm, "$1F", Actual, 1, &n, NParsy_NumOfFmts) );
+}
+
+void test_NParsyUIntSyntax_Prefixes(void)
+{
+   uint64_t val = 0;
+   size_t consumed = 0;
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntSyntax(Asm, "lda $C0FF", &val, &consumed, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_UINT64( 0xC0FFu, val );
+   TEST_ASSERT_EQUAL_size_t( 9, consumed );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntSyntax(Asm, "cmp #ff", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_UINT64( 0xFFu, val );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntSyntax(Asm, "and %10100101", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_UINT64( 0xA5u, val );
+
+   // A prefix with no digit of its format after it isn't one
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntSyntax(Asm, "%2 $g 5", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_UINT64( 2u, val );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_NumberOutOfRange, NParsyUIntSyntax(Asm, "$10000000000000000", &val, nullptr, NParsy_Dec) );
+}
+
+void test_NParsyUIntSyntax_Suffixes(void)
+{
+   uint64_t val = 0;
+   size_t consumed = 0;
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntSyntax(Asm, "mode 755q", &val, &consumed, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_UINT64( 0755u, val );
+   TEST_ASSERT_EQUAL_size_t( 9, consumed );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntSyntax(Asm, "17O", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_UINT64( 17u, val );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntSyntax(Asm, "17o", &val, nullptr, NParsy_Hex) );
+   TEST_ASSERT_EQUAL_UINT64( 017u, val );
+
+   // Digits outside the suffix's format make it malformed
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntSyntax(Asm, "19q 3", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_UINT64( 3u, val );
+
+   // A suffix must end the word
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntSyntax(Asm, "17qs", &val, nullptr, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_UINT64( 17u, val );
+}
+
+void test_NParsyU64ListSyntax_AssemblerListing(void)
+{
+   size_t n = 0;
+   static const char listing[] =
+      "0400  A9 $FF      lda #$FF\n"
+      "0402  29 %1010    ora #%1010\n"
+      "0404  8D 1000h    sta $D020\n"
+      "0407  60          rts ; 377q\n";
+   static const uint64_t expected[] =
+   {
+      0x0400, 0xA9, 0xFF, 0xFF,
+      0x0402, 0x29, 0xA, 0xA,
+      0x0404, 0x8D, 0x1000, 0xD020,
+      0x0407, 0x60, 0377,
+   };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSyntax(Asm, listing, Actual, MAX_VALS, &n, NParsy_Hex) );
+   TEST_ASSERT_EQUAL_size_t( sizeof expected / sizeof expected[0], n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( expected, Actual, sizeof expected / sizeof expected[0] );
+}
+
+void test_NParsyU64ListSyntax_PrefixOnlyAtWordStart(void)
+{
+   size_t n = 0;
+   // Mid-word, a prefix char is just a delimiter like any other
+   static const uint64_t expected[] = { 10u, 0x10u, 1u, 0x20u };
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListSyntax(Asm, "a$10 ($10) x%1 [$20]", Actual, MAX_VALS, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( 4, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( expected, Actual, 4 );
+}
+
+void test_NParsyU64ListSyntax_NoAffixesMatchesList(void)
+{
+   static const char str[] = "id=12, 0x1F,0b1010 -3 007 2.5 ffh 12ab 99999999999999999999 $42 17q";
+   struct NParsySyntax * none = nullptr;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyCompileSyntax(nullptr, 0, nullptr, 0, &none) );
+
+   for ( int fmt = 0; fmt < (int)NParsy_NumOfFmts; fmt++ )
+   {
+      size_t nexp = 0;
+      size_t nact = 0;
+      TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64List(str, Expected, MAX_VALS, &nexp, (enum NParsyNumFormat)fmt) );
+      TEST_ASSERT_EQUAL_INT( NParsy_GoodResult,
+                             NParsyU64ListSyntax(none, str, Actual, MAX_VALS, &nact, (enum NParsyNumFormat)fmt) );
+      TEST_ASSERT_EQUAL_size_t( nexp, nact );
+      TEST_ASSERT_EQUAL_UINT64_ARRAY( Expected, Actual, nexp );
+   }
+
+   NParsyFreeSyntax(none);
+}
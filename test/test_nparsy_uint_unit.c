@@ -0,0 +1,249 @@
+/*!
+ * @file    test_nparsy_uint_unit.c
+ * @brief   Test file for unsigned integer parsing with SI/IEC magnitude suffixes
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "unity.h"
+#include "nparsy_uint.h"
+
+/* Local Macro Definitions */
+#define MAX_VALS      64
+
+/* Local Datatypes */
+
+/* Local Variables */
+static uint64_t Actual[MAX_VALS];
+static enum NParsyUnit Units[MAX_VALS];
+
+/* Forward Function Declarations */
+// Test Setup
+void setUp(void);
+void tearDown(void);
+
+// ----- Unit Test Cases -----
+// - Invalid Inputs -
+void test_NParsyUIntUnit_InvalidInputs(void);
+void test_NParsyU64ListUnit_InvalidInputs(void);
+
+// - Basic Usage -
+void test_NParsyUIntUnit_EverySuffix(void);
+void test_NParsyUIntUnit_NoSuffix(void);
+void test_NParsyUIntUnit_SuffixMustEndTheWord(void);
+void test_NParsyUIntUnit_OnlyPlainDecimal(void);
+void test_NParsyUIntUnit_Overflow(void);
+void test_NParsyU64ListUnit_Config(void);
+void test_NParsyU64ListUnit_UnitsOptional(void);
+
+/******************************************************************************/
+/* Main Test Suite Functions */
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_NParsyUIntUnit_InvalidInputs);
+   RUN_TEST(test_NParsyU64ListUnit_InvalidInputs);
+
+   RUN_TEST(test_NParsyUIntUnit_EverySuffix);
+   RUN_TEST(test_NParsyUIntUnit_NoSuffix);
+   RUN_TEST(test_NParsyUIntUnit_SuffixMustEndTheWord);
+   RUN_TEST(test_NParsyUIntUnit_OnlyPlainDecimal);
+   RUN_TEST(test_NParsyUIntUnit_Overflow);
+   RUN_TEST(test_NParsyU64ListUnit_Config);
+   RUN_TEST(test_NParsyU64ListUnit_UnitsOptional);
+
+   return UNITY_END();
+}
+
+void setUp(void)
+{
+   memset(Actual, 0xA5, sizeof Actual);
+   memset(Units, 0xA5, sizeof Units);
+}
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/******************************************************************************/
+/* Test Cases */
+
+void test_NParsyUIntUnit_InvalidInputs(void)
+{
+   uint64_t val = 0;
+   enum NParsyUnit unit = NParsy_NoUnit;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyUIntUnit(nullptr, &val, nullptr, NParsy_Dec, &unit) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyUIntUnit("4k", nullptr, nullptr, NParsy_Dec, &unit) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyUIntUnit("4k", &val, nullptr, NParsy_Dec, nullptr) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDefaultFormat, NParsyUIntUnit("4k", &val, nullptr, NParsy_NumOfFmts, &unit) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NoNumberFound, NParsyUIntUnit("k M Gi", &val, nullptr, NParsy_Dec, &unit) );
+}
+
+void test_NParsyU64ListUnit_InvalidInputs(void)
+{
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidString, NParsyU64ListUnit(nullptr, Actual, Units, 1, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_NullPtr, NParsyU64ListUnit("4k", nullptr, Units, 1, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_INT( NParsy_InvalidDefaultFormat, NParsyU64ListUnit("4k", Actual, Units, 1, &n, NParsy_NumOfFmts) );
+}
+
+void test_NParsyUIntUnit_EverySuffix(void)
+{
+   static const struct
+   {
+      const char * str;
+      uint64_t val;
+      enum NParsyUnit unit;
+   } cases[] =
+   {
+      { "250k",  250'000u,                      NParsy_Kilo },
+      { "250K",  250'000u,                      NParsy_Kilo },
+      { "3M",    3'000'000u,                    NParsy_Mega },
+      { "4G",    4'000'000'000u,                NParsy_Giga },
+      { "5T",    5'000'000'000'000u,            NParsy_Tera },
+      { "6P",    6'000'000'000'000'000u,        NParsy_Peta },
+      { "7E",    7'000'000'000'000'000'000u,    NParsy_Exa  },
+      { "512Ki", 512u << 10,                    NParsy_Kibi },
+      { "512ki", 512u << 10,                    NParsy_Kibi },
+      { "3Mi",   3u << 20,                      NParsy_Mebi },
+      { "4Gi",   (uint64_t)4u << 30,            NParsy_Gibi },
+      { "5Ti",   (uint64_t)5u << 40,            NParsy_Tebi },
+      { "6Pi",   (uint64_t)6u << 50,            NParsy_Pebi },
+      { "7Ei",   (uint64_t)7u << 60,            NParsy_Exbi },
+   };
+
+   for ( size_t i = 0; i < (sizeof cases / sizeof cases[0]); i++ )
+   {
+      uint64_t val = 0;
+      size_t consumed = 0;
+      enum NParsyUnit unit = NParsy_NoUnit;
+      TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntUnit(cases[i].str, &val, &consumed, NParsy_Dec, &unit) );
+      TEST_ASSERT_EQUAL_UINT64( cases[i].val, val );
+      TEST_ASSERT_EQUAL_INT( cases[i].unit, unit );
+      TEST_ASSERT_EQUAL_size_t( strlen(cases[i].str), consumed );
+   }
+}
+
+void test_NParsyUIntUnit_NoSuffix(void)
+{
+   uint64_t val = 0;
+   size_t consumed = 0;
+   enum NParsyUnit unit = NParsy_Giga;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntUnit("size = 42;", &val, &consumed, NParsy_Dec, &unit) );
+   TEST_ASSERT_EQUAL_UINT64( 42u, val );
+   TEST_ASSERT_EQUAL_INT( NParsy_NoUnit, unit );
+   TEST_ASSERT_EQUAL_size_t( 9, consumed );
+
+   // Letters that hash to a slot but aren't a unit
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntUnit("8Q", &val, &consumed, NParsy_Dec, &unit) );
+   TEST_ASSERT_EQUAL_UINT64( 8u, val );
+   TEST_ASSERT_EQUAL_INT( NParsy_NoUnit, unit );
+   TEST_ASSERT_EQUAL_size_t( 1, consumed );
+}
+
+void test_NParsyUIntUnit_SuffixMustEndTheWord(void)
+{
+   static const char * const strs[] = { "4Gb", "4GiB", "4kHz", "4Kix", "4m" };
+   for ( size_t i = 0; i < (sizeof strs / sizeof strs[0]); i++ )
+   {
+      uint64_t val = 0;
+      size_t consumed = 0;
+      enum NParsyUnit unit = NParsy_Kilo;
+      TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntUnit(strs[i], &val, &consumed, NParsy_Dec, &unit) );
+      TEST_ASSERT_EQUAL_UINT64( 4u, val );
+      TEST_ASSERT_EQUAL_INT( NParsy_NoUnit, unit );
+      TEST_ASSERT_EQUAL_size_t( 1, consumed );
+   }
+
+   // Anything but a letter or digit ends it
+   uint64_t val = 0;
+   enum NParsyUnit unit = NParsy_NoUnit;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntUnit("(16Mi)", &val, nullptr, NParsy_Dec, &unit) );
+   TEST_ASSERT_EQUAL_UINT64( (uint64_t)16u << 20, val );
+   TEST_ASSERT_EQUAL_INT( NParsy_Mebi, unit );
+}
+
+void test_NParsyUIntUnit_OnlyPlainDecimal(void)
+{
+   uint64_t val = 0;
+   enum NParsyUnit unit = NParsy_Kilo;
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntUnit("0x10k", &val, nullptr, NParsy_Dec, &unit) );
+   TEST_ASSERT_EQUAL_UINT64( 0x10u, val );
+   TEST_ASSERT_EQUAL_INT( NParsy_NoUnit, unit );
+
+   // Under the hex default, 'E' is just another digit
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntUnit("1E", &val, nullptr, NParsy_Hex, &unit) );
+   TEST_ASSERT_EQUAL_UINT64( 0x1Eu, val );
+   TEST_ASSERT_EQUAL_INT( NParsy_NoUnit, unit );
+
+   // ...and the exponent of a float isn't a unit
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntUnit("1E3 5", &val, nullptr, NParsy_Dec, &unit) );
+   TEST_ASSERT_EQUAL_UINT64( 5u, val );
+   TEST_ASSERT_EQUAL_INT( NParsy_NoUnit, unit );
+}
+
+void test_NParsyUIntUnit_Overflow(void)
+{
+   uint64_t val = 0;
+   enum NParsyUnit unit = NParsy_NoUnit;
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntUnit("15Ei", &val, nullptr, NParsy_Dec, &unit) );
+   TEST_ASSERT_EQUAL_UINT64( (uint64_t)15u << 60, val );
+
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyUIntUnit("18E", &val, nullptr, NParsy_Dec, &unit) );
+   TEST_ASSERT_EQUAL_UINT64( 18'000'000'000'000'000'000u, val );
+
+   // val is left alone when the scaled value doesn't fit
+   static const char * const too_big[] = { "16Ei", "19E", "20E", "18446744073709551615k" };
+   for ( size_t i = 0; i < (sizeof too_big / sizeof too_big[0]); i++ )
+   {
+      val = 7u;
+      TEST_ASSERT_EQUAL_INT( NParsy_NumberOutOfRange, NParsyUIntUnit(too_big[i], &val, nullptr, NParsy_Dec, &unit) );
+      TEST_ASSERT_EQUAL_UINT64( 7u, val );
+   }
+}
+
+void test_NParsyU64ListUnit_Config(void)
+{
+   static const char cfg[] =
+      "cache = 512Ki\n"
+      "heap  = 4G\n"
+      "rate  = 250k\n"
+      "big   = 99Ei\n"   // overflows, so skipped
+      "port  = 8080\n"
+      "mask  = 0xFF\n";
+   static const uint64_t expected[] = { 512u << 10, 4'000'000'000u, 250'000u, 8080u, 0xFFu };
+   static const enum NParsyUnit expected_units[] = { NParsy_Kibi, NParsy_Giga, NParsy_Kilo, NParsy_NoUnit, NParsy_NoUnit };
+
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListUnit(cfg, Actual, Units, MAX_VALS, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( 5, n );
+   TEST_ASSERT_EQUAL_UINT64_ARRAY( expected, Actual, 5 );
+   for ( size_t i = 0; i < n; i++ )
+      TEST_ASSERT_EQUAL_INT( expected_units[i], Units[i] );
+
+   // Stops once buf is full
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListUnit(cfg, Actual, Units, 2, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( 2, n );
+}
+
+void test_NParsyU64ListUnit_UnitsOptional(void)
+{
+   size_t n = 0;
+   TEST_ASSERT_EQUAL_INT( NParsy_GoodResult, NParsyU64ListUnit("1k 2Ki 3", Actual, nullptr, MAX_VALS, &n, NParsy_Dec) );
+   TEST_ASSERT_EQUAL_size_t( 3, n );
+   TEST_ASSERT_EQUAL_UINT64( 1000u, Actual[0] );
+   TEST_ASSERT_EQUAL_UINT64( 2048u, Actual[1] );
+   TEST_ASSERT_EQUAL_UINT64( 3u, Actual[2] );
+}